@@ -0,0 +1,114 @@
+//
+// BuildDate_bench.cpp --- Build number decoding benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:31:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file BuildDate_bench.cpp
+ * @author Paul Ward
+ * @brief Build number decoding benchmark.
+ *
+ * Decodes a run of consecutive `byyears' build numbers one at a time
+ * through @c VersionInfo::to_date, then as a single batch.
+ *
+ * Usage: BuildDate_bench [count]
+ */
+
+#include "../verbuild/BuildDate.hpp"
+#include "../verbuild/VersionInfo.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+
+using namespace std;
+
+namespace date = boost::gregorian;
+
+static
+double
+seconds_since(chrono::steady_clock::time_point start)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() -
+                                  start).count();
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t                  count = (argc > 1) ? strtoul(argv[1], nullptr, 10)
+                                             : 1000000;
+  const date::date        first(2013, 1, 1);
+  vector<uint32_t>        builds(count);
+  vector<int32_t>         days(count);
+  vector<BuildDateStatus> status(count);
+  long                    check = 0;
+  size_t                  failed;
+
+  set_debug_level(0);
+
+  if (count == 0) {
+    return EXIT_FAILURE;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    date::date d = first + date::days(static_cast<long>(i % 30000));
+
+    builds[i] = (d.year() - 2013) * 10000 + d.month() * 100 + d.day();
+  }
+
+  auto start = chrono::steady_clock::now();
+
+  for (size_t i = 0; i < count; i++) {
+    VersionInfo vi(1, 0, builds[i], 0, 2013, IncrementType::ByYears);
+
+    check += vi.to_date().day();
+  }
+
+  double secs = seconds_since(start);
+
+  printf("to_date: %zu numbers in %.2f ms (%.1f M numbers/s)\n",
+         count, secs * 1e3, count / secs / 1e6);
+
+  start  = chrono::steady_clock::now();
+  failed = decode_build_dates(IncrementType::ByYears, 2013,
+                              builds.data(), count,
+                              days.data(), status.data());
+  secs   = seconds_since(start);
+
+  printf("batch:   %zu numbers in %.2f ms (%.1f M numbers/s), %zu failed\n",
+         count, secs * 1e3, count / secs / 1e6, failed);
+
+  return (check > 0 && failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// BuildDate_bench.cpp ends here.
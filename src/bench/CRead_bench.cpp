@@ -0,0 +1,111 @@
+//
+// CRead_bench.cpp --- C header read cost versus file size.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:44:13
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file CRead_bench.cpp
+ * @author Paul Ward
+ * @brief C header read cost versus file size.
+ *
+ * Writes headers whose version block is followed by a generated table
+ * of increasing size, then times reading each one back.
+ *
+ * Usage: CRead_bench [max MiB]
+ */
+
+#include "../verbuild/Transform_C.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+void
+make_header(const fs::path &path, size_t table_bytes)
+{
+  ofstream strm(path);
+  string   row("    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,\n");
+
+  strm << "#define VERSION_MAJOR      1\n"
+       << "#define VERSION_MINOR      2\n"
+       << "#define VERSION_BUILD      3\n"
+       << "#define VERSION_PATCH      4\n"
+       << "#define VERSION_BASE_YEAR  2013\n\n"
+       << "static const unsigned char table[] = {\n";
+
+  for (size_t n = 0; n < table_bytes; n += row.size()) {
+    strm << row;
+  }
+
+  strm << "};\n";
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t   max_mib = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 64;
+  fs::path path    = fs::temp_directory_path() / "verbuild_bench_read.h";
+  Config   conf;
+
+  set_debug_level(0);
+
+  for (size_t mib = 1; mib <= max_mib; mib *= 4) {
+    CTransform  transform;
+    VersionInfo vi;
+    double      secs;
+
+    make_header(path, mib * 1024 * 1024);
+    transform.set_config(conf);
+    transform.set_filename(path.string());
+
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < 100; i++) {
+      transform.read(vi);
+    }
+
+    secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    printf("%4zu MiB file: %8.3f us per read  (build %u)\n",
+           mib,
+           secs * 1e6 / 100,
+           vi.get_build());
+  }
+
+  fs::remove(path);
+
+  return EXIT_SUCCESS;
+}
+
+// CRead_bench.cpp ends here.
@@ -0,0 +1,176 @@
+//
+// CommitGraph_bench.cpp --- Commit counting benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 01:37:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file CommitGraph_bench.cpp
+ * @author Paul Ward
+ * @brief Commit counting benchmark.
+ *
+ * Writes a synthetic commit-graph, a long line of history with a merge
+ * every hundred commits, and times counting the commits reachable from
+ * its tip: first with no cached count, then again with one.
+ *
+ * Usage: CommitGraph_bench [commits]
+ */
+
+#include "../verbuild/GitRepo.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+void
+be32(string &out, uint32_t val)
+{
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back(static_cast<char>((val >> shift) & 0xFF));
+  }
+}
+
+static
+void
+be64(string &out, uint64_t val)
+{
+  be32(out, static_cast<uint32_t>(val >> 32));
+  be32(out, static_cast<uint32_t>(val));
+}
+
+static
+string
+bench_oid(uint32_t pos, uint32_t total)
+{
+  char buf[41];
+
+  snprintf(buf, sizeof(buf), "%08x%032d",
+           static_cast<unsigned>(pos * (0xFFFFFFFFull / total)), 0);
+
+  return buf;
+}
+
+static
+void
+write_graph(const fs::path &path, uint32_t total)
+{
+  string   out("CGPH\x01\x01\x03\x00", 8);
+  string   fanout;
+  string   oids;
+  string   data;
+  uint64_t offset = 8 + 4 * 12;
+
+  for (uint32_t b = 0, pos = 0; b < 256; b++) {
+    while (pos < total &&
+           stoul(bench_oid(pos, total).substr(0, 2), nullptr, 16) <= b) {
+      pos++;
+    }
+
+    be32(fanout, pos);
+  }
+
+  oids.reserve(total * 20);
+  data.reserve(total * 36);
+
+  for (uint32_t i = 0; i < total; i++) {
+    string oid(bench_oid(i, total));
+
+    for (size_t c = 0; c < 40; c += 2) {
+      oids.push_back(static_cast<char>(stoul(oid.substr(c, 2), nullptr, 16)));
+    }
+
+    data.append(20, '\0');
+    be32(data, (i == 0) ? 0x70000000 : i - 1);
+    be32(data, (i > 50 && i % 100 == 0) ? i - 50 : 0x70000000);
+    be32(data, (i + 1) << 2);
+    be32(data, 1700000000 + i);
+  }
+
+  for (auto chunk : { make_pair("OIDF", &fanout),
+                      make_pair("OIDL", &oids),
+                      make_pair("CDAT", &data) }) {
+    out.append(chunk.first, 4);
+    be64(out, offset);
+    offset += chunk.second->size();
+  }
+
+  out.append(4, '\0');
+  be64(out, offset);
+  out += fanout + oids + data;
+
+  fs::create_directories(path.parent_path());
+  ofstream(path, ios::binary) << out;
+}
+
+int
+main(int argc, char **argv)
+{
+  uint32_t total = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 2000000;
+  fs::path root  = fs::temp_directory_path() / "verbuild_bench_git";
+  fs::path git   = root / ".git";
+  string   head;
+  uint64_t count = 0;
+
+  set_debug_level(0);
+
+  fs::remove_all(root);
+  fs::create_directories(git / "refs" / "heads");
+  write_graph(git / "objects" / "info" / "commit-graph", total);
+  head = bench_oid(total - 1, total);
+  ofstream(git / "HEAD") << head << "\n";
+
+  for (int cached = 0; cached < 2; cached++) {
+    GitRepo repo;
+
+    repo.open(root.string());
+
+    auto start = chrono::steady_clock::now();
+
+    repo.count_commits(head, count);
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() -
+                                           start).count();
+
+    printf("%-8s %llu commits in %.2f ms\n",
+           cached ? "cached:" : "walk:",
+           static_cast<unsigned long long>(count),
+           secs * 1e3);
+  }
+
+  fs::remove_all(root);
+
+  return EXIT_SUCCESS;
+}
+
+// CommitGraph_bench.cpp ends here.
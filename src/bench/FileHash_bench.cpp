@@ -0,0 +1,112 @@
+//
+// FileHash_bench.cpp --- Input hashing benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 04:52:18
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file FileHash_bench.cpp
+ * @author Paul Ward
+ * @brief Input hashing benchmark.
+ *
+ * Writes a tree of small files and times digesting it: first cold,
+ * with every file read, then warm, with every hash from the cache.
+ *
+ * Usage: FileHash_bench [files] [threads]
+ */
+
+#include "../verbuild/InputDigest.hpp"
+#include "../verbuild/FileHashCache.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#define FILES_PER_DIR 1000
+
+int
+main(int argc, char **argv)
+{
+  size_t   total   = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 100000;
+  unsigned threads = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 0;
+  fs::path root    = fs::temp_directory_path() / "verbuild_bench_hash";
+  string   path((root / "inputs.digest.cache").string());
+  string   text(1024, 'x');
+
+  set_debug_level(0);
+
+  fs::remove_all(root);
+
+  for (size_t i = 0; i < total; i++) {
+    fs::path dir = root / "src" / to_string(i / FILES_PER_DIR);
+
+    if (i % FILES_PER_DIR == 0) {
+      fs::create_directories(dir);
+    }
+
+    ofstream(dir / (to_string(i) + ".c"), ios::binary) << i << text;
+  }
+
+  for (int warm = 0; warm < 2; warm++) {
+    FileHashCache cache;
+    InputDigest   inputs({ (root / "src").string() }, &cache, threads);
+    uint64_t      digest;
+
+    cache.load(path);
+
+    auto start = chrono::steady_clock::now();
+
+    if (!inputs.compute(digest)) {
+      return EXIT_FAILURE;
+    }
+
+    double secs = chrono::duration<double>(chrono::steady_clock::now() -
+                                           start).count();
+
+    printf("%-6s %zu files, %zu cached, in %.2f ms (%.0f files/s)\n",
+           warm ? "warm:" : "cold:",
+           inputs.get_file_count(),
+           inputs.get_hit_count(),
+           secs * 1e3,
+           inputs.get_file_count() / secs);
+
+    // The files were only just written; trust their timestamps anyway.
+    cache.save(path, inputs.get_start_time() + HASH_CACHE_SLACK);
+  }
+
+  fs::remove_all(root);
+
+  return EXIT_SUCCESS;
+}
+
+// FileHash_bench.cpp ends here.
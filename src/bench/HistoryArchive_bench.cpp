@@ -0,0 +1,136 @@
+//
+// HistoryArchive_bench.cpp --- History archive decoding benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 10:31:09
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file HistoryArchive_bench.cpp
+ * @author Paul Ward
+ * @brief History archive decoding benchmark.
+ *
+ * Builds the history of many components building several times a day,
+ * archives it, and times decoding every block into columns, then into
+ * journal records.
+ *
+ * Usage: HistoryArchive_bench [records] [components]
+ */
+
+#include "../verbuild/HistoryArchive.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static
+double
+seconds_since(chrono::steady_clock::time_point start)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() -
+                                  start).count();
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t             total = (argc > 1) ? strtoul(argv[1], nullptr, 10)
+                                        : 2000000;
+  size_t             comps = (argc > 2) ? strtoul(argv[2], nullptr, 10)
+                                        : 1000;
+  vector<uint32_t>   builds(comps, 0);
+  HistoryEntryVector entries;
+  HistoryEntryVector decoded;
+  HistoryArchive     archive;
+  ArchiveColumns     cols;
+  string             data;
+  size_t             records = 0;
+
+  set_debug_level(0);
+
+  if (total == 0 || comps == 0) {
+    return EXIT_FAILURE;
+  }
+
+  entries.reserve(total);
+
+  for (size_t i = 0; i < total; i++) {
+    size_t   comp = i % comps;
+    uint32_t prev = builds[comp];
+
+    builds[comp] += 1 + (i / comps) % 3;
+    entries.push_back({ 1600000000 + static_cast<int64_t>(i / comps) * 3600,
+                        IncrementType::Simple,
+                        { 3, 1, prev, 0 },
+                        { 3, 1, builds[comp], 0 },
+                        "component-" + to_string(comp) });
+  }
+
+  HistoryArchive::encode(entries, data);
+  entries.clear();
+  entries.shrink_to_fit();
+
+  printf("archive: %zu records in %zu bytes (%.2f bytes/record)\n",
+         total, data.size(), static_cast<double>(data.size()) / total);
+
+  if (!archive.parse(data)) {
+    return EXIT_FAILURE;
+  }
+
+  auto start = chrono::steady_clock::now();
+
+  for (size_t b = 0; b < archive.get_block_count(); b++) {
+    if (!archive.decode_block(b, cols)) {
+      return EXIT_FAILURE;
+    }
+
+    records += cols.size();
+  }
+
+  double secs = seconds_since(start);
+
+  printf("columns: %zu records in %.2f ms (%.1f M records/s)\n",
+         records, secs * 1e3, records / secs / 1e6);
+
+  start = chrono::steady_clock::now();
+
+  if (!archive.decode(decoded)) {
+    return EXIT_FAILURE;
+  }
+
+  secs = seconds_since(start);
+
+  printf("records: %zu records in %.2f ms (%.1f M records/s)\n",
+         decoded.size(), secs * 1e3, decoded.size() / secs / 1e6);
+
+  return EXIT_SUCCESS;
+}
+
+// HistoryArchive_bench.cpp ends here.
@@ -0,0 +1,140 @@
+//
+// Increment_bench.cpp --- Native versus scripted increment throughput.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 12:41:10
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Increment_bench.cpp
+ * @author Paul Ward
+ * @brief Native versus scripted increment throughput.
+ *
+ * Usage: Increment_bench [iterations]
+ */
+
+#include "../verbuild/VersionInfo.hpp"
+#include "../verbuild/LuaPolicy.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+double
+run(const char *label, size_t iterations, VersionInfo &vi)
+{
+  auto   start = chrono::steady_clock::now();
+  double secs;
+
+  for (size_t i = 0; i < iterations; i++) {
+    vi.increment(IncrementMode::Build);
+  }
+
+  secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  printf("%-24s %12zu calls %10.3f ms %14.0f calls/s  (build %u)\n",
+         label,
+         iterations,
+         secs * 1000.0,
+         iterations / secs,
+         vi.get_build());
+
+  return secs;
+}
+
+static
+bool
+load_policy(LuaPolicy &policy, const fs::path &path, const char *source)
+{
+  ofstream(path) << source;
+
+  return policy.load(path.string(), "");
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t    iterations = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+  fs::path  dir        = fs::temp_directory_path();
+  LuaPolicy simple;
+  LuaPolicy weekly;
+  double    native_secs;
+  double    scripted_secs;
+
+  set_debug_level(0);
+
+  if (!load_policy(simple,
+                   dir / "verbuild_bench_simple.lua",
+                   "return function(build) return build + 1 end\n") ||
+      !load_policy(weekly,
+                   dir / "verbuild_bench_weekly.lua",
+                   "local y, w, d = verbuild.iso_week()\n"
+                   "local base = (y % 100) * 100000 + w * 1000 + d * 100\n"
+                   "return function(build)\n"
+                   "  if build >= base and build < base + 99 then\n"
+                   "    return build + 1\n"
+                   "  end\n"
+                   "  return base + 1\n"
+                   "end\n")) {
+    return EXIT_FAILURE;
+  }
+
+  {
+    VersionInfo vi(1, 0, 0, 0, 2013, IncrementType::Simple);
+
+    native_secs = run("native simple", iterations, vi);
+  }
+
+  {
+    VersionInfo vi(1, 0, 0, 0, 2013, IncrementType::Script);
+
+    vi.set_increment_policy(&simple);
+    scripted_secs = run("scripted simple", iterations, vi);
+  }
+
+  {
+    VersionInfo vi(1, 0, 0, 0, 2013, IncrementType::Script);
+
+    vi.set_increment_policy(&weekly);
+    run("scripted iso-week", iterations, vi);
+  }
+
+  printf("scripted/native overhead: %.2fx\n", scripted_secs / native_secs);
+
+  fs::remove(dir / "verbuild_bench_simple.lua");
+  fs::remove(dir / "verbuild_bench_weekly.lua");
+
+  return EXIT_SUCCESS;
+}
+
+// Increment_bench.cpp ends here.
@@ -0,0 +1,130 @@
+//
+// LuaBulk_bench.cpp --- Per-record versus bulk Lua rendering.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 15:31:06
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaBulk_bench.cpp
+ * @author Paul Ward
+ * @brief Per-record versus bulk Lua rendering.
+ *
+ * Usage: LuaBulk_bench [records]
+ */
+
+#include "../verbuild/VersionInfo.hpp"
+#include "../verbuild/Transform_Lua.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+bool
+run(const char                  *label,
+    const fs::path              &path,
+    const vector<VersionInfo *> &vis)
+{
+  Config         conf;
+  vector<string> out;
+  double         secs;
+
+  conf.script = path.string();
+
+  LuaTransform transform;
+
+  transform.set_config(conf);
+
+  auto start = chrono::steady_clock::now();
+
+  if (!transform.write_all(vis, out)) {
+    return false;
+  }
+
+  secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  printf("%-12s %10zu records %10.3f ms %14.0f records/s\n",
+         label,
+         out.size(),
+         secs * 1000.0,
+         out.size() / secs);
+
+  return true;
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t                          count  = (argc > 1)
+                                             ? strtoul(argv[1], nullptr, 10)
+                                             : 100000;
+  fs::path                        dir    = fs::temp_directory_path();
+  fs::path                        single = dir / "verbuild_bench_single.lua";
+  fs::path                        bulk   = dir / "verbuild_bench_bulk.lua";
+  vector<unique_ptr<VersionInfo>> store;
+  vector<VersionInfo *>           vis;
+  bool                            ok;
+
+  set_debug_level(0);
+
+  ofstream(single) << "local function write(vi, conf)\n"
+                   << "  return conf.prefix .. vi:to_string() end\n"
+                   << "return { write = write }\n";
+  ofstream(bulk) << "local function write(vi, conf)\n"
+                 << "  return conf.prefix .. vi:to_string() end\n"
+                 << "return { write = write,\n"
+                 << "  write_all = function(vis, conf)\n"
+                 << "    local out = {}\n"
+                 << "    for i = 1, #vis do out[i] = write(vis[i], conf) end\n"
+                 << "    return out end }\n";
+
+  for (size_t i = 0; i < count; i++) {
+    store.emplace_back(new VersionInfo(1,
+                                       0,
+                                       static_cast<uint32_t>(i),
+                                       0,
+                                       2013,
+                                       IncrementType::Simple));
+    vis.push_back(store.back().get());
+  }
+
+  ok = run("per-record", single, vis) && run("bulk", bulk, vis);
+
+  fs::remove(single);
+  fs::remove(bulk);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// LuaBulk_bench.cpp ends here.
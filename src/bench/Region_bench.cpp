@@ -0,0 +1,119 @@
+//
+// Region_bench.cpp --- Marker region search throughput.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 20:31:27
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Region_bench.cpp
+ * @author Paul Ward
+ * @brief Marker region search throughput.
+ *
+ * Builds a document of prose with regions scattered through it and
+ * times finding every region, then a full region write.
+ *
+ * Usage: Region_bench [MiB] [regions]
+ */
+
+#include "../verbuild/Transform_Region.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+int
+main(int argc, char **argv)
+{
+  size_t       mib     = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 16;
+  size_t       count   = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 1000;
+  fs::path     path    = fs::temp_directory_path() / "verbuild_bench.md";
+  string       prose("Lorem ipsum dolor sit amet: consectetur adipiscing, "
+                     "sed do eiusmod tempor incididunt ut labore.\n");
+  string       region("Version <!-- verbuild:begin -->0.0.0.0"
+                      "<!-- verbuild:end -->\n");
+  string       text;
+  RegionVector regions;
+  Config       conf;
+  VersionInfo  vi(1, 2, 3, 4, 2020, IncrementType::Simple);
+  size_t       every;
+  double       secs;
+
+  set_debug_level(0);
+
+  text.reserve(mib * 1024 * 1024 + count * region.size());
+  every = (mib * 1024 * 1024 / prose.size()) / max<size_t>(count, 1);
+
+  for (size_t i = 0; text.size() < mib * 1024 * 1024; i++) {
+    text.append((every > 0 && i % every == 0) ? region : prose);
+  }
+
+  {
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < 10; i++) {
+      find_regions(text.data(), text.size(), regions);
+    }
+
+    secs = chrono::duration<double>(chrono::steady_clock::now() - start)
+             .count() / 10;
+    printf("find_regions: %zu regions in %.1f MiB, %.2f ms, %.0f MiB/s\n",
+           regions.size(),
+           text.size() / 1048576.0,
+           secs * 1e3,
+           text.size() / 1048576.0 / secs);
+  }
+
+  ofstream(path, ios::binary) << text;
+
+  for (int update = 0; update < 2; update++) {
+    RegionTransform transform;
+
+    conf.update = (update != 0);
+    transform.set_config(conf);
+    transform.set_filename(path.string());
+
+    auto start = chrono::steady_clock::now();
+
+    transform.write(vi);
+    secs = chrono::duration<double>(chrono::steady_clock::now() - start)
+             .count();
+    printf("%-12s %.2f ms\n", update ? "update:" : "write:", secs * 1e3);
+    vi.set_build(vi.get_build() + 1);
+  }
+
+  fs::remove(path);
+
+  return EXIT_SUCCESS;
+}
+
+// Region_bench.cpp ends here.
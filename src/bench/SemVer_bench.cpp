@@ -0,0 +1,119 @@
+//
+// SemVer_bench.cpp --- Semantic version parsing and sorting benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 10:48:31
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file SemVer_bench.cpp
+ * @author Paul Ward
+ * @brief Semantic version parsing and sorting benchmark.
+ *
+ * Parses a batch of versions, a quarter of them prereleases, into one
+ * arena and sorts them by precedence.
+ *
+ * Usage: SemVer_bench [count]
+ */
+
+#include "../verbuild/SemVer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+static
+double
+seconds_since(chrono::steady_clock::time_point start)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() -
+                                  start).count();
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t              count = (argc > 1) ? strtoul(argv[1], nullptr, 10)
+                                         : 1000000;
+  const char         *tags[] = { "alpha", "beta", "rc" };
+  mt19937             rng(5);
+  string              text;
+  vector<size_t>      ends;
+  vector<string_view> views;
+  SemVerArena         arena;
+  SemVerVector        versions;
+  size_t              failed;
+
+  if (count == 0) {
+    return EXIT_FAILURE;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    text += to_string(rng() % 5) + "." + to_string(rng() % 40) + "." +
+            to_string(rng() % 300);
+
+    if (rng() % 4 == 0) {
+      text += string("-") + tags[rng() % 3] + "." + to_string(rng() % 12);
+    }
+
+    if (rng() % 8 == 0) {
+      text += "+build." + to_string(rng() % 10000);
+    }
+
+    ends.push_back(text.size());
+  }
+
+  for (size_t i = 0, from = 0; i < count; from = ends[i++]) {
+    views.emplace_back(text.data() + from, ends[i] - from);
+  }
+
+  auto start = chrono::steady_clock::now();
+
+  failed = parse_semvers(views, arena, versions);
+
+  double secs = seconds_since(start);
+
+  printf("parse: %zu versions in %.2f ms (%.1f M versions/s), "
+         "%zu bytes in arena\n",
+         count, secs * 1e3, count / secs / 1e6, arena.get_used());
+
+  start = chrono::steady_clock::now();
+  sort_semvers(versions.data(), versions.size());
+  secs  = seconds_since(start);
+
+  printf("sort:  %zu versions in %.2f ms (%.1f M versions/s)\n",
+         count, secs * 1e3, count / secs / 1e6);
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// SemVer_bench.cpp ends here.
@@ -0,0 +1,107 @@
+//
+// VersionKey_bench.cpp --- Version key sorting benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 14:26:13
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionKey_bench.cpp
+ * @author Paul Ward
+ * @brief Version key sorting benchmark.
+ *
+ * Sorts the same random versions with @c std::sort and with the radix
+ * sort, then deduplicates them.
+ *
+ * Usage: VersionKey_bench [count]
+ */
+
+#include "../verbuild/VersionKey.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace std;
+
+static
+double
+seconds_since(chrono::steady_clock::time_point start)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() -
+                                  start).count();
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t           count = (argc > 1) ? strtoul(argv[1], nullptr, 10)
+                                      : 5000000;
+  mt19937          rng(1);
+  VersionKeyVector keys(count);
+  VersionKeyVector copy;
+  size_t           distinct;
+  bool             same;
+
+  if (count == 0) {
+    return EXIT_FAILURE;
+  }
+
+  for (auto &it : keys) {
+    it = VersionKey::make(rng() % 4, rng() % 30, rng() % 100000, rng() % 3);
+  }
+
+  copy = keys;
+
+  auto start = chrono::steady_clock::now();
+
+  sort(copy.begin(), copy.end());
+
+  double secs = seconds_since(start);
+
+  printf("std::sort: %zu keys in %.2f ms (%.1f M keys/s)\n",
+         count, secs * 1e3, count / secs / 1e6);
+
+  start = chrono::steady_clock::now();
+  sort_version_keys(keys.data(), keys.size());
+  secs  = seconds_since(start);
+
+  printf("radix:     %zu keys in %.2f ms (%.1f M keys/s)\n",
+         count, secs * 1e3, count / secs / 1e6);
+
+  same     = (keys == copy);
+  start    = chrono::steady_clock::now();
+  distinct = unique_version_keys(keys.data(), keys.size());
+  secs     = seconds_since(start);
+
+  printf("unique:    %zu distinct in %.2f ms\n", distinct, secs * 1e3);
+
+  return same ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// VersionKey_bench.cpp ends here.
@@ -0,0 +1,109 @@
+//
+// VersionScanner_bench.cpp --- Version string scanning benchmark.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 11:14:52
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionScanner_bench.cpp
+ * @author Paul Ward
+ * @brief Version string scanning benchmark.
+ *
+ * Builds a synthetic build log, with a timestamp on every line and a
+ * version on one line in eight, and times scanning it.
+ *
+ * Usage: VersionScanner_bench [megabytes]
+ */
+
+#include "../verbuild/VersionScanner.hpp"
+#include "../verbuild/Console.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace std;
+
+static
+double
+seconds_since(chrono::steady_clock::time_point start)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() -
+                                  start).count();
+}
+
+int
+main(int argc, char **argv)
+{
+  size_t             mbytes = (argc > 1) ? strtoul(argv[1], nullptr, 10)
+                                         : 256;
+  size_t             size   = mbytes * 1024 * 1024;
+  VersionMatchVector matches;
+  string             text;
+  char               line[128];
+  size_t             n = 0;
+
+  set_debug_level(0);
+
+  if (size == 0) {
+    return EXIT_FAILURE;
+  }
+
+  text.reserve(size + sizeof(line));
+
+  while (text.size() < size) {
+    unsigned secs = static_cast<unsigned>(n % 86400);
+
+    if (n % 8 == 0) {
+      snprintf(line, sizeof(line),
+               "[%02u:%02u:%02u] linking component-%zu version 3.1.%zu.0\n",
+               secs / 3600, secs / 60 % 60, secs % 60, n % 97, n);
+    } else {
+      snprintf(line, sizeof(line),
+               "[%02u:%02u:%02u] compiling src/module_%zu/file.cpp\n",
+               secs / 3600, secs / 60 % 60, secs % 60, n % 97);
+    }
+
+    text += line;
+    n++;
+  }
+
+  auto start = chrono::steady_clock::now();
+
+  VersionScanner::scan(text.data(), text.size(), matches);
+
+  double secs = seconds_since(start);
+
+  printf("scan: %zu MiB, %zu matches in %.2f ms (%.2f GB/s)\n",
+         text.size() >> 20, matches.size(), secs * 1e3,
+         text.size() / secs / 1e9);
+
+  return (matches.size() == (n + 7) / 8) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// VersionScanner_bench.cpp ends here.
@@ -2,18 +2,33 @@
 #ifndef __resource_help_h__
 #define __resource_help_h__
 
+#include "help/component.h"
 #include "help/create.h"
+#include "help/debounce.h"
 #include "help/debug.h"
+#include "help/digest_file.h"
 #include "help/format.h"
 #include "help/groups.h"
+#include "help/history.h"
+#include "help/if_changed.h"
 #include "help/increment.h"
 #include "help/list_groups.h"
 #include "help/list_increments.h"
 #include "help/list_transforms.h"
+#include "help/lua_instructions.h"
+#include "help/lua_memory.h"
 #include "help/output.h"
+#include "help/policy.h"
 #include "help/prefix.h"
+#include "help/scan_limit.h"
+#include "help/script.h"
+#include "help/script_cache.h"
+#include "help/template.h"
 #include "help/transform.h"
+#include "help/update.h"
 #include "help/verbose.h"
+#include "help/watch.h"
+#include "help/watch_input.h"
 #include "help/year.h"
 
 #endif
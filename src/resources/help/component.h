@@ -0,0 +1,16 @@
+#pragma once
+#ifndef __resource_component_h__
+#define __resource_component_h__
+
+const unsigned char res_help_component[] = {
+  0x4e, 0x61, 0x6d, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x63, 0x6f,
+  0x72, 0x64, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74,
+  0x73, 0x20, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2e, 0x20,
+  0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x74, 0x6f,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x6f,
+  0x75, 0x74, 0x70, 0x75, 0x74, 0x27, 0x73, 0x20, 0x6e, 0x61, 0x6d, 0x65,
+  0x2e, 0x00
+};
+
+#endif
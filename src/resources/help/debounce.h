@@ -0,0 +1,19 @@
+#pragma once
+#ifndef __resource_debounce_h__
+#define __resource_debounce_h__
+
+const unsigned char res_help_debounce[] = {
+  0x57, 0x69, 0x74, 0x68, 0x20, 0x2d, 0x2d, 0x77, 0x61, 0x74, 0x63, 0x68,
+  0x2c, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63,
+  0x68, 0x61, 0x6e, 0x67, 0x65, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20,
+  0x73, 0x74, 0x6f, 0x70, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x73, 0x20,
+  0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61,
+  0x74, 0x65, 0x64, 0x2c, 0x20, 0x73, 0x6f, 0x20, 0x61, 0x20, 0x62, 0x75,
+  0x72, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67,
+  0x65, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x73, 0x20, 0x69,
+  0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72, 0x65, 0x67, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x00
+};
+
+#endif
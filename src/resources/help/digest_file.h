@@ -0,0 +1,18 @@
+#pragma once
+#ifndef __resource_digest_file_h__
+#define __resource_digest_file_h__
+
+const unsigned char res_help_digest_file[] = {
+  0x57, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6b, 0x65, 0x65,
+  0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x2d, 0x2d, 0x69, 0x66,
+  0x2d, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x70,
+  0x75, 0x74, 0x73, 0x2e, 0x20, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c,
+  0x74, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+  0x72, 0x73, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x27, 0x73,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x60,
+  0x2e, 0x64, 0x69, 0x67, 0x65, 0x73, 0x74, 0x27, 0x20, 0x61, 0x70, 0x70,
+  0x65, 0x6e, 0x64, 0x65, 0x64, 0x2e, 0x00
+};
+
+#endif
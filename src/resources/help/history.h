@@ -0,0 +1,15 @@
+#pragma once
+#ifndef __resource_history_h__
+#define __resource_history_h__
+
+const unsigned char res_help_history[] = {
+  0x52, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+  0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f,
+  0x72, 0x79, 0x20, 0x6a, 0x6f, 0x75, 0x72, 0x6e, 0x61, 0x6c, 0x2c, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x60, 0x76, 0x65, 0x72, 0x62, 0x75, 0x69, 0x6c,
+  0x64, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x27, 0x20, 0x74,
+  0x6f, 0x20, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2e, 0x00
+};
+
+#endif
@@ -0,0 +1,18 @@
+#pragma once
+#ifndef __resource_if_changed_h__
+#define __resource_if_changed_h__
+
+const unsigned char res_help_if_changed[] = {
+  0x4f, 0x6e, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x73,
+  0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x6f, 0x72, 0x20, 0x64,
+  0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x69, 0x65, 0x73, 0x20, 0x68,
+  0x61, 0x76, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20,
+  0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6c, 0x61,
+  0x73, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x2e, 0x20, 0x20, 0x4d, 0x61, 0x79,
+  0x20, 0x62, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x6d, 0x6f,
+  0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x6f, 0x6e, 0x63, 0x65,
+  0x2e, 0x00
+};
+
+#endif
@@ -5,7 +5,43 @@
 const unsigned char res_help_increment[] = {
   0x54, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65, 0x6e,
   0x74, 0x20, 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x20,
-  0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x2e, 0x00
+  0x74, 0x6f, 0x20, 0x75, 0x73, 0x65, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65,
+  0x20, 0x60, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x27, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x60, 0x70, 0x6f, 0x6c, 0x69, 0x63, 0x79, 0x27, 0x20, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x2e, 0x0a, 0x0a, 0x54, 0x68, 0x65, 0x20,
+  0x60, 0x67, 0x69, 0x74, 0x74, 0x61, 0x67, 0x27, 0x2c, 0x20, 0x60, 0x67,
+  0x69, 0x74, 0x73, 0x68, 0x61, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x60,
+  0x67, 0x69, 0x74, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x27, 0x20, 0x74, 0x79,
+  0x70, 0x65, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x65, 0x6e, 0x63, 0x6c, 0x6f, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x67,
+  0x69, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x6f, 0x72,
+  0x79, 0x3a, 0x20, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6d, 0x69, 0x6e, 0x6f, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+  0x61, 0x6b, 0x65, 0x6e, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x76, 0x65,
+  0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x67, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x70, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x31,
+  0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6b, 0x65,
+  0x64, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+  0x6d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2e, 0x20, 0x20, 0x54,
+  0x68, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x75,
+  0x70, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x30, 0x20, 0x61, 0x66, 0x74,
+  0x65, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6e, 0x65, 0x77, 0x20,
+  0x74, 0x61, 0x67, 0x20, 0x28, 0x60, 0x67, 0x69, 0x74, 0x74, 0x61, 0x67,
+  0x27, 0x29, 0x2c, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+  0x62, 0x62, 0x72, 0x65, 0x76, 0x69, 0x61, 0x74, 0x65, 0x64, 0x20, 0x63,
+  0x6f, 0x6d, 0x6d, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x28,
+  0x60, 0x67, 0x69, 0x74, 0x73, 0x68, 0x61, 0x27, 0x29, 0x2c, 0x20, 0x6f,
+  0x72, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x75, 0x6d,
+  0x62, 0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x6d, 0x6d, 0x69,
+  0x74, 0x73, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6c, 0x65,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x48, 0x45, 0x41, 0x44, 0x20, 0x28,
+  0x60, 0x67, 0x69, 0x74, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x27, 0x29, 0x2e,
+  0x00
 };
 
 #endif
@@ -0,0 +1,14 @@
+#pragma once
+#ifndef __resource_lua_memory_h__
+#define __resource_lua_memory_h__
+
+const unsigned char res_help_lua_memory[] = {
+  0x4d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+  0x72, 0x79, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x4d, 0x69, 0x42, 0x2c, 0x20,
+  0x61, 0x20, 0x4c, 0x75, 0x61, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x6d, 0x61, 0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74,
+  0x65, 0x3b, 0x20, 0x30, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x20,
+  0x6c, 0x69, 0x6d, 0x69, 0x74, 0x2e, 0x00
+};
+
+#endif
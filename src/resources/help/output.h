@@ -7,7 +7,17 @@ const unsigned char res_help_output[] = {
   0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
   0x6e, 0x20, 0x69, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x69, 0x6f,
   0x6e, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x77, 0x72,
-  0x69, 0x74, 0x74, 0x65, 0x6e, 0x2e, 0x00
+  0x69, 0x74, 0x74, 0x65, 0x6e, 0x2e, 0x20, 0x20, 0x4d, 0x61, 0x79, 0x20,
+  0x62, 0x65, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x64, 0x2c,
+  0x20, 0x61, 0x73, 0x20, 0x60, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f,
+  0x72, 0x6d, 0x3a, 0x66, 0x69, 0x6c, 0x65, 0x27, 0x20, 0x74, 0x6f, 0x20,
+  0x75, 0x73, 0x65, 0x20, 0x61, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72,
+  0x65, 0x6e, 0x74, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72,
+  0x6d, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x66,
+  0x69, 0x6c, 0x65, 0x3b, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x69, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x72, 0x65, 0x61,
+  0x64, 0x2e, 0x00
 };
 
 #endif
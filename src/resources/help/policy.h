@@ -0,0 +1,25 @@
+#pragma once
+#ifndef __resource_policy_h__
+#define __resource_policy_h__
+
+const unsigned char res_help_policy[] = {
+  0x4c, 0x75, 0x61, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x70,
+  0x72, 0x6f, 0x76, 0x69, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65,
+  0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x60, 0x73,
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x27, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65,
+  0x6d, 0x65, 0x6e, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2e, 0x0a, 0x0a,
+  0x54, 0x68, 0x65, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6e,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x64,
+  0x20, 0x61, 0x73, 0x0a, 0x60, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x6d, 0x65,
+  0x6e, 0x74, 0x28, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x2c, 0x20, 0x62, 0x61,
+  0x73, 0x65, 0x5f, 0x79, 0x65, 0x61, 0x72, 0x2c, 0x20, 0x6d, 0x61, 0x6a,
+  0x6f, 0x72, 0x2c, 0x20, 0x6d, 0x69, 0x6e, 0x6f, 0x72, 0x2c, 0x20, 0x70,
+  0x61, 0x74, 0x63, 0x68, 0x29, 0x27, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6e, 0x65, 0x77, 0x0a, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6e, 0x75,
+  0x6d, 0x62, 0x65, 0x72, 0x2e, 0x00
+};
+
+#endif
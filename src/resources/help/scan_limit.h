@@ -0,0 +1,15 @@
+#pragma once
+#ifndef __resource_scan_limit_h__
+#define __resource_scan_limit_h__
+
+const unsigned char res_help_scan_limit[] = {
+  0x4d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x20, 0x6e, 0x75, 0x6d, 0x62,
+  0x65, 0x72, 0x20, 0x6f, 0x66, 0x20, 0x4b, 0x69, 0x42, 0x20, 0x74, 0x6f,
+  0x20, 0x73, 0x63, 0x61, 0x6e, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x72,
+  0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x78,
+  0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x20, 0x68, 0x65, 0x61,
+  0x64, 0x65, 0x72, 0x3b, 0x20, 0x30, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e,
+  0x6f, 0x20, 0x6c, 0x69, 0x6d, 0x69, 0x74, 0x2e, 0x00
+};
+
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+#ifndef __resource_script_h__
+#define __resource_script_h__
+
+const unsigned char res_help_script[] = {
+  0x4c, 0x75, 0x61, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x69,
+  0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x60, 0x6c, 0x75, 0x61, 0x27, 0x20, 0x74, 0x72,
+  0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x0a, 0x0a, 0x54, 0x68,
+  0x65, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x6d, 0x75, 0x73,
+  0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x61, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x60, 0x72, 0x65, 0x61, 0x64, 0x28, 0x76, 0x69, 0x2c,
+  0x20, 0x74, 0x65, 0x78, 0x74, 0x29, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x0a,
+  0x60, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x76, 0x69, 0x2c, 0x20, 0x63,
+  0x6f, 0x6e, 0x66, 0x29, 0x27, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x2e, 0x00
+};
+
+#endif
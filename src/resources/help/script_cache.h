@@ -0,0 +1,14 @@
+#pragma once
+#ifndef __resource_script_cache_h__
+#define __resource_script_cache_h__
+
+const unsigned char res_help_script_cache[] = {
+  0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x70, 0x72, 0x65, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65,
+  0x64, 0x20, 0x4c, 0x75, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6f,
+  0x64, 0x65, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x60, 0x6e, 0x6f, 0x6e, 0x65,
+  0x27, 0x20, 0x74, 0x6f, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 0x65,
+  0x2e, 0x00
+};
+
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+#ifndef __resource_update_h__
+#define __resource_update_h__
+
+const unsigned char res_help_update[] = {
+  0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74,
+  0x69, 0x6e, 0x67, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x77, 0x72,
+  0x69, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6c, 0x65,
+  0x61, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74,
+  0x68, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20,
+  0x74, 0x68, 0x65, 0x6d, 0x20, 0x75, 0x6e, 0x74, 0x6f, 0x75, 0x63, 0x68,
+  0x65, 0x64, 0x2e, 0x20, 0x20, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f,
+  0x72, 0x6d, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6e,
+  0x6e, 0x6f, 0x74, 0x20, 0x64, 0x6f, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+  0x72, 0x65, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x2e, 0x00
+};
+
+#endif
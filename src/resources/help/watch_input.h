@@ -0,0 +1,15 @@
+#pragma once
+#ifndef __resource_watch_input_h__
+#define __resource_watch_input_h__
+
+const unsigned char res_help_watch_input[] = {
+  0x41, 0x20, 0x66, 0x75, 0x72, 0x74, 0x68, 0x65, 0x72, 0x20, 0x66, 0x69,
+  0x6c, 0x65, 0x20, 0x6f, 0x72, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+  0x6f, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x77, 0x61, 0x74, 0x63, 0x68,
+  0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x2d, 0x2d, 0x77, 0x61, 0x74, 0x63,
+  0x68, 0x2e, 0x20, 0x20, 0x4d, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x67,
+  0x69, 0x76, 0x65, 0x6e, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x68,
+  0x61, 0x6e, 0x20, 0x6f, 0x6e, 0x63, 0x65, 0x2e, 0x00
+};
+
+#endif
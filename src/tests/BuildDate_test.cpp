@@ -0,0 +1,192 @@
+//
+// BuildDate_test.cpp --- Build number to date decoding tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:05:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file BuildDate_test.cpp
+ * @author Paul Ward
+ * @brief Build number to date decoding tests.
+ */
+
+#define BOOST_TEST_MODULE BuildDate_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+
+#include "../verbuild/BuildDate.hpp"
+#include "../verbuild/VersionInfo.hpp"
+
+namespace date = boost::gregorian;
+using namespace std;
+
+static
+BuildDateStatus
+decode(IncrementType type, uint32_t base, uint32_t build, string &out)
+{
+  int32_t         days;
+  BuildDateStatus status = decode_build_date(type, base, build, days);
+
+  out = (status == BuildDateStatus::Ok) ? format_build_date(days) : "";
+
+  return status;
+}
+
+BOOST_AUTO_TEST_CASE(known)
+{
+  string out;
+
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 20171122, out),
+                    BuildDateStatus::Ok);
+  BOOST_CHECK_EQUAL(out, "2017-11-22");
+
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByYears, 2013, 41122, out),
+                    BuildDateStatus::Ok);
+  BOOST_CHECK_EQUAL(out, "2017-11-22");
+
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByYears, 2013, 122, out),
+                    BuildDateStatus::Ok);
+  BOOST_CHECK_EQUAL(out, "2013-01-22");
+
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByMonths, 2013, 5922, out),
+                    BuildDateStatus::Ok);
+  BOOST_CHECK_EQUAL(out, "2017-11-22");
+
+  // Day 31 of a short month is pulled back, as Boost's months do.
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByMonths, 2013, 231, out),
+                    BuildDateStatus::Ok);
+  BOOST_CHECK_EQUAL(out, "2013-02-28");
+}
+
+BOOST_AUTO_TEST_CASE(errors)
+{
+  string out;
+
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 20170229, out),
+                    BuildDateStatus::BadDay);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 19000229, out),
+                    BuildDateStatus::BadDay);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 20000229, out),
+                    BuildDateStatus::Ok);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 20171322, out),
+                    BuildDateStatus::BadMonth);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 1122, out),
+                    BuildDateStatus::BadYear);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByYears, 2013, 41100, out),
+                    BuildDateStatus::BadDay);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByMonths, 2013, 132, out),
+                    BuildDateStatus::BadDay);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByYears, 0xFFFFFFFF, 122, out),
+                    BuildDateStatus::BadYear);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 2013, 0, out),
+                    BuildDateStatus::NoDate);
+  BOOST_CHECK_EQUAL(decode(IncrementType::ByDate, 0, 20171122, out),
+                    BuildDateStatus::NoDate);
+  BOOST_CHECK_EQUAL(decode(IncrementType::Simple, 2013, 20171122, out),
+                    BuildDateStatus::NoDate);
+}
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  const date::date        epoch(1970, 1, 1);
+  const date::date        first(2013, 1, 1);
+  const size_t            count = 6000;
+  vector<uint32_t>        by_date(count);
+  vector<uint32_t>        by_years(count);
+  vector<uint32_t>        by_months(count);
+  vector<int32_t>         want(count);
+  vector<int32_t>         days(count);
+  vector<BuildDateStatus> status(count);
+
+  for (size_t i = 0; i < count; i++) {
+    date::date d = first + date::days(static_cast<long>(i));
+    uint32_t   y = d.year();
+    uint32_t   m = d.month();
+    uint32_t   n = d.day();
+
+    by_date[i]   = y * 10000 + m * 100 + n;
+    by_years[i]  = (y - 2013) * 10000 + m * 100 + n;
+    by_months[i] = ((y - 2013) * 12 + m) * 100 + n;
+    want[i]      = static_cast<int32_t>((d - epoch).days());
+  }
+
+  BOOST_CHECK_EQUAL(decode_build_dates(IncrementType::ByDate, 2013,
+                                       by_date.data(), count,
+                                       days.data(), status.data()), 0);
+  BOOST_CHECK(days == want);
+
+  BOOST_CHECK_EQUAL(decode_build_dates(IncrementType::ByYears, 2013,
+                                       by_years.data(), count,
+                                       days.data(), status.data()), 0);
+  BOOST_CHECK(days == want);
+
+  BOOST_CHECK_EQUAL(decode_build_dates(IncrementType::ByMonths, 2013,
+                                       by_months.data(), count,
+                                       days.data(), status.data()), 0);
+  BOOST_CHECK(days == want);
+
+  // One bad element does not disturb its neighbours.
+  by_date[10] = 20170230;
+  BOOST_CHECK_EQUAL(decode_build_dates(IncrementType::ByDate, 2013,
+                                       by_date.data(), count,
+                                       days.data(), status.data()), 1);
+  BOOST_CHECK_EQUAL(status[10], BuildDateStatus::BadDay);
+  BOOST_CHECK_EQUAL(days[11], want[11]);
+}
+
+BOOST_AUTO_TEST_CASE(civil)
+{
+  int      year;
+  unsigned month;
+  unsigned day;
+
+  for (int32_t days = -700000; days < 3000000; days += 997) {
+    civil_from_days(days, year, month, day);
+    BOOST_CHECK_EQUAL(days_from_civil(year, month, day), days);
+  }
+
+  civil_from_days(0, year, month, day);
+  BOOST_CHECK_EQUAL(year, 1970);
+  BOOST_CHECK_EQUAL(month, 1U);
+  BOOST_CHECK_EQUAL(day, 1U);
+}
+
+BOOST_AUTO_TEST_CASE(to_date)
+{
+  VersionInfo good(1, 0, 20171122, 0, 2013, IncrementType::ByDate);
+  VersionInfo bad(1, 0, 20170230, 0, 2013, IncrementType::ByDate);
+
+  BOOST_CHECK_EQUAL(good.to_date(), date::date(2017, 11, 22));
+  BOOST_CHECK(bad.to_date().is_not_a_date());
+}
+
+// BuildDate_test.cpp ends here.
@@ -0,0 +1,230 @@
+//
+// CHeaderScanner_test.cpp --- C header scanner tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:31:52
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file CHeaderScanner_test.cpp
+ * @author Paul Ward
+ * @brief C header scanner tests.
+ */
+
+#define BOOST_TEST_MODULE CHeaderScanner_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../verbuild/CHeaderScanner.hpp"
+#include "../verbuild/Transform_C.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static const char defines[] =
+  "/**\n"
+  " * @def X_VERSION_MAJOR\n"
+  " * @brief Major version number.\n"
+  " */\n"
+  "#define X_VERSION_MAJOR      3\n"
+  "#define X_VERSION_MINOR      14\n"
+  "#define X_VERSION_BUILD      1592\n"
+  "#define X_VERSION_PATCH      6\n\n"
+  "#define X_VERSION_BASE_YEAR  2011\n"
+  "#define X_VERSION_STRING     \"3.14.1592.6\"\n";
+
+static const char structure[] =
+  "static struct VersionNumber_s {\n"
+  "    int baseYear;\n"
+  "} VersionNumber = {\n"
+  "    2009,\n"
+  "    1,\n"
+  "    2,\n"
+  "    3,\n"
+  "    4\n"
+  "};\n";
+
+BOOST_AUTO_TEST_SUITE(CHeaderScanner_test_suite)
+
+BOOST_AUTO_TEST_CASE(defines_any_chunking)
+{
+  for (size_t chunk = 1; chunk <= sizeof(defines); chunk++) {
+    CHeaderScanner scanner;
+    VersionInfo    vi;
+    size_t         len = sizeof(defines) - 1;
+
+    for (size_t i = 0; i < len && !scanner.done(); i += chunk) {
+      scanner.feed(defines + i, min(chunk, len - i));
+    }
+    scanner.finish();
+
+    BOOST_REQUIRE(scanner.done());
+    scanner.apply(vi);
+    BOOST_CHECK_EQUAL(vi.to_string(), "3.14.1592.6");
+    BOOST_CHECK_EQUAL(vi.get_base_year(), 2011);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(stops_early)
+{
+  CHeaderScanner scanner;
+  string         text(defines);
+
+  text.append(1024 * 1024, '#');
+
+  BOOST_CHECK(scanner.feed(text.data(), text.size()) < sizeof(defines));
+  BOOST_CHECK(scanner.done());
+}
+
+BOOST_AUTO_TEST_CASE(structure_form)
+{
+  CHeaderScanner scanner;
+  VersionInfo    vi;
+
+  scanner.feed(structure, sizeof(structure) - 1);
+  scanner.finish();
+
+  BOOST_REQUIRE(scanner.done());
+  scanner.apply(vi);
+  BOOST_CHECK_EQUAL(vi.to_string(), "1.2.3.4");
+  BOOST_CHECK_EQUAL(vi.get_base_year(), 2009);
+}
+
+BOOST_AUTO_TEST_CASE(rejects)
+{
+  CHeaderScanner scanner;
+  VersionInfo    vi(7, 7, 7, 7, 2000, IncrementType::Simple);
+  const char     text[] = "{ 1, 2 }\n"
+                          "#define VERSION_MAJOR 99999999999\n"
+                          "#define VERSION_MINORITY 5\n"
+                          "#define VERSION_BUILD 12";
+
+  scanner.feed(text, sizeof(text) - 1);
+  BOOST_CHECK(!scanner.found());
+  scanner.finish();
+  BOOST_REQUIRE(scanner.found());
+  BOOST_CHECK(!scanner.done());
+
+  scanner.apply(vi);
+  BOOST_CHECK_EQUAL(vi.to_string(), "7.7.12.7");
+}
+
+BOOST_AUTO_TEST_CASE(spans)
+{
+  CHeaderScanner    scanner(true);
+  CHeaderSpanVector spans;
+  string            text(defines);
+
+  scanner.feed(text.data(), text.size());
+  scanner.finish();
+  scanner.get_spans(spans);
+
+  // DATE and TIME are absent, so every define but those is found.
+  BOOST_REQUIRE_EQUAL(spans.size(), 6);
+  BOOST_CHECK_EQUAL(spans[0].field, CHeaderMajor);
+  BOOST_CHECK_EQUAL(text.substr(spans[0].offset, spans[0].length), "3");
+  BOOST_CHECK_EQUAL(spans[2].field, CHeaderBuild);
+  BOOST_CHECK_EQUAL(text.substr(spans[2].offset, spans[2].length), "1592");
+  BOOST_CHECK_EQUAL(spans[5].field, CHeaderString);
+  BOOST_CHECK_EQUAL(text.substr(spans[5].offset, spans[5].length),
+                    "3.14.1592.6");
+
+  CHeaderScanner st(true);
+
+  text.assign(structure);
+  st.feed(text.data(), text.size());
+  st.finish();
+  BOOST_CHECK(!st.done());      // Another initialiser may follow.
+  st.get_spans(spans);
+
+  BOOST_REQUIRE_EQUAL(spans.size(), 5);
+  BOOST_CHECK_EQUAL(spans[0].field, CHeaderBaseYear);
+  BOOST_CHECK_EQUAL(text.substr(spans[0].offset, spans[0].length), "2009");
+  BOOST_CHECK_EQUAL(spans[4].field, CHeaderPatch);
+  BOOST_CHECK_EQUAL(text.substr(spans[4].offset, spans[4].length), "4");
+}
+
+BOOST_AUTO_TEST_CASE(repeated_initialisers)
+{
+  CHeaderScanner    scanner(true);
+  CHeaderSpanVector spans;
+  VersionInfo       vi;
+  string            text(structure);
+
+  text.append("inline constexpr Version_t Version = {\n"
+              "    2009, 1, 2, 3, 5\n"
+              "};\n");
+
+  scanner.feed(text.data(), text.size());
+  scanner.finish();
+  scanner.get_spans(spans);
+
+  BOOST_REQUIRE_EQUAL(spans.size(), 10);
+  BOOST_CHECK(spans[4].offset < spans[5].offset);
+  BOOST_CHECK_EQUAL(spans[9].field, CHeaderPatch);
+  BOOST_CHECK_EQUAL(text.substr(spans[9].offset, spans[9].length), "5");
+
+  // The first initialiser supplies the values.
+  scanner.apply(vi);
+  BOOST_CHECK_EQUAL(vi.to_string(), "1.2.3.4");
+}
+
+BOOST_AUTO_TEST_CASE(scan_limit)
+{
+  TempDir     tmp("scan");
+  fs::path    path = tmp / "scan_limit.h";
+  CTransform  transform;
+  VersionInfo vi;
+  Config      conf;
+
+  {
+    ofstream strm(path);
+
+    strm << string(8192, ' ') << defines;
+  }
+
+  conf.scan_limit = 4096;
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+
+  // Nothing is found before the limit, which is a failed read.
+  BOOST_CHECK(!transform.read(vi));
+  BOOST_CHECK_EQUAL(vi.get_build(), 0);
+
+  conf.scan_limit = 0;
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+
+  BOOST_REQUIRE(transform.read(vi));
+  BOOST_CHECK_EQUAL(vi.get_build(), 1592);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// CHeaderScanner_test.cpp ends here.
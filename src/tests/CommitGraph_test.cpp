@@ -0,0 +1,396 @@
+//
+// CommitGraph_test.cpp --- Commit-graph reader tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 01:04:22
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file CommitGraph_test.cpp
+ * @author Paul Ward
+ * @brief Commit-graph reader tests.
+ */
+
+#define BOOST_TEST_MODULE CommitGraph_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+#include "../verbuild/CommitGraph.hpp"
+#include "../verbuild/GitRepo.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+typedef vector<CommitPosVector> ParentTable;
+
+/*
+ * History used throughout, by position:
+ *
+ *   0 - 1 - 2 - 3 ------- 7 - 8
+ *        \   \           /
+ *         \   4 - 5 ----+
+ *          \            |
+ *           6 ----------+        (7 is an octopus of 3, 5 and 6)
+ */
+static
+ParentTable
+history()
+{
+  return {
+    {}, { 0 }, { 1 }, { 2 }, { 2 }, { 4 }, { 1 }, { 3, 5, 6 }, { 7 }
+  };
+}
+
+/*
+ * Object names that sort in position order but spread over the fanout.
+ */
+static
+string
+test_oid(uint32_t pos, uint32_t total)
+{
+  char buf[41];
+
+  snprintf(buf, sizeof(buf), "%02x%08x%030d",
+           static_cast<unsigned>(pos * 255 / total), pos, 0);
+
+  return buf;
+}
+
+static
+void
+be32(string &out, uint32_t val)
+{
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back(static_cast<char>((val >> shift) & 0xFF));
+  }
+}
+
+static
+void
+be64(string &out, uint64_t val)
+{
+  be32(out, static_cast<uint32_t>(val >> 32));
+  be32(out, static_cast<uint32_t>(val));
+}
+
+/*
+ * Write positions [first, last) of a history as one graph layer.
+ */
+static
+void
+write_graph(const fs::path    &path,
+            const ParentTable &table,
+            uint32_t           first,
+            uint32_t           last)
+{
+  uint32_t         total = static_cast<uint32_t>(table.size());
+  vector<uint32_t> gen(total, 0);
+  string           fanout;
+  string           oids;
+  string           data;
+  string           edges;
+  string           out("CGPH");
+  uint64_t         offset;
+
+  for (uint32_t i = 0; i < total; i++) {
+    for (uint32_t parent : table[i]) {
+      gen[i] = max(gen[i], gen[parent]);
+    }
+
+    gen[i]++;
+  }
+
+  for (uint32_t b = 0, pos = first; b < 256; b++) {
+    while (pos < last && static_cast<uint32_t>(stoul(
+             test_oid(pos, total).substr(0, 2), nullptr, 16)) <= b) {
+      pos++;
+    }
+
+    be32(fanout, pos - first);
+  }
+
+  for (uint32_t i = first; i < last; i++) {
+    const CommitPosVector &parents = table[i];
+    string                 oid(test_oid(i, total));
+
+    for (size_t c = 0; c < 40; c += 2) {
+      oids.push_back(static_cast<char>(stoul(oid.substr(c, 2), nullptr, 16)));
+    }
+
+    data.append(20, '\0');
+    be32(data, parents.empty() ? 0x70000000 : parents[0]);
+
+    if (parents.size() <= 2) {
+      be32(data, parents.size() < 2 ? 0x70000000 : parents[1]);
+    } else {
+      be32(data, 0x80000000 | static_cast<uint32_t>(edges.size() / 4));
+
+      for (size_t p = 1; p < parents.size(); p++) {
+        be32(edges, parents[p] |
+                    ((p + 1 == parents.size()) ? 0x80000000 : 0));
+      }
+    }
+
+    be32(data, gen[i] << 2);
+    be32(data, 1700000000 + i);
+  }
+
+  out.push_back(1);
+  out.push_back(1);
+  out.push_back(4);
+  out.push_back(first > 0 ? 1 : 0);
+
+  offset = 8 + 5 * 12;
+
+  for (auto chunk : { make_pair("OIDF", &fanout),
+                      make_pair("OIDL", &oids),
+                      make_pair("CDAT", &data),
+                      make_pair("EDGE", &edges) }) {
+    out.append(chunk.first, 4);
+    be64(out, offset);
+    offset += chunk.second->size();
+  }
+
+  out.append(4, '\0');
+  be64(out, offset);
+  out += fanout + oids + data + edges;
+
+  fs::create_directories(path.parent_path());
+  ofstream(path, ios::binary) << out;
+}
+
+struct GraphRepo
+{
+  TempDir  dir;
+  fs::path root;
+  fs::path git;
+  fs::path info;
+
+  GraphRepo()
+    : dir("graph"),
+      root(dir.path),
+      git(root / ".git"),
+      info(git / "objects" / "info")
+  {
+    fs::create_directories(git / "refs" / "heads");
+    ofstream(git / "HEAD") << "ref: refs/heads/main\n";
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(CommitGraph_test_suite)
+
+BOOST_AUTO_TEST_CASE(single_file)
+{
+  GraphRepo       repo;
+  ParentTable     table = history();
+  CommitGraph     graph;
+  CommitPosVector parents;
+  uint64_t        count;
+  uint32_t        pos;
+
+  BOOST_CHECK(!graph.open((repo.git / "objects").string()));
+
+  write_graph(repo.info / "commit-graph", table, 0, 9);
+  BOOST_REQUIRE(graph.open((repo.git / "objects").string()));
+  BOOST_CHECK_EQUAL(graph.get_count(), 9u);
+
+  for (uint32_t i = 0; i < 9; i++) {
+    BOOST_CHECK(graph.find(test_oid(i, 9), pos));
+    BOOST_CHECK_EQUAL(pos, i);
+  }
+
+  BOOST_CHECK(!graph.find(string(40, 'f'), pos));
+
+  BOOST_CHECK(graph.parents(7, parents));
+  BOOST_CHECK(parents == CommitPosVector({ 3, 5, 6 }));
+  BOOST_CHECK_EQUAL(graph.get_generation(8), 7u);
+
+  BOOST_CHECK(graph.count_reachable({ 8 }, count));
+  BOOST_CHECK_EQUAL(count, 9u);
+
+  BOOST_CHECK(graph.count_reachable({ 5 }, count));
+  BOOST_CHECK_EQUAL(count, 5u);
+
+  BOOST_CHECK(graph.count_reachable({ 5, 6, 4 }, count));
+  BOOST_CHECK_EQUAL(count, 6u);
+}
+
+BOOST_AUTO_TEST_CASE(split_chain)
+{
+  GraphRepo   repo;
+  ParentTable table = history();
+  CommitGraph graph;
+  uint64_t    count;
+  uint32_t    pos;
+
+  write_graph(repo.info / "commit-graphs" / "graph-base.graph", table, 0, 5);
+  write_graph(repo.info / "commit-graphs" / "graph-top.graph", table, 5, 9);
+  ofstream(repo.info / "commit-graphs" / "commit-graph-chain")
+    << "base\ntop\n";
+
+  BOOST_REQUIRE(graph.open((repo.git / "objects").string()));
+  BOOST_CHECK_EQUAL(graph.get_count(), 9u);
+
+  BOOST_CHECK(graph.find(test_oid(2, 9), pos));
+  BOOST_CHECK_EQUAL(pos, 2u);
+  BOOST_CHECK(graph.find(test_oid(7, 9), pos));
+  BOOST_CHECK_EQUAL(pos, 7u);
+
+  BOOST_CHECK(graph.count_reachable({ 8 }, count));
+  BOOST_CHECK_EQUAL(count, 9u);
+}
+
+BOOST_AUTO_TEST_CASE(corrupt)
+{
+  GraphRepo   repo;
+  ParentTable table = history();
+  CommitGraph graph;
+  uint64_t    count;
+
+  fs::create_directories(repo.info);
+  ofstream(repo.info / "commit-graph") << "CGPX";
+  BOOST_CHECK(!graph.open((repo.git / "objects").string()));
+
+  // A parent newer than its child: a cycle in a broken graph.
+  table[2] = { 8 };
+  write_graph(repo.info / "commit-graph", table, 0, 9);
+  BOOST_REQUIRE(graph.open((repo.git / "objects").string()));
+  BOOST_CHECK(!graph.count_reachable({ 8 }, count));
+}
+
+BOOST_AUTO_TEST_CASE(count_commits)
+{
+  GraphRepo repo;
+  GitRepo   git;
+  string    head(test_oid(8, 9));
+  uint64_t  count;
+
+  write_graph(repo.info / "commit-graph", history(), 0, 9);
+  ofstream(repo.git / "refs" / "heads" / "main") << head << "\n";
+
+  BOOST_REQUIRE(git.open(repo.root.string()));
+  BOOST_CHECK(git.count_commits(head, count));
+  BOOST_CHECK_EQUAL(count, 9u);
+  BOOST_CHECK(fs::exists(repo.git / GIT_COUNT_CACHE));
+
+  // Served from the cache even once the graph is gone.
+  fs::remove(repo.info / "commit-graph");
+
+  {
+    GitRepo again;
+
+    BOOST_REQUIRE(again.open(repo.root.string()));
+    BOOST_CHECK(again.count_commits(head, count));
+    BOOST_CHECK_EQUAL(count, 9u);
+    BOOST_CHECK(!again.count_commits(test_oid(5, 9), count));
+  }
+}
+
+#ifdef HAVE_ZLIB
+
+/*
+ * Store a loose commit object and return its (made up) name.
+ */
+static
+string
+write_loose(const fs::path &git, const string &name, const StringVector &parents)
+{
+  string  body("tree " + string(40, '0') + "\n");
+  string  object;
+  string  packed;
+  uLongf  size;
+
+  for (auto &it : parents) {
+    body += "parent " + it + "\n";
+  }
+
+  body  += "author A <a@b> 1700000000 +0000\n\nLoose.\n";
+  object = "commit " + to_string(body.size()) + string(1, '\0') + body;
+  size   = compressBound(object.size());
+
+  packed.resize(size);
+  compress(reinterpret_cast<Bytef *>(&packed[0]), &size,
+           reinterpret_cast<const Bytef *>(object.data()), object.size());
+  packed.resize(size);
+
+  fs::create_directories(git / "objects" / name.substr(0, 2));
+  ofstream(git / "objects" / name.substr(0, 2) / name.substr(2),
+           ios::binary) << packed;
+
+  return name;
+}
+
+BOOST_AUTO_TEST_CASE(loose_commits)
+{
+  GraphRepo    repo;
+  GitRepo      git;
+  StringVector parents;
+  uint64_t     count;
+  string       a(40, 'a');
+  string       b(40, 'b');
+  string       c(40, 'c');
+
+  write_graph(repo.info / "commit-graph", history(), 0, 9);
+
+  // a and b sit on graph commits; c merges them.
+  write_loose(repo.git, a, { test_oid(8, 9) });
+  write_loose(repo.git, b, { test_oid(5, 9) });
+  write_loose(repo.git, c, { a, b });
+
+  BOOST_REQUIRE(git.open(repo.root.string()));
+  BOOST_CHECK(git.read_commit(c, parents));
+  BOOST_CHECK(parents == StringVector({ a, b }));
+
+  BOOST_CHECK(git.count_commits(c, count));
+  BOOST_CHECK_EQUAL(count, 12u);
+
+  // One more on top is counted from the cached parent alone.
+  fs::remove(repo.info / "commit-graph");
+  write_loose(repo.git, string(40, 'd'), { c });
+
+  {
+    GitRepo again;
+
+    BOOST_REQUIRE(again.open(repo.root.string()));
+    BOOST_CHECK(again.count_commits(string(40, 'd'), count));
+    BOOST_CHECK_EQUAL(count, 13u);
+  }
+}
+
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// CommitGraph_test.cpp ends here.
@@ -0,0 +1,165 @@
+//
+// ElfObject_test.cpp --- ELF object writer tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 19:02:17
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file ElfObject_test.cpp
+ * @author Paul Ward
+ * @brief ELF object writer tests.
+ */
+
+#define BOOST_TEST_MODULE ElfObject_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "../verbuild/ElfObject.hpp"
+#include "../verbuild/Transform_ELF.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(ElfObject_test_suite)
+
+BOOST_AUTO_TEST_CASE(layout)
+{
+  for (ElfMachine machine : { ElfMachine::X86_64, ElfMachine::AArch64 }) {
+    ElfObject  obj(machine);
+    ElfMachine found = ElfMachine::X86_64;
+    string     image;
+    string     desc;
+
+    obj.add_string("name", "value");
+    obj.add_note("test", 7, "abcde", 5);
+    obj.add_note("verbuild", 1, "12345678", 8);
+    image = obj.to_string();
+
+    BOOST_CHECK_EQUAL(image.compare(0, 4, "\x7f" "ELF"), 0);
+    BOOST_REQUIRE(elf_get_machine(image, found));
+    BOOST_CHECK(found == machine);
+
+    BOOST_REQUIRE(elf_find_note(image, "test", 7, desc));
+    BOOST_CHECK_EQUAL(desc, "abcde");
+    BOOST_REQUIRE(elf_find_note(image, "verbuild", 1, desc));
+    BOOST_CHECK_EQUAL(desc, "12345678");
+    BOOST_CHECK(!elf_find_note(image, "verbuild", 2, desc));
+    BOOST_CHECK(image.find(string("value\0", 6)) != string::npos);
+
+    // Truncated files are rejected rather than read past the end.
+    for (size_t len = 0; len < image.size(); len += 7) {
+      BOOST_CHECK(!elf_find_note(image.substr(0, len), "test", 7, desc));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  TempDir               dir("elf");
+  fs::path              file = dir / "rt.o";
+  unique_ptr<Transform> transform(GET_TRANSFORM_CREATE(ELF_AARCH64_KEY));
+  VersionInfo           vi(4, 3, 2109, 7, 2012, IncrementType::Simple);
+  VersionInfo           back;
+  Config                conf;
+  ElfMachine            machine = ElfMachine::X86_64;
+  string                image;
+
+  BOOST_REQUIRE(transform);
+  transform->set_config(conf);
+  transform->set_filename(file.string());
+
+  BOOST_REQUIRE(transform->write(vi));
+  BOOST_REQUIRE(transform->read(back));
+  BOOST_CHECK(back == vi);
+  BOOST_CHECK_EQUAL(back.get_base_year(), 2012);
+
+  {
+    ifstream strm(file, ios::binary);
+
+    image.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+  }
+
+  BOOST_REQUIRE(elf_get_machine(image, machine));
+  BOOST_CHECK(machine == ElfMachine::AArch64);
+}
+
+/*
+ * Link the host object into a C program with the system toolchain and
+ * check the symbols from there.
+ */
+BOOST_AUTO_TEST_CASE(links)
+{
+#if PLATFORM_EQ(PLATFORM_LINUX) &&                                      \
+    (defined(__x86_64__) || defined(__aarch64__))
+  TempDir               tmp("elf");
+  const fs::path       &dir = tmp.path;
+  unique_ptr<Transform> transform(GET_TRANSFORM_CREATE(ELF_KEY));
+  VersionInfo           vi(4, 3, 2109, 7, 2012, IncrementType::Simple);
+  Config                conf;
+  string                cmd;
+
+  ofstream(dir / "main.c")
+    << "#include <string.h>\n"
+    << "extern const unsigned int t_VersionNumber[5];\n"
+    << "extern const char t_VersionString[];\n"
+    << "extern const char t_VersionTime[];\n"
+    << "int main(void) {\n"
+    << "  if (t_VersionNumber[0] != 2012 || t_VersionNumber[1] != 4 ||\n"
+    << "      t_VersionNumber[3] != 2109 || t_VersionNumber[4] != 7)\n"
+    << "    return 1;\n"
+    << "  if (strcmp(t_VersionString, \"4.3.2109.7\") != 0)\n"
+    << "    return 2;\n"
+    << "  return strlen(t_VersionTime) == 8 ? 0 : 3;\n"
+    << "}\n";
+
+  conf.prefix = "t_";
+  transform->set_config(conf);
+  transform->set_filename((dir / "version.o").string());
+  BOOST_REQUIRE(transform->write(vi));
+
+  // Linker warnings, such as for a missing stack note, are failures.
+  cmd = string(TEST_C_COMPILER)
+      + " -Wl,--fatal-warnings -o " + (dir / "prog").string()
+      + " " + (dir / "main.c").string()
+      + " " + (dir / "version.o").string();
+
+  BOOST_REQUIRE_EQUAL(system(cmd.c_str()), 0);
+  BOOST_CHECK_EQUAL(system((dir / "prog").string().c_str()), 0);
+#else
+  BOOST_TEST_MESSAGE("Not linking: host is not x86-64 or AArch64 Linux.");
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ElfObject_test.cpp ends here.
@@ -70,6 +70,10 @@ BOOST_AUTO_TEST_CASE(OutputMode_ostream)
   ss << test;
 
   BOOST_CHECK_EQUAL(ss.str(), "doxygen");
+
+  ss.str("");
+  ss << (OutputGroups::Struct | OutputGroups::Cxx17);
+  BOOST_CHECK_EQUAL(ss.str(), "struct, cxx17");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+//
+// FileEditor_test.cpp --- In-place file editing tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 19:27:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file FileEditor_test.cpp
+ * @author Paul Ward
+ * @brief In-place file editing tests.
+ */
+
+#define BOOST_TEST_MODULE FileEditor_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "../verbuild/FileEditor.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+string
+slurp(const fs::path &path)
+{
+  ifstream strm(path, ios::binary);
+
+  return string(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+}
+
+static
+string
+make_body(size_t len)
+{
+  string body(len, '\0');
+
+  for (size_t i = 0; i < len; i++) {
+    body[i] = static_cast<char>('a' + (i * 7) % 26);
+  }
+
+  return body;
+}
+
+BOOST_AUTO_TEST_SUITE(FileEditor_test_suite)
+
+BOOST_AUTO_TEST_CASE(same_width)
+{
+  TempDir        tmp("edit");
+  fs::path       path = tmp / "edit_same";
+  string         body = make_body(3 * FILE_EDIT_CHUNK);
+  FileEditor     editor;
+  FileEditVector edits = {
+    { 10, 3, "XYZ" },
+    { 2,  2, string(body, 2, 2) },
+    { 40, 1, "Q" }
+  };
+
+  ofstream(path, ios::binary) << body;
+
+  BOOST_REQUIRE(editor.open(path.string()));
+  BOOST_REQUIRE(editor.apply(edits));
+  BOOST_CHECK_EQUAL(editor.get_written(), 4);
+
+  body.replace(10, 3, "XYZ");
+  body.replace(40, 1, "Q");
+  editor.close();
+
+  BOOST_CHECK(slurp(path) == body);
+}
+
+BOOST_AUTO_TEST_CASE(grow_and_shrink)
+{
+  TempDir  tmp("edit");
+  fs::path path = tmp / "edit_size";
+  string   body = make_body(3 * FILE_EDIT_CHUNK + 17);
+
+  ofstream(path, ios::binary) << body;
+
+  {
+    FileEditor     editor;
+    FileEditVector edits = { { 5, 1, "same" }, { 100, 2, "1234" } };
+
+    BOOST_REQUIRE(editor.open(path.string()));
+    BOOST_REQUIRE(editor.apply(edits));
+    BOOST_CHECK_EQUAL(editor.get_size(), body.size() + 5);
+  }
+
+  body.replace(100, 2, "1234");
+  body.replace(5, 1, "same");
+  BOOST_CHECK(slurp(path) == body);
+
+  {
+    FileEditor     editor;
+    FileEditVector edits = { { 7, 5, "" }, { 200, 10, "x" } };
+
+    BOOST_REQUIRE(editor.open(path.string()));
+    BOOST_REQUIRE(editor.apply(edits));
+  }
+
+  body.replace(200, 10, "x");
+  body.replace(7, 5, "");
+  BOOST_CHECK(slurp(path) == body);
+}
+
+BOOST_AUTO_TEST_CASE(rejects_overlap)
+{
+  TempDir        tmp("edit");
+  fs::path       path = tmp / "edit_bad";
+  FileEditor     editor;
+  FileEditVector overlap = { { 1, 4, "a" }, { 3, 1, "b" } };
+  FileEditVector past    = { { 8, 4, "a" } };
+
+  ofstream(path, ios::binary) << "0123456789";
+
+  BOOST_REQUIRE(editor.open(path.string()));
+  BOOST_CHECK(!editor.apply(overlap));
+  BOOST_CHECK(!editor.apply(past));
+  editor.close();
+
+  BOOST_CHECK_EQUAL(slurp(path), "0123456789");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// FileEditor_test.cpp ends here.
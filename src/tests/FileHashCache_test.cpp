@@ -0,0 +1,146 @@
+//
+// FileHashCache_test.cpp --- File hash cache tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 04:31:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file FileHashCache_test.cpp
+ * @author Paul Ward
+ * @brief File hash cache tests.
+ */
+
+#define BOOST_TEST_MODULE FileHashCache_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../verbuild/FileHashCache.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#define SECOND 1000000000LL
+
+struct CacheFile
+{
+  TempDir dir;
+  string  path;
+
+  CacheFile()
+    : dir("hashes"),
+      path((dir / "hashes.cache").string())
+  {}
+};
+
+static
+FileHashEntry
+entry(const string &path, int64_t mtime, uint64_t hash)
+{
+  return { path, { 1, 100 + hash, mtime, 10 * hash }, hash };
+}
+
+BOOST_AUTO_TEST_SUITE(FileHashCache_test_suite)
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  CacheFile           file;
+  FileHashCache       cache;
+  FileHashEntryVector entries = { entry("src/b.c", 50 * SECOND, 2),
+                                  entry("src/a.c", 50 * SECOND, 1),
+                                  entry("README", 99 * SECOND, 3) };
+  uint64_t            hash = 0;
+
+  BOOST_CHECK(!cache.load(file.path));
+  BOOST_CHECK(!cache.lookup("src/a.c", entries[1].stat, hash));
+
+  // README is too close to the scan to be trusted.
+  cache.replace(entries);
+  BOOST_REQUIRE(cache.save(file.path, 100 * SECOND));
+  BOOST_REQUIRE(cache.load(file.path));
+  BOOST_CHECK_EQUAL(cache.size(), 2u);
+
+  BOOST_CHECK(cache.lookup("src/a.c", entry("src/a.c", 50 * SECOND, 1).stat,
+                           hash));
+  BOOST_CHECK_EQUAL(hash, 1u);
+  BOOST_CHECK(cache.lookup("src/b.c", entry("src/b.c", 50 * SECOND, 2).stat,
+                           hash));
+  BOOST_CHECK_EQUAL(hash, 2u);
+  BOOST_CHECK(!cache.lookup("README", entry("README", 99 * SECOND, 3).stat,
+                            hash));
+  BOOST_CHECK(!cache.lookup("src/c.c", entry("src/c.c", 50 * SECOND, 1).stat,
+                            hash));
+}
+
+BOOST_AUTO_TEST_CASE(changed)
+{
+  CacheFile           file;
+  FileHashCache       cache;
+  FileHashEntryVector entries = { entry("a", SECOND, 1) };
+  FileStat            stat    = entries[0].stat;
+  uint64_t            hash;
+
+  cache.replace(entries);
+  BOOST_REQUIRE(cache.save(file.path, 100 * SECOND));
+  BOOST_REQUIRE(cache.load(file.path));
+  BOOST_CHECK(cache.lookup("a", stat, hash));
+
+  FileStat moved(stat);
+  moved.mtime++;
+  BOOST_CHECK(!cache.lookup("a", moved, hash));
+
+  FileStat grown(stat);
+  grown.size++;
+  BOOST_CHECK(!cache.lookup("a", grown, hash));
+
+  FileStat replaced(stat);
+  replaced.ino++;
+  BOOST_CHECK(!cache.lookup("a", replaced, hash));
+}
+
+BOOST_AUTO_TEST_CASE(corrupt)
+{
+  CacheFile           file;
+  FileHashCache       cache;
+  FileHashEntryVector entries = { entry("a", SECOND, 1),
+                                  entry("b", SECOND, 2) };
+
+  cache.replace(entries);
+  BOOST_REQUIRE(cache.save(file.path, 100 * SECOND));
+  fs::resize_file(file.path, fs::file_size(file.path) - 1);
+  BOOST_CHECK(!cache.load(file.path));
+  BOOST_CHECK_EQUAL(cache.size(), 0u);
+
+  ofstream(file.path, ios::binary) << "VBHC garbage";
+  BOOST_CHECK(!cache.load(file.path));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// FileHashCache_test.cpp ends here.
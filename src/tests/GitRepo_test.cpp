@@ -0,0 +1,298 @@
+//
+// GitRepo_test.cpp --- Git repository reader tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 23:56:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file GitRepo_test.cpp
+ * @author Paul Ward
+ * @brief Git repository reader tests.
+ */
+
+#define BOOST_TEST_MODULE GitRepo_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "../verbuild/GitRepo.hpp"
+#include "../verbuild/GitPolicy.hpp"
+#include "../verbuild/VersionInfo.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#define OID_HEAD   "0123456789abcdef0123456789abcdef01234567"
+#define OID_TAG1   "1111111111111111111111111111111111111111"
+#define OID_TAG2   "2222222222222222222222222222222222222222"
+#define OID_LOOSE  "3333333333333333333333333333333333333333"
+
+/*
+ * A repository laid out by hand, with HEAD on a loose branch and tags
+ * split between packed-refs and loose files.
+ */
+struct FakeRepo
+{
+  TempDir  dir;
+  fs::path root;
+  fs::path git;
+
+  FakeRepo()
+    : dir("git"),
+      root(dir.path),
+      git(root / ".git")
+  {
+    fs::create_directories(git / "refs" / "heads");
+    fs::create_directories(git / "refs" / "tags");
+    fs::create_directories(root / "src");
+
+    put(git / "HEAD", "ref: refs/heads/main\n");
+    put(git / "refs" / "heads" / "main", OID_HEAD "\n");
+    put(git / "packed-refs",
+        "# pack-refs with: peeled fully-peeled sorted \n"
+        OID_TAG1 " refs/tags/v1.4\n"
+        "^" OID_HEAD "\n"
+        OID_TAG2 " refs/tags/v2.1.7\n"
+        OID_TAG1 " refs/tags/nightly\n");
+    put(git / "refs" / "tags" / "v2.1.7", OID_LOOSE "\n");
+  }
+
+  static void put(const fs::path &path, const string &text)
+  {
+    ofstream(path, ios::binary) << text;
+  }
+};
+
+static
+void
+be32(string &out, uint32_t val)
+{
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back(static_cast<char>((val >> shift) & 0xFF));
+  }
+}
+
+/*
+ * Write an index recording the current stat data of some work tree
+ * files, in version 2 (padded) or version 4 (prefix-compressed) form.
+ */
+static
+void
+write_index(const FakeRepo &repo, const vector<string> &paths, uint32_t version)
+{
+  string out("DIRC");
+  string prev;
+
+  be32(out, version);
+  be32(out, static_cast<uint32_t>(paths.size()));
+
+  for (auto &it : paths) {
+    struct stat st;
+    size_t      start = out.size();
+
+    BOOST_REQUIRE(::lstat((repo.root / it).c_str(), &st) == 0);
+
+    be32(out, static_cast<uint32_t>(st.st_ctime));
+    be32(out, 0);
+    be32(out, static_cast<uint32_t>(st.st_mtime));
+    be32(out, 0);
+    be32(out, static_cast<uint32_t>(st.st_dev));
+    be32(out, static_cast<uint32_t>(st.st_ino));
+    be32(out, 0100644);
+    be32(out, st.st_uid);
+    be32(out, st.st_gid);
+    be32(out, static_cast<uint32_t>(st.st_size));
+    out.append(20, '\x5a');
+    out.push_back(0);
+    out.push_back(static_cast<char>(it.length()));
+
+    if (version == 4) {
+      size_t common = 0;
+
+      while (common < prev.length() && common < it.length() &&
+             prev[common] == it[common]) {
+        common++;
+      }
+
+      out.push_back(static_cast<char>(prev.length() - common));
+      out.append(it.substr(common));
+      out.push_back(0);
+      prev = it;
+    } else {
+      out.append(it);
+
+      do {
+        out.push_back(0);
+      } while ((out.size() - start) % 8 != 0);
+    }
+  }
+
+  FakeRepo::put(repo.git / "index", out);
+}
+
+BOOST_AUTO_TEST_SUITE(GitRepo_test_suite)
+
+BOOST_AUTO_TEST_CASE(open_and_resolve)
+{
+  FakeRepo repo;
+  GitRepo  git;
+  string   oid;
+
+  BOOST_REQUIRE(git.open((repo.root / "src").string()));
+  BOOST_CHECK_EQUAL(fs::path(git.get_git_dir()), repo.git);
+  BOOST_CHECK_EQUAL(fs::path(git.get_work_tree()), repo.root);
+
+  BOOST_CHECK(git.resolve("HEAD", oid));
+  BOOST_CHECK_EQUAL(oid, OID_HEAD);
+
+  BOOST_CHECK(git.resolve("refs/tags/v1.4", oid));
+  BOOST_CHECK_EQUAL(oid, OID_TAG1);
+
+  // The loose copy shadows the packed one.
+  BOOST_CHECK(git.resolve("refs/tags/v2.1.7", oid));
+  BOOST_CHECK_EQUAL(oid, OID_LOOSE);
+
+  BOOST_CHECK(!git.resolve("refs/heads/missing", oid));
+
+  // An unborn branch has no commit.
+  FakeRepo::put(repo.git / "HEAD", "ref: refs/heads/unborn\n");
+  BOOST_CHECK(!git.resolve("HEAD", oid));
+
+  // Detached.
+  FakeRepo::put(repo.git / "HEAD", OID_TAG2 "\n");
+  BOOST_CHECK(git.resolve("HEAD", oid));
+  BOOST_CHECK_EQUAL(oid, OID_TAG2);
+}
+
+BOOST_AUTO_TEST_CASE(packed_refs_reloaded)
+{
+  FakeRepo     repo;
+  GitRepo      git;
+  GitRefVector tags;
+  fs::path     tmp(repo.git / "packed-refs.new");
+
+  BOOST_REQUIRE(git.open(repo.root.string()));
+
+  git.list_refs("refs/tags/", tags);
+  BOOST_REQUIRE_EQUAL(tags.size(), 3u);
+  BOOST_CHECK_EQUAL(tags[0].name, "refs/tags/nightly");
+  BOOST_CHECK_EQUAL(tags[2].name, "refs/tags/v2.1.7");
+  BOOST_CHECK_EQUAL(tags[2].oid, OID_LOOSE);
+
+  // Replaced the way git does it, so the inode changes.
+  FakeRepo::put(tmp, OID_TAG1 " refs/tags/v3.0\n");
+  fs::rename(tmp, repo.git / "packed-refs");
+
+  git.list_refs("refs/tags/", tags);
+  BOOST_REQUIRE_EQUAL(tags.size(), 2u);
+  BOOST_CHECK_EQUAL(tags[0].name, "refs/tags/v2.1.7");
+  BOOST_CHECK_EQUAL(tags[1].name, "refs/tags/v3.0");
+}
+
+BOOST_AUTO_TEST_CASE(dirty)
+{
+  FakeRepo repo;
+  GitRepo  git;
+
+  FakeRepo::put(repo.root / "README", "hello\n");
+  FakeRepo::put(repo.root / "src" / "a.c", "int a;\n");
+  FakeRepo::put(repo.root / "src" / "ab.c", "int ab;\n");
+
+  BOOST_REQUIRE(git.open(repo.root.string()));
+
+  // No index, nothing tracked.
+  BOOST_CHECK(!git.is_dirty());
+
+  for (uint32_t version : { 2u, 4u }) {
+    write_index(repo, { "README", "src/a.c", "src/ab.c" }, version);
+    BOOST_CHECK(!git.is_dirty());
+
+    // Untracked files do not count.
+    FakeRepo::put(repo.root / "src" / "new.c", "int n;\n");
+    BOOST_CHECK(!git.is_dirty());
+
+    FakeRepo::put(repo.root / "src" / "ab.c",
+                  "int ab" + string(version, 'c') + ";\n");
+    BOOST_CHECK(git.is_dirty());
+
+    write_index(repo, { "README", "src/a.c", "src/ab.c" }, version);
+    fs::remove(repo.root / "README");
+    BOOST_CHECK(git.is_dirty());
+
+    FakeRepo::put(repo.root / "README", "hello\n");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(parse_tag)
+{
+  uint32_t major = 0;
+  uint32_t minor = 0;
+
+  BOOST_CHECK(GitPolicy::parse_tag("v1.2", major, minor));
+  BOOST_CHECK_EQUAL(major, 1u);
+  BOOST_CHECK_EQUAL(minor, 2u);
+
+  BOOST_CHECK(GitPolicy::parse_tag("release-10.20.3-rc1", major, minor));
+  BOOST_CHECK_EQUAL(major, 10u);
+  BOOST_CHECK_EQUAL(minor, 20u);
+
+  BOOST_CHECK(!GitPolicy::parse_tag("nightly", major, minor));
+  BOOST_CHECK(!GitPolicy::parse_tag("v3", major, minor));
+  BOOST_CHECK(!GitPolicy::parse_tag("v99999999999.1", major, minor));
+}
+
+BOOST_AUTO_TEST_CASE(policy)
+{
+  FakeRepo    repo;
+  GitPolicy   policy;
+  VersionInfo vi(2, 1, 5, 0, 0, IncrementType::GitTag);
+
+  BOOST_REQUIRE(policy.open(repo.root.string()));
+  vi.set_increment_policy(&policy);
+
+  // Same tag: count up.
+  vi.increment(IncrementMode::Build);
+  BOOST_CHECK_EQUAL(vi.to_string(), "2.1.6.0");
+
+  // A newer tag resets the build number.
+  FakeRepo::put(repo.git / "refs" / "tags" / "v2.2", OID_HEAD "\n");
+  vi.increment(IncrementMode::Build);
+  BOOST_CHECK_EQUAL(vi.to_string(), "2.2.0.0");
+
+  vi.set_increment_type(IncrementType::GitSha);
+  vi.increment(IncrementMode::Build);
+  BOOST_CHECK_EQUAL(vi.get_build(), 0x0123456u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// GitRepo_test.cpp ends here.
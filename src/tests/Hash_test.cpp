@@ -0,0 +1,99 @@
+//
+// Hash_test.cpp --- Hashing tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 02:52:13
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Hash_test.cpp
+ * @author Paul Ward
+ * @brief Hashing tests.
+ */
+
+#define BOOST_TEST_MODULE Hash_test
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include "../verbuild/Hash.hpp"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(Hash_test_suite)
+
+BOOST_AUTO_TEST_CASE(known_values)
+{
+  string quote("Nobody inspects the spammish repetition");
+
+  BOOST_CHECK_EQUAL(hash_bytes("", 0), 0xEF46DB3751D8E999ULL);
+  BOOST_CHECK_EQUAL(hash_bytes("a", 1), 0xD24EC4F1A98C6E5BULL);
+  BOOST_CHECK_EQUAL(hash_bytes("abc", 3), 0x44BC2CF5AD770999ULL);
+  BOOST_CHECK_EQUAL(hash_bytes(quote.data(), quote.size()),
+                    0xFBCEA83C8A378BF1ULL);
+}
+
+BOOST_AUTO_TEST_CASE(streaming)
+{
+  string   data;
+  uint64_t whole;
+
+  for (int i = 0; i < 1000; i++) {
+    data.push_back(static_cast<char>(i * 7 + i / 13));
+  }
+
+  whole = hash_bytes(data.data(), data.size(), 42);
+
+  // Any split of the input gives the same digest.
+  for (size_t step : { 1, 3, 31, 32, 33, 100 }) {
+    Hasher hasher(42);
+
+    for (size_t pos = 0; pos < data.size(); pos += step) {
+      hasher.update(data.data() + pos, min(step, data.size() - pos));
+    }
+
+    BOOST_CHECK_EQUAL(hasher.digest(), whole);
+  }
+
+  BOOST_CHECK_NE(hash_bytes(data.data(), data.size()), whole);
+}
+
+BOOST_AUTO_TEST_CASE(hex)
+{
+  uint64_t hash;
+
+  BOOST_CHECK_EQUAL(hash_to_hex(0xEF46DB3751D8E999ULL), "ef46db3751d8e999");
+  BOOST_CHECK_EQUAL(hash_to_hex(1), "0000000000000001");
+
+  BOOST_CHECK(hash_from_hex("ef46db3751d8e999", hash));
+  BOOST_CHECK_EQUAL(hash, 0xEF46DB3751D8E999ULL);
+
+  BOOST_CHECK(!hash_from_hex("ef46db3751d8e99", hash));
+  BOOST_CHECK(!hash_from_hex("ef46db3751d8e99g", hash));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Hash_test.cpp ends here.
@@ -0,0 +1,227 @@
+//
+// HistoryArchive_test.cpp --- History archive tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 10:02:44
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file HistoryArchive_test.cpp
+ * @author Paul Ward
+ * @brief History archive tests.
+ */
+
+#define BOOST_TEST_MODULE HistoryArchive_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <string>
+
+#include "../verbuild/HistoryArchive.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/*
+ * Three components: `daily' builds regularly, `release' bumps its
+ * major now and then, and `odd' jumps about.
+ */
+static
+HistoryEntryVector
+make_history(size_t count)
+{
+  HistoryEntryVector entries;
+  HistoryVersion     daily   = { 1, 0, 0, 0 };
+  HistoryVersion     release = { 1, 4, 100, 0 };
+  uint32_t           seed    = 12345;
+
+  for (size_t i = 0; i < count; i++) {
+    HistoryEntry entry;
+
+    seed       = seed * 1103515245 + 12345;
+    entry.time = 1700000000 + static_cast<int64_t>(i) * 60;
+    entry.type = IncrementType::Simple;
+
+    switch (i % 3) {
+      case 0:
+        entry.component = "daily";
+        entry.before    = daily;
+        daily.build++;
+        entry.after     = daily;
+        break;
+
+      case 1:
+        entry.component = "release";
+        entry.type      = IncrementType::GitCount;
+        entry.before    = release;
+
+        if (i % 301 == 1) {
+          release = { release.major + 1, 0, 0, 0 };
+        } else {
+          release.build += 1 + seed % 4;
+        }
+
+        entry.after = release;
+        break;
+
+      default:
+        entry.component = "odd";
+        entry.time     += seed % 7;
+        entry.type      = IncrementType::GitSha;
+        entry.before    = { seed, 0, UINT32_MAX, 1 };
+        entry.after     = { 0, seed % 3, seed, 0 };
+        break;
+    }
+
+    entries.push_back(entry);
+  }
+
+  return entries;
+}
+
+static
+bool
+same(const HistoryEntry &lhs, const HistoryEntry &rhs)
+{
+  return lhs.time == rhs.time && lhs.type == rhs.type &&
+         lhs.before == rhs.before && lhs.after == rhs.after &&
+         lhs.component == rhs.component;
+}
+
+BOOST_AUTO_TEST_SUITE(HistoryArchive_test_suite)
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  HistoryEntryVector entries = make_history(5000);
+  HistoryEntryVector decoded;
+  HistoryArchive     archive;
+  string             data;
+
+  HistoryArchive::encode(entries, data);
+  BOOST_REQUIRE(archive.parse(data));
+  BOOST_CHECK_EQUAL(archive.get_record_count(), 5000u);
+  BOOST_REQUIRE_EQUAL(archive.get_series().size(), 3u);
+  BOOST_CHECK_EQUAL(archive.get_series()[0].component, "daily");
+  BOOST_CHECK_EQUAL(archive.get_series()[0].blocks, 2u);
+
+  BOOST_REQUIRE(archive.decode(decoded));
+  BOOST_REQUIRE_EQUAL(decoded.size(), entries.size());
+
+  for (size_t i = 0; i < entries.size(); i++) {
+    BOOST_REQUIRE_MESSAGE(same(decoded[i], entries[i]), "record " << i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(compact)
+{
+  HistoryEntryVector entries;
+  HistoryArchive     archive;
+  ArchiveColumns     cols;
+  string             data;
+
+  for (uint32_t i = 0; i < 3000; i++) {
+    entries.push_back({ 1700000000 + i * 86400,
+                        IncrementType::Simple,
+                        { 2, 1, i, 0 },
+                        { 2, 1, i + 1, 0 },
+                        "lib/version.h" });
+  }
+
+  HistoryArchive::encode(entries, data);
+
+  // A byte for each column, and a bit to link `before'.
+  BOOST_CHECK_LT(data.size(), 3000u * 7);
+
+  BOOST_REQUIRE(archive.parse(data));
+  BOOST_REQUIRE(archive.decode_block(2, cols));
+  BOOST_REQUIRE_EQUAL(cols.size(), 3000u - 2 * ARCHIVE_BLOCK_SIZE);
+  BOOST_CHECK_EQUAL(cols.time[0], 1700000000 + 2048 * 86400);
+  BOOST_CHECK(cols.before[0] == (HistoryVersion { 2, 1, 2048, 0 }));
+  BOOST_CHECK(cols.after.back() == (HistoryVersion { 2, 1, 3000, 0 }));
+}
+
+BOOST_AUTO_TEST_CASE(damaged)
+{
+  HistoryArchive archive;
+  string         data;
+
+  HistoryArchive::encode(make_history(100), data);
+
+  BOOST_CHECK(!archive.parse(data.substr(0, data.size() - 1)));
+  BOOST_CHECK(!archive.parse(data + "x"));
+  BOOST_CHECK(!archive.parse("VBHJ"));
+
+  // A block that decodes to more or less than its size.
+  data[data.size() - 1] = static_cast<char>(0x80);
+  BOOST_CHECK(archive.parse(data));
+
+  HistoryEntryVector decoded;
+  BOOST_CHECK(!archive.decode(decoded));
+
+  // One record of all zeroes, spelt out by hand.  Its `before' may be
+  // given, but cannot be linked, as there is no record before it.
+  string header(data.substr(0, 8) + string("\x01\0\0\0\0\0\0\0", 8));
+  string series("\x05" "daily" "\x01" "\x01", 8);
+  string zeroes(6, '\0');
+
+  BOOST_REQUIRE(archive.parse(header + series + "\x01\x0b" + zeroes +
+                              string(1, '\0') + string(4, '\0')));
+  BOOST_REQUIRE(archive.decode(decoded));
+  BOOST_REQUIRE_EQUAL(decoded.size(), 1u);
+  BOOST_CHECK(decoded[0].before == (HistoryVersion { 0, 0, 0, 0 }));
+
+  BOOST_REQUIRE(archive.parse(header + series + "\x01\x07" + zeroes +
+                              "\x01"));
+  BOOST_CHECK(!archive.decode(decoded));
+}
+
+BOOST_AUTO_TEST_CASE(import)
+{
+  TempDir            tmp("archive");
+  string             path((tmp / "history").string());
+  HistoryEntryVector entries = make_history(300);
+  HistoryEntryVector first(entries.begin() + 100, entries.end());
+  HistoryEntryVector listed;
+  History            history(path);
+  size_t             added;
+
+  // Records older than those already there go in their place.
+  BOOST_REQUIRE(history.merge(first, added));
+  BOOST_CHECK_EQUAL(added, 200u);
+  BOOST_REQUIRE(history.merge(entries, added));
+  BOOST_CHECK_EQUAL(added, 100u);
+
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", listed));
+  BOOST_REQUIRE_EQUAL(listed.size(), 300u);
+
+  for (size_t i = 1; i < listed.size(); i++) {
+    BOOST_CHECK(listed[i - 1].time <= listed[i].time);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// HistoryArchive_test.cpp ends here.
@@ -0,0 +1,242 @@
+//
+// History_test.cpp --- Increment history tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 07:58:30
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file History_test.cpp
+ * @author Paul Ward
+ * @brief Increment history tests.
+ */
+
+#define BOOST_TEST_MODULE History_test
+#include <boost/test/unit_test.hpp>
+
+#include <climits>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../verbuild/History.hpp"
+#include "../verbuild/VersionInfo.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+struct Journal
+{
+  TempDir dir;
+  string  path;
+
+  Journal()
+    : dir("history"),
+      path((dir / "history").string())
+  {}
+
+  /*
+   * Component `a' builds at even times and `b' at odd ones, each
+   * build number being the time.
+   */
+  void fill(History &history, int count)
+  {
+    HistoryEntryVector entries;
+
+    for (int i = 1; i <= count; i++) {
+      HistoryEntry entry;
+
+      entry.time      = 1000 + i;
+      entry.type      = IncrementType::Simple;
+      entry.component = (i % 2 == 0) ? "a" : "b";
+      entry.before    = { 1, 0, static_cast<uint32_t>(i - 2), 0 };
+      entry.after     = { 1, 0, static_cast<uint32_t>(i), 0 };
+      entries.push_back(entry);
+    }
+
+    BOOST_REQUIRE(history.append(entries));
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(History_test_suite)
+
+BOOST_AUTO_TEST_CASE(query)
+{
+  Journal            journal;
+  History            history(journal.path, "", 256);
+  HistoryEntryVector entries;
+
+  BOOST_CHECK(!history.list(INT64_MIN, INT64_MAX, "", entries));
+
+  // Several appends, spread over many index stretches.
+  journal.fill(history, 100);
+  journal.fill(history, 0);
+  BOOST_CHECK(fs::file_size(journal.path + HISTORY_INDEX_SUFFIX) > 16 * 8);
+
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", entries));
+  BOOST_CHECK_EQUAL(entries.size(), 100u);
+
+  BOOST_REQUIRE(history.list(1050, 1059, "a", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 5u);
+  BOOST_CHECK_EQUAL(entries.front().time, 1050);
+  BOOST_CHECK_EQUAL(entries.back().after.build, 58u);
+
+  BOOST_REQUIRE(history.at(1077, "a", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 1u);
+  BOOST_CHECK_EQUAL(entries[0].after.build, 1076u - 1000u);
+
+  BOOST_REQUIRE(history.at(1077, "", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 2u);
+  BOOST_CHECK_EQUAL(entries[0].component, "a");
+  BOOST_CHECK_EQUAL(entries[1].after.build, 77u);
+
+  BOOST_REQUIRE(history.at(1000, "a", entries));
+  BOOST_CHECK(entries.empty());
+  BOOST_REQUIRE(history.at(5000, "c", entries));
+  BOOST_CHECK(entries.empty());
+}
+
+BOOST_AUTO_TEST_CASE(record)
+{
+  Journal            journal;
+  History            history(journal.path, "lib/version.h");
+  HistoryEntryVector entries;
+  VersionInfo        vi(1, 2, 3, 0, 0, IncrementType::Simple);
+
+  BOOST_REQUIRE(history.record(HistoryVersion { 1, 2, 3, 0 },
+                               VersionInfo(1, 2, 4, 0, 0,
+                                           IncrementType::Simple)));
+  vi.set_build(5);
+  BOOST_REQUIRE(history.record(HistoryVersion { 1, 2, 4, 0 }, vi));
+
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 2u);
+  BOOST_CHECK_EQUAL(entries[0].component, "lib/version.h");
+  BOOST_CHECK(entries[0].before == (HistoryVersion { 1, 2, 3, 0 }));
+  BOOST_CHECK(entries[1].after == (HistoryVersion { 1, 2, 5, 0 }));
+  BOOST_CHECK(entries[1].time >= entries[0].time);
+
+  // Times never go backwards.
+  HistoryEntryVector late(1, entries[0]);
+  late[0].time = 0;
+  BOOST_REQUIRE(history.append(late));
+  BOOST_CHECK_EQUAL(late[0].time, entries[1].time);
+}
+
+BOOST_AUTO_TEST_CASE(damage)
+{
+  Journal            journal;
+  History            history(journal.path, "", 256);
+  HistoryEntryVector entries;
+
+  journal.fill(history, 20);
+
+  // A torn record is ignored, and cut off by the next append.
+  {
+    ofstream strm(journal.path, ios::binary | ios::app);
+
+    strm.write("\x40\x00\x00\x00torn", 8);
+  }
+
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", entries));
+  BOOST_CHECK_EQUAL(entries.size(), 20u);
+
+  journal.fill(history, 2);
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", entries));
+  BOOST_CHECK_EQUAL(entries.size(), 22u);
+
+  // A lost index is rebuilt.
+  fs::remove(journal.path + HISTORY_INDEX_SUFFIX);
+  BOOST_REQUIRE(history.at(1015, "b", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 1u);
+  BOOST_CHECK_EQUAL(entries[0].after.build, 15u);
+
+  journal.fill(history, 1);
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", entries));
+  BOOST_CHECK_EQUAL(entries.size(), 23u);
+}
+
+BOOST_AUTO_TEST_CASE(compact)
+{
+  Journal            journal;
+  History            history(journal.path, "", 256);
+  HistoryEntryVector entries;
+  HistoryEntryVector noop(1);
+  size_t             dropped;
+
+  journal.fill(history, 40);
+
+  noop[0].time      = 2000;
+  noop[0].type      = IncrementType::Simple;
+  noop[0].component = "a";
+  noop[0].before    = { 1, 0, 40, 0 };
+  noop[0].after     = noop[0].before;
+  BOOST_REQUIRE(history.append(noop));
+
+  BOOST_REQUIRE(history.compact(1031, dropped));
+  BOOST_CHECK_EQUAL(dropped, 29u);
+
+  BOOST_REQUIRE(history.list(INT64_MIN, INT64_MAX, "", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 12u);
+  BOOST_CHECK_EQUAL(entries[0].component, "b");
+  BOOST_CHECK(entries[0].before == (HistoryVersion { 1, 0, UINT32_MAX, 0 }));
+  BOOST_CHECK(entries[0].after == (HistoryVersion { 1, 0, 29, 0 }));
+  BOOST_CHECK_EQUAL(entries[1].time, 1030);
+
+  // Still answers the same questions from then on.
+  BOOST_REQUIRE(history.at(1035, "b", entries));
+  BOOST_REQUIRE_EQUAL(entries.size(), 1u);
+  BOOST_CHECK_EQUAL(entries[0].after.build, 35u);
+
+  BOOST_REQUIRE(history.compact(INT64_MIN, dropped));
+  BOOST_CHECK_EQUAL(dropped, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(times)
+{
+  int64_t time;
+
+  BOOST_CHECK(History::parse_time("@1234", time));
+  BOOST_CHECK_EQUAL(time, 1234);
+
+  BOOST_CHECK(History::parse_time("1970-01-02", time));
+  BOOST_CHECK_EQUAL(time, 2 * 86400 - 1);
+
+  BOOST_CHECK(History::parse_time("2026-10-20T07:58:30Z", time));
+  BOOST_CHECK_EQUAL(History::format_time(time), "2026-10-20T07:58:30Z");
+
+  BOOST_CHECK(History::parse_time("2026-10-20 07:58", time));
+  BOOST_CHECK_EQUAL(History::format_time(time), "2026-10-20T07:58:00Z");
+
+  BOOST_CHECK(!History::parse_time("2026-13-01", time));
+  BOOST_CHECK(!History::parse_time("2026-10-20T25:00", time));
+  BOOST_CHECK(!History::parse_time("yesterday", time));
+  BOOST_CHECK(!History::parse_time("@12x", time));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// History_test.cpp ends here.
@@ -0,0 +1,228 @@
+//
+// InputDigest_test.cpp --- Input digest tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 03:01:49
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file InputDigest_test.cpp
+ * @author Paul Ward
+ * @brief Input digest tests.
+ */
+
+#define BOOST_TEST_MODULE InputDigest_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../verbuild/InputDigest.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+struct InputTree
+{
+  TempDir  dir;
+  fs::path root;
+
+  InputTree()
+    : dir("inputs"),
+      root(dir.path)
+  {
+    fs::create_directories(root / "src" / "sub");
+    fs::create_directories(root / "src" / ".git");
+
+    put("src/a.c", "int a;\n");
+    put("src/sub/b.c", "int b;\n");
+    put("README", "Read me.\n");
+  }
+
+  void put(const string &name, const string &text)
+  {
+    ofstream(root / name, ios::binary) << text;
+  }
+
+  uint64_t digest()
+  {
+    InputDigest inputs({ (root / "src").string(), (root / "README").string() });
+    uint64_t    value = 0;
+
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_EQUAL(inputs.get_file_count(), 3u);
+
+    return value;
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(InputDigest_test_suite)
+
+BOOST_AUTO_TEST_CASE(changes)
+{
+  InputTree tree;
+  uint64_t  first = tree.digest();
+
+  BOOST_CHECK_EQUAL(tree.digest(), first);
+
+  // Neither timestamps nor anything under .git count.
+  fs::last_write_time(tree.root / "README",
+                      fs::last_write_time(tree.root / "README") +
+                        chrono::hours(1));
+  tree.put("src/.git/HEAD", "ref: refs/heads/main\n");
+  BOOST_CHECK_EQUAL(tree.digest(), first);
+
+  tree.put("src/sub/b.c", "int c;\n");
+  BOOST_CHECK_NE(tree.digest(), first);
+
+  tree.put("src/sub/b.c", "int b;\n");
+  BOOST_CHECK_EQUAL(tree.digest(), first);
+
+  // Same contents under a new name.
+  fs::rename(tree.root / "src" / "sub" / "b.c", tree.root / "src" / "sub" / "c.c");
+  BOOST_CHECK_NE(tree.digest(), first);
+}
+
+BOOST_AUTO_TEST_CASE(cached)
+{
+  InputTree     tree;
+  string        path((tree.root / "version.h.digest.cache").string());
+  uint64_t      first = tree.digest();
+  uint64_t      value = 0;
+  int64_t       later = INT64_MAX / 2;   // Nothing is too new to keep.
+  FileHashCache cache;
+
+  {
+    InputDigest inputs({ (tree.root / "src").string(),
+                         (tree.root / "README").string() }, &cache, 2);
+
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_EQUAL(value, first);
+    BOOST_CHECK_EQUAL(inputs.get_hit_count(), 0u);
+    BOOST_REQUIRE(cache.save(path, later));
+  }
+
+  BOOST_REQUIRE(cache.load(path));
+  BOOST_CHECK_EQUAL(cache.size(), 3u);
+
+  {
+    InputDigest inputs({ (tree.root / "src").string(),
+                         (tree.root / "README").string() }, &cache, 2);
+
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_EQUAL(value, first);
+    BOOST_CHECK_EQUAL(inputs.get_hit_count(), 3u);
+    BOOST_CHECK_EQUAL(inputs.get_byte_count(), 0u);
+  }
+
+  // A changed file is read again.
+  tree.put("src/a.c", "int aa;\n");
+
+  {
+    InputDigest inputs({ (tree.root / "src").string(),
+                         (tree.root / "README").string() }, &cache, 2);
+
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_NE(value, first);
+    BOOST_CHECK_EQUAL(inputs.get_hit_count(), 2u);
+    BOOST_CHECK_EQUAL(value, tree.digest());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(missing)
+{
+  InputTree   tree;
+  InputDigest inputs({ (tree.root / "nope").string() });
+  uint64_t    value;
+
+  BOOST_CHECK(!inputs.compute(value));
+}
+
+// The layout `-c -o src/version.h --if-changed src': the output and
+// its sidecars live among the inputs and must not count.
+BOOST_AUTO_TEST_CASE(generated)
+{
+  InputTree tree;
+  fs::path  saved = fs::current_path();
+  uint64_t  first = 0;
+  uint64_t  value = 0;
+
+  fs::current_path(tree.root);
+
+  {
+    InputDigest inputs({ "src" });
+
+    inputs.exclude("src/version.h");
+    inputs.exclude("./src/version.h.digest");
+    inputs.exclude((tree.root / "src" / "version.h.digest.cache").string());
+
+    BOOST_REQUIRE(inputs.compute(first));
+
+    tree.put("src/version.h", "#define VERSION 1\n");
+    tree.put("src/version.h.digest", "xxh64 0123456789abcdef\n");
+    tree.put("src/version.h.digest.cache", "junk");
+
+    // So are files another run is writing in their place.
+    tree.put("src/version.h.digest.tmp4321", "xxh64 fedcba9876543210\n");
+    tree.put("src/version.h.tmp", "#define VERSION 2\n");
+
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_EQUAL(value, first);
+    BOOST_CHECK_EQUAL(inputs.get_file_count(), 2u);
+
+    // Only the exact names are left out.
+    tree.put("src/version.h.tmpx", "#define VERSION 2\n");
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_NE(value, first);
+    fs::remove(tree.root / "src" / "version.h.tmpx");
+
+    tree.put("src/sub/version.h", "#define VERSION 2\n");
+    BOOST_REQUIRE(inputs.compute(value));
+    BOOST_CHECK_NE(value, first);
+  }
+
+  fs::current_path(saved);
+}
+
+BOOST_AUTO_TEST_CASE(sidecar)
+{
+  InputTree tree;
+  string    path((tree.root / "version.h.digest").string());
+  uint64_t  value = 0;
+
+  BOOST_CHECK(!InputDigest::load(path, value));
+  BOOST_CHECK(InputDigest::store(path, 0x0123456789abcdefULL));
+  BOOST_CHECK(InputDigest::load(path, value));
+  BOOST_CHECK_EQUAL(value, 0x0123456789abcdefULL);
+
+  tree.put("version.h.digest", "md5 0123456789abcdef\n");
+  BOOST_CHECK(!InputDigest::load(path, value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// InputDigest_test.cpp ends here.
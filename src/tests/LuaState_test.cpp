@@ -0,0 +1,423 @@
+//
+// LuaState_test.cpp --- Lua state and bytecode cache tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 11:04:22
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaState_test.cpp
+ * @author Paul Ward
+ * @brief Lua state and bytecode cache tests.
+ */
+
+#define BOOST_TEST_MODULE LuaState_test
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+
+#include "../verbuild/LuaState.hpp"
+#include "../verbuild/LuaCache.hpp"
+#include "../verbuild/LuaPolicy.hpp"
+#include "../verbuild/LuaPool.hpp"
+#include "../verbuild/Transform_Lua.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+struct scratch {
+  TempDir  tmp;
+  fs::path dir;
+  fs::path script;
+
+  scratch()
+    : tmp("lua"),
+      dir(tmp.path)
+  {
+    script = dir / "bump.lua";
+
+    ofstream strm(script);
+    strm << "return function(vi) vi.build = vi.build + 1 "
+         << "return vi:to_string() end\n";
+  }
+};
+
+BOOST_AUTO_TEST_SUITE(LuaState_test_suite)
+
+BOOST_FIXTURE_TEST_CASE(userdata_access, scratch)
+{
+  LuaState    state;
+  lua_State  *L = state.get();
+  VersionInfo vi(1, 2, 3, 4, 2017, IncrementType::Simple);
+
+  BOOST_REQUIRE(state.load_file(script.string(), ""));
+  BOOST_REQUIRE(lua_isfunction(L, -1));
+
+  lua_push_version_info(L, &vi);
+  BOOST_REQUIRE_EQUAL(lua_pcall(L, 1, 1, 0), LUA_OK);
+
+  BOOST_CHECK_EQUAL(string(lua_tostring(L, -1)), "1.2.4.4");
+  BOOST_CHECK_EQUAL(vi.get_build(), 4);
+  lua_pop(L, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(bytecode_cache, scratch)
+{
+  fs::path cache = dir / "cache";
+
+  {
+    LuaState state;
+
+    BOOST_REQUIRE(state.load_file(script.string(), cache.string()));
+  }
+
+  BOOST_REQUIRE(fs::exists(cache));
+  BOOST_CHECK_EQUAL(distance(fs::directory_iterator(cache),
+                             fs::directory_iterator()), 1);
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+  BOOST_CHECK(fs::status(cache).permissions() == fs::perms::owner_all);
+#endif
+
+  // Swap the cached bytecode for a different chunk.  Only an entry
+  // that carries the matching source text may run it.
+  {
+    LuaState   state;
+    lua_State *L = state.get();
+    LuaCache   cached(cache.string());
+    fs::path   entry = fs::directory_iterator(cache)->path();
+    ifstream   strm(script);
+    string     source((istreambuf_iterator<char>(strm)),
+                       istreambuf_iterator<char>());
+    string     bytecode;
+
+    auto make_entry = [&bytecode](const string &text) {
+      string out("VBLC");
+
+      for (unsigned i = 0; i < 4; i++) {
+        out.push_back(static_cast<char>((LUA_VERSION_NUM >> (8 * i)) & 0xFF));
+      }
+      for (unsigned i = 0; i < 8; i++) {
+        out.push_back(static_cast<char>(((uint64_t)text.size() >> (8 * i)) & 0xFF));
+      }
+
+      return out + text + bytecode;
+    };
+
+    auto run = [&]() {
+      string result;
+
+      BOOST_REQUIRE_EQUAL(cached.load(L, source, "=test"), LUA_OK);
+      BOOST_REQUIRE_EQUAL(lua_pcall(L, 0, 1, 0), LUA_OK);
+      result = lua_isstring(L, -1) ? lua_tostring(L, -1) : "<source>";
+      lua_pop(L, 1);
+
+      return result;
+    };
+
+    BOOST_REQUIRE_EQUAL(luaL_loadstring(L, "return 'cached'"), LUA_OK);
+    lua_dump(L,
+             [](lua_State *, const void *p, size_t sz, void *ud) {
+               static_cast<string *>(ud)->append((const char *)p, sz);
+               return 0;
+             },
+             &bytecode,
+             0);
+    lua_pop(L, 1);
+
+    // Bare bytecode is not a valid entry.
+    ofstream(entry, ios::binary | ios::trunc) << bytecode;
+    BOOST_CHECK_EQUAL(run(), "<source>");
+
+    // Neither is one compiled from some other source.
+    ofstream(entry, ios::binary | ios::trunc) << make_entry(source + " ");
+    BOOST_CHECK_EQUAL(run(), "<source>");
+
+    ofstream(entry, ios::binary | ios::trunc) << make_entry(source);
+    BOOST_CHECK_EQUAL(run(), "cached");
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+    // An entry others could have written is ignored.
+    fs::permissions(entry, fs::perms::group_write, fs::perm_options::add);
+    BOOST_CHECK_EQUAL(run(), "<source>");
+#endif
+  }
+}
+
+BOOST_AUTO_TEST_CASE(range_checks)
+{
+  LuaState    state;
+  lua_State  *L = state.get();
+  VersionInfo vi;
+
+  lua_push_version_info(L, &vi);
+  lua_setglobal(L, "vi");
+
+  BOOST_CHECK(luaL_dostring(L, "vi.major = -1") != LUA_OK);
+  lua_pop(L, 1);
+  BOOST_CHECK(luaL_dostring(L, "vi.nonsense = 1") != LUA_OK);
+  lua_pop(L, 1);
+  BOOST_CHECK(luaL_dostring(L, "vi.minor = 7") == LUA_OK);
+  BOOST_CHECK_EQUAL(vi.get_minor(), 7);
+}
+
+BOOST_FIXTURE_TEST_CASE(increment_policy, scratch)
+{
+  LuaPolicy   policy;
+  fs::path    path = dir / "policy.lua";
+  VersionInfo vi(1, 2, 10, 0, 2017, IncrementType::Script);
+
+  ofstream(path) << "return { increment = function(build, year, major)\n"
+                 << "  return build * 2 + major end }\n";
+
+  BOOST_CHECK_THROW(vi.increment(IncrementMode::Build), invalid_argument);
+
+  BOOST_REQUIRE(policy.load(path.string(), ""));
+  vi.set_increment_policy(&policy);
+  BOOST_CHECK(vi.increment(IncrementMode::Build));
+  BOOST_CHECK(vi.increment(IncrementMode::Build));
+
+  BOOST_CHECK_EQUAL(vi.get_build(), 43);
+}
+
+BOOST_FIXTURE_TEST_CASE(failed_policy, scratch)
+{
+  LuaPolicy   policy;
+  fs::path    path = dir / "policy.lua";
+  VersionInfo vi(1, 2, 10, 3, 2017, IncrementType::Script);
+
+  ofstream(path) << "return { increment = function(build)\n"
+                 << "  error('no build for you') end }\n";
+
+  BOOST_REQUIRE(policy.load(path.string(), ""));
+  vi.set_increment_policy(&policy);
+
+  // The patch must not move when the build could not be worked out.
+  BOOST_CHECK(!vi.increment(IncrementMode::BuildAndPatch));
+  BOOST_CHECK_EQUAL(vi.to_string(), "1.2.10.3");
+}
+
+BOOST_AUTO_TEST_CASE(sandbox)
+{
+  LuaState   state;
+  lua_State *L = state.get();
+
+  BOOST_CHECK(luaL_dostring(L, "return os == nil and io == nil "
+                               "and require == nil and dofile == nil") == LUA_OK);
+  BOOST_CHECK(lua_toboolean(L, -1));
+  lua_pop(L, 1);
+
+  BOOST_REQUIRE(luaL_dostring(L, "return load(string.dump(function() end))")
+                == LUA_OK);
+  BOOST_CHECK(lua_isnil(L, -2));
+  lua_pop(L, 2);
+
+  BOOST_REQUIRE(luaL_dostring(L, "return load('return 6 * 7')()") == LUA_OK);
+  BOOST_CHECK_EQUAL(lua_tointeger(L, -1), 42);
+  lua_pop(L, 1);
+}
+
+BOOST_AUTO_TEST_CASE(memory_limit)
+{
+  LuaLimits limits;
+
+  limits.memory = 1024 * 1024;
+
+  LuaState   state(limits);
+  lua_State *L = state.get();
+
+  BOOST_REQUIRE(luaL_loadstring(L, "local t = {} "
+                                   "for i = 1, 1e7 do t[i] = tostring(i) end")
+                == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 0), LUA_ERRMEM);
+  lua_pop(L, 1);
+
+  BOOST_CHECK(state.get_memory_peak() <= limits.memory);
+  lua_gc(L, LUA_GCCOLLECT);
+  BOOST_CHECK(state.get_memory_used() < state.get_memory_peak());
+
+  // The state stays usable once the garbage has been collected.
+  BOOST_REQUIRE(luaL_loadstring(L, "return 1 + 1") == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 1), LUA_OK);
+  lua_pop(L, 1);
+}
+
+BOOST_AUTO_TEST_CASE(instruction_limit)
+{
+  LuaLimits limits;
+
+  limits.instructions = 100000;
+
+  LuaState   state(limits);
+  lua_State *L = state.get();
+
+  BOOST_REQUIRE(luaL_loadstring(L, "while true do end") == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 0), LUA_ERRRUN);
+  BOOST_CHECK(state.pop_error().find("instruction budget") != string::npos);
+
+  // Each call gets a fresh budget.
+  BOOST_REQUIRE(luaL_loadstring(L, "for i = 1, 1000 do end") == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 0), LUA_OK);
+}
+
+BOOST_AUTO_TEST_CASE(instruction_limit_pcall)
+{
+  LuaLimits limits;
+
+  limits.instructions = 100000;
+
+  LuaState   state(limits);
+  lua_State *L = state.get();
+
+  // Catching the error must not buy the script more time.
+  BOOST_REQUIRE(luaL_loadstring(L,
+                                "while true do pcall(function()\n"
+                                "  while true do end end) end") == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 0), LUA_ERRRUN);
+  BOOST_CHECK(state.pop_error().find("instruction budget") != string::npos);
+
+  BOOST_REQUIRE(luaL_loadstring(L,
+                                "local co = coroutine.wrap(function()\n"
+                                "  while true do end end)\n"
+                                "pcall(co)\n"
+                                "while true do end") == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 0), LUA_ERRRUN);
+  BOOST_CHECK(state.pop_error().find("instruction budget") != string::npos);
+
+  BOOST_REQUIRE(luaL_loadstring(L, "for i = 1, 1000 do end") == LUA_OK);
+  BOOST_CHECK_EQUAL(state.pcall(0, 0), LUA_OK);
+}
+
+BOOST_FIXTURE_TEST_CASE(pool_reset, scratch)
+{
+  LuaPool    pool;
+  LuaState  *first;
+  LuaState  *second;
+  lua_State *L;
+
+  first = pool.acquire(LuaLimits());
+  L     = first->get();
+
+  BOOST_REQUIRE(first->load_module(script.string(), ""));
+  lua_pop(L, 1);
+  BOOST_REQUIRE(luaL_dostring(L, "leaked = 1 string = nil") == LUA_OK);
+  pool.release(first);
+
+  second = pool.acquire(LuaLimits());
+  BOOST_CHECK(second == first);
+  BOOST_CHECK_EQUAL(pool.size(), 1u);
+
+  BOOST_REQUIRE(luaL_dostring(L, "return leaked == nil and string ~= nil")
+                == LUA_OK);
+  BOOST_CHECK(lua_toboolean(L, -1));
+  lua_pop(L, 1);
+
+  // The module survives the reset and is not loaded again.
+  ofstream(script) << "error('reloaded')\n";
+  BOOST_CHECK(second->load_module(script.string(), ""));
+  BOOST_CHECK(lua_isfunction(L, -1));
+  lua_pop(L, 1);
+
+  BOOST_CHECK(pool.acquire(LuaLimits()) != second);
+  BOOST_CHECK_EQUAL(pool.size(), 2u);
+}
+
+BOOST_FIXTURE_TEST_CASE(bulk_write, scratch)
+{
+  fs::path            path = dir / "bulk.lua";
+  vector<unique_ptr<VersionInfo>> store;
+  vector<VersionInfo *>           vis;
+  vector<string>                  out;
+  Config                          conf;
+
+  ofstream(path) << "local calls = 0\n"
+                 << "local function write(vi, conf)\n"
+                 << "  return conf.prefix .. vi:to_string() end\n"
+                 << "return { write = write,\n"
+                 << "  write_all = function(vis, conf)\n"
+                 << "    local out = {}\n"
+                 << "    calls = calls + 1\n"
+                 << "    for i, vi in ipairs(vis) do\n"
+                 << "      out[i] = write(vi, conf) .. '/' .. calls end\n"
+                 << "    return out end }\n";
+
+  for (uint32_t i = 0; i < 100; i++) {
+    store.emplace_back(new VersionInfo(1, 0, i, 0, 2017, IncrementType::Simple));
+    vis.push_back(store.back().get());
+  }
+
+  conf.script = path.string();
+  conf.prefix = "V";
+
+  LuaTransform transform;
+
+  transform.set_config(conf);
+  BOOST_REQUIRE(transform.write_all(vis, out));
+  BOOST_REQUIRE_EQUAL(out.size(), vis.size());
+  BOOST_CHECK_EQUAL(out[0], "V1.0.0.0/1");
+  BOOST_CHECK_EQUAL(out[99], "V1.0.99.0/1");
+}
+
+BOOST_FIXTURE_TEST_CASE(pooled_transforms, scratch)
+{
+  fs::path    path = dir / "plain.lua";
+  VersionInfo vi(1, 2, 3, 4, 2017, IncrementType::Simple);
+  Config      conf;
+  size_t      before;
+
+  ofstream(path) << "return { write = function(vi, conf)\n"
+                 << "  return vi:to_string() end,\n"
+                 << "  read = function(vi, text) return true end }\n";
+
+  conf.script = path.string();
+
+  LuaTransform first;
+  LuaTransform second;
+
+  before = get_lua_pool().size();
+
+  conf.filename = (dir / "first.txt").string();
+  first.set_config(conf);
+  conf.filename = (dir / "second.txt").string();
+  second.set_config(conf);
+
+  // Both transforms are alive, but neither keeps a state between
+  // calls, so the second one reuses the first one's.
+  BOOST_REQUIRE(first.write(vi));
+  BOOST_REQUIRE(second.write(vi));
+  BOOST_REQUIRE(first.read(vi));
+
+  BOOST_CHECK_EQUAL(get_lua_pool().size(), max<size_t>(before, 1));
+  BOOST_CHECK_EQUAL(get_lua_pool().idle(), get_lua_pool().size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// LuaState_test.cpp ends here.
@@ -0,0 +1,212 @@
+//
+// Manifest_test.cpp --- Package manifest tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 21:41:55
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Manifest_test.cpp
+ * @author Paul Ward
+ * @brief Package manifest tests.
+ */
+
+#define BOOST_TEST_MODULE Manifest_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "../verbuild/Transform_Manifest.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static const char package_json[] =
+  "{\n"
+  "  \"name\": \"demo \\\"version\\\"\",\n"
+  "  \"config\": { \"version\": \"9.9.9\" },\n"
+  "  \"files\": [\"version\", {\"version\": \"8.8.8\"}],\n"
+  "  \"version\" : \"1.2.3-beta.1\",\n"
+  "  \"dependencies\": { \"left-pad\": \"^1.0.0\" }\n"
+  "}\n";
+
+static const char cargo_toml[] =
+  "# version = \"0.0.0\"\n"
+  "[workspace.package]\n"
+  "version = \"7.7.7\"\n"
+  "\n"
+  "[ package ]\n"
+  "name = \"demo\"\n"
+  "description = \"\"\"\n"
+  "version = \"6.6.6\"\n"
+  "\"\"\"\n"
+  "keywords = [\n"
+  "  \"a\", # version = \"5.5.5\"\n"
+  "]\n"
+  "version = '1.2.3'  # the version\n"
+  "\n"
+  "[dependencies]\n"
+  "serde = { version = \"1.0\" }\n";
+
+static const char pyproject_toml[] =
+  "[build-system]\n"
+  "requires = [\"setuptools\"]\n"
+  "\n"
+  "[tool.poetry]\n"
+  "name = \"demo\"\n"
+  "version = \"1.2.3.4rc1\"\n";
+
+static const char pom_xml[] =
+  "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+  "<!-- <version>0.0.0</version> -->\n"
+  "<project xmlns=\"http://maven.apache.org/POM/4.0.0\">\n"
+  "  <parent>\n"
+  "    <version>9.9.9</version>\n"
+  "  </parent>\n"
+  "  <modelVersion>4.0.0</modelVersion>\n"
+  "  <description><![CDATA[<version>8.8.8</version>]]></description>\n"
+  "  <properties a=\"x>y\"/>\n"
+  "  <version>\n"
+  "    1.2.3-SNAPSHOT\n"
+  "  </version>\n"
+  "</project>\n";
+
+static
+string
+value_of(ManifestFormat format, const string &text)
+{
+  ManifestValue value;
+
+  if (!find_manifest_version(format, text.data(), text.size(), value)) {
+    return "<none>";
+  }
+
+  return text.substr(value.offset, value.length);
+}
+
+static
+string
+slurp(const fs::path &path)
+{
+  ifstream strm(path, ios::binary);
+
+  return string(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+}
+
+static
+string
+bump(const string &key, const string &text, bool update)
+{
+  TempDir               tmp("manifest");
+  fs::path              path = tmp / "manifest";
+  unique_ptr<Transform> transform(GET_TRANSFORM_CREATE(key));
+  VersionInfo           vi;
+  Config                conf;
+  string                out;
+
+  ofstream(path, ios::binary) << text;
+
+  conf.update = update;
+  transform->set_config(conf);
+  transform->set_filename(path.string());
+
+  BOOST_REQUIRE(transform->read(vi));
+  vi.set_build(vi.get_build() + 10);
+  BOOST_REQUIRE(transform->write(vi));
+
+  out = slurp(path);
+
+  return out;
+}
+
+BOOST_AUTO_TEST_SUITE(Manifest_test_suite)
+
+BOOST_AUTO_TEST_CASE(finds_top_level)
+{
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Npm, package_json),
+                    "1.2.3-beta.1");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Cargo, cargo_toml), "1.2.3");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::PyProject, pyproject_toml),
+                    "1.2.3.4rc1");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Maven, pom_xml),
+                    "1.2.3-SNAPSHOT");
+}
+
+BOOST_AUTO_TEST_CASE(ignores_nested)
+{
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Npm,
+                             "{\"a\": {\"version\": \"1\"}}"),
+                    "<none>");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Npm, "[{\"version\": \"1\"}]"),
+                    "<none>");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Cargo,
+                             "[package]\nversion.workspace = true\n"),
+                    "<none>");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Cargo,
+                             "[[package]]\nversion = \"1\"\n"),
+                    "<none>");
+  BOOST_CHECK_EQUAL(value_of(ManifestFormat::Maven,
+                             "<project><build><version>1</version></build>"
+                             "</project>"),
+                    "<none>");
+}
+
+BOOST_AUTO_TEST_CASE(semver_manifests)
+{
+  string json(package_json);
+  string toml(cargo_toml);
+
+  json.replace(json.find("1.2.3-beta.1"), 12, "1.2.3-beta.1+10");
+  BOOST_CHECK_EQUAL(bump("npm", package_json, false), json);
+
+  // The build metadata is replaced rather than appended to.
+  json.replace(json.find("+10"), 3, "+20");
+  BOOST_CHECK_EQUAL(bump("npm", bump("npm", package_json, false), true),
+                    json);
+
+  toml.replace(toml.find("'1.2.3'"), 7, "'1.2.3+10'");
+  BOOST_CHECK_EQUAL(bump("cargo", cargo_toml, true), toml);
+}
+
+BOOST_AUTO_TEST_CASE(release_manifests)
+{
+  string py(pyproject_toml);
+  string pom(pom_xml);
+
+  py.replace(py.find("1.2.3.4rc1"), 7, "1.2.13.4");
+  BOOST_CHECK_EQUAL(bump("pyproject", pyproject_toml, false), py);
+
+  pom.replace(pom.find("1.2.3-SNAPSHOT"), 5, "1.2.13.0");
+  BOOST_CHECK_EQUAL(bump("maven", pom_xml, true), pom);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Manifest_test.cpp ends here.
@@ -0,0 +1,84 @@
+//
+// Opts_test.cpp --- Program option tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 13:02:11
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file Opts_test.cpp
+ * @author Paul Ward
+ * @brief Program option tests.
+ */
+
+#define BOOST_TEST_MODULE Opts_test
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+#include "../verbuild/Opts.hpp"
+#include "../verbuild/Transform_C.hpp"
+#include "../verbuild/Transform_JSON.hpp"
+
+using namespace std;
+
+static
+void
+check_output(const string &arg,
+             const string &transform,
+             const string &filename)
+{
+  OutputSpec spec = parse_output(arg, "fallback");
+
+  BOOST_TEST_CONTEXT(arg) {
+    BOOST_CHECK_EQUAL(spec.transform, transform);
+    BOOST_CHECK_EQUAL(spec.filename, filename);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(Opts_test_suite)
+
+BOOST_AUTO_TEST_CASE(output_transform)
+{
+  check_output("json:out.json", "json", "out.json");
+  check_output("JSON:out.json", "json", "out.json");
+  check_output("c:v.h", "c", "v.h");
+  check_output("v.h", "fallback", "v.h");
+  check_output("nope:v.h", "fallback", "nope:v.h");
+}
+
+BOOST_AUTO_TEST_CASE(output_drive)
+{
+  check_output("C:\\x\\v.h", "fallback", "C:\\x\\v.h");
+  check_output("c:\\x\\v.h", "fallback", "c:\\x\\v.h");
+  check_output("c:/x/v.h", "fallback", "c:/x/v.h");
+  check_output("C:sub/v.json", "fallback", "C:sub/v.json");
+  check_output("json:C:\\x\\v.json", "json", "C:\\x\\v.json");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Opts_test.cpp ends here.
@@ -0,0 +1,161 @@
+//
+// Region_test.cpp --- Marker region tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 20:14:09
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Region_test.cpp
+ * @author Paul Ward
+ * @brief Marker region tests.
+ */
+
+#define BOOST_TEST_MODULE Region_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "../verbuild/Transform_Region.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static const char document[] =
+  "# Project\n"
+  "\n"
+  "Release <!-- verbuild:begin --> 1.2.3.4 <!-- verbuild:end --> is out.\n"
+  "Build /* verbuild:begin build */17/* verbuild:end */.\n"
+  "\r\n"
+  "# verbuild:begin major\r\n"
+  "1\r\n"
+  "# verbuild:end\r\n"
+  "Mentions verbuild: in passing.\n"
+  "<!-- verbuild:begin date -->\n"
+  "<!-- verbuild:end -->\n";
+
+static
+string
+slurp(const fs::path &path)
+{
+  ifstream strm(path, ios::binary);
+
+  return string(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+}
+
+BOOST_AUTO_TEST_SUITE(Region_test_suite)
+
+BOOST_AUTO_TEST_CASE(finds_regions)
+{
+  string       text(document);
+  RegionVector regions;
+
+  BOOST_REQUIRE(find_regions(text.data(), text.size(), regions));
+  BOOST_REQUIRE_EQUAL(regions.size(), 4);
+
+  BOOST_CHECK(regions[0].field == TemplateField::Version);
+  BOOST_CHECK(!regions[0].block);
+  BOOST_CHECK_EQUAL(text.substr(regions[0].offset, regions[0].length),
+                    "1.2.3.4");
+
+  BOOST_CHECK(regions[1].field == TemplateField::Build);
+  BOOST_CHECK_EQUAL(text.substr(regions[1].offset, regions[1].length), "17");
+
+  BOOST_CHECK(regions[2].field == TemplateField::Major);
+  BOOST_CHECK(regions[2].block);
+  BOOST_CHECK_EQUAL(regions[2].newline, "\r\n");
+  BOOST_CHECK_EQUAL(text.substr(regions[2].offset, regions[2].length),
+                    "1\r\n");
+
+  BOOST_CHECK(regions[3].field == TemplateField::Date);
+  BOOST_CHECK_EQUAL(regions[3].length, 0);
+}
+
+BOOST_AUTO_TEST_CASE(rejects_unbalanced)
+{
+  RegionVector regions;
+  const char  *bad[] = {
+    "verbuild:begin\nverbuild:begin\nverbuild:end\n",
+    "verbuild:end\n",
+    "verbuild:begin\n",
+    "verbuild:begin nonsense\nverbuild:end\n"
+  };
+
+  for (const char *text : bad) {
+    BOOST_CHECK(!find_regions(text, strlen(text), regions));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(write_and_update)
+{
+  TempDir         tmp("region");
+  fs::path        path = tmp / "region.md";
+  RegionTransform transform;
+  VersionInfo     vi;
+  Config          conf;
+  string          expect(document);
+
+  ofstream(path, ios::binary) << document;
+
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+
+  BOOST_REQUIRE(transform.read(vi));
+  BOOST_CHECK_EQUAL(vi.to_string(), "1.2.17.4");
+
+  vi.set_build(1800);
+  BOOST_REQUIRE(transform.write(vi));
+
+  // The date region is refilled on every write; drop it to compare.
+  {
+    string text(slurp(path));
+    size_t date = text.find("<!-- verbuild:begin date -->\n") + 29;
+
+    text.erase(date, text.find("<!-- verbuild:end -->", date) - date);
+    expect.replace(expect.find("1.2.3.4"), 7, "1.2.1800.4");
+    expect.replace(expect.find("*/17/*") + 2, 2, "1800");
+    BOOST_CHECK_EQUAL(text, expect);
+  }
+
+  conf.update = true;
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+
+  vi.set_major(2);
+  BOOST_REQUIRE(transform.write(vi));
+  BOOST_REQUIRE(transform.read(vi));
+  BOOST_CHECK_EQUAL(vi.to_string(), "2.2.1800.4");
+  BOOST_CHECK(slurp(path).find("Mentions verbuild: in passing.\n") !=
+              string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Region_test.cpp ends here.
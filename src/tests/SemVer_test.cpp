@@ -0,0 +1,145 @@
+//
+// SemVer_test.cpp --- Semantic version tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 10:12:55
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file SemVer_test.cpp
+ * @author Paul Ward
+ * @brief Semantic version tests.
+ */
+
+#define BOOST_TEST_MODULE SemVer_test
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../verbuild/SemVer.hpp"
+
+using namespace std;
+
+static
+SemVer
+sv(string_view text)
+{
+  SemVer v;
+
+  BOOST_REQUIRE_MESSAGE(SemVer::parse(text, v), text);
+
+  return v;
+}
+
+BOOST_AUTO_TEST_CASE(parsing)
+{
+  SemVer v = sv("1.2.3-rc.1+build.5");
+
+  BOOST_CHECK_EQUAL(v.major, 1U);
+  BOOST_CHECK_EQUAL(v.minor, 2U);
+  BOOST_CHECK_EQUAL(v.patch, 3U);
+  BOOST_CHECK_EQUAL(v.get_prerelease(), "rc.1");
+  BOOST_CHECK_EQUAL(v.get_build(), "build.5");
+  BOOST_CHECK_EQUAL(v.to_string(), "1.2.3-rc.1+build.5");
+  BOOST_CHECK(v.is_prerelease());
+
+  v = sv("1.0.0+001");
+  BOOST_CHECK(!v.is_prerelease());
+  BOOST_CHECK_EQUAL(v.get_build(), "001");
+
+  sv("1.0.0-x-y-z.--");
+  sv("18446744073709551615.0.0");
+}
+
+BOOST_AUTO_TEST_CASE(invalid)
+{
+  SemVer v;
+
+  for (const char *text : { "", "1", "1.0", "1.0.0.0", "01.0.0", "1.00.0",
+                            "1.0.0-", "1.0.0+", "1.0.0-01", "1.0.0-a..b",
+                            "1.0.0-a.", "1.0.0-a_b", "1.0.0+a+b", "v1.0.0",
+                            " 1.0.0", "18446744073709551616.0.0" }) {
+    BOOST_CHECK_MESSAGE(!SemVer::parse(text, v), text);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(precedence)
+{
+  // The order given in the specification.
+  vector<string_view> ordered = {
+    "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta",
+    "1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-rc.1", "1.0.0", "2.0.0",
+    "2.1.0", "2.1.1", "10.0.0"
+  };
+
+  for (size_t i = 0; i + 1 < ordered.size(); i++) {
+    BOOST_CHECK_MESSAGE(sv(ordered[i]) < sv(ordered[i + 1]),
+                        ordered[i] << " < " << ordered[i + 1]);
+    BOOST_CHECK(!(sv(ordered[i + 1]) < sv(ordered[i])));
+  }
+
+  // Build metadata does not count towards precedence.
+  BOOST_CHECK_EQUAL(compare_semver(sv("1.0.0+a"), sv("1.0.0+b")), 0);
+  BOOST_CHECK(sv("1.0.0+a") != sv("1.0.0+b"));
+  BOOST_CHECK(sv("1.0.0-1") < sv("1.0.0-a"));
+  BOOST_CHECK(sv("1.0.0-a") < sv("1.0.0-aa"));
+}
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  vector<string>      texts = {
+    "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta",
+    "1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-rc.1", "1.0.0", "2.0.0+z",
+    "not.a.version"
+  };
+  vector<string_view> views(texts.begin(), texts.end());
+  vector<string>      want(texts.begin(), texts.end() - 1);
+  SemVerArena         arena;
+  SemVerVector        versions;
+  mt19937             rng(3);
+
+  shuffle(views.begin(), views.end(), rng);
+  BOOST_CHECK_EQUAL(parse_semvers(views, arena, versions), 1U);
+  BOOST_CHECK_EQUAL(versions.size(), want.size());
+
+  // The identifiers now live in the arena, not the texts.
+  texts.clear();
+  views.clear();
+
+  sort_semvers(versions.data(), versions.size());
+
+  for (size_t i = 0; i < versions.size(); i++) {
+    BOOST_CHECK_EQUAL(versions[i].to_string(), want[i]);
+  }
+
+  BOOST_CHECK(arena.get_used() > 0);
+}
+
+// SemVer_test.cpp ends here.
@@ -0,0 +1,86 @@
+//
+// TempDir.hpp --- Scratch directories for tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 13:41:07
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file TempDir.hpp
+ * @author Paul Ward
+ * @brief Scratch directories for tests.
+ *
+ * Each @c TempDir is a new directory under the system's temporary
+ * directory, named after the test with a random suffix, so tests that
+ * run at the same time, or runs left over from a crash, never share
+ * files.  It is removed with everything in it on destruction.
+ */
+
+#pragma once
+#ifndef _TempDir_hpp_
+#define _TempDir_hpp_
+
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+struct TempDir
+{
+  std::filesystem::path path;
+
+  explicit TempDir(const std::string &name)
+  {
+    std::random_device rnd;
+
+    // create_directory only succeeds for a name nobody has taken.
+    do {
+      std::stringstream ss;
+
+      ss << "verbuild_" << name << '_' << std::hex << rnd() << rnd();
+      path = std::filesystem::temp_directory_path() / ss.str();
+    } while (!std::filesystem::create_directory(path));
+  }
+
+  TempDir(const TempDir &) = delete;
+
+  ~TempDir()
+  {
+    std::error_code ec;
+
+    std::filesystem::remove_all(path, ec);
+  }
+
+  std::filesystem::path operator/(const std::string &name) const
+  {
+    return path / name;
+  }
+};
+
+#endif // !_TempDir_hpp_
+
+// TempDir.hpp ends here.
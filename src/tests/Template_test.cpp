@@ -0,0 +1,146 @@
+//
+// Template_test.cpp --- Template engine tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:41:19
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Template_test.cpp
+ * @author Paul Ward
+ * @brief Template engine tests.
+ */
+
+#define BOOST_TEST_MODULE Template_test
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include "../verbuild/Template.hpp"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(Template_test_suite)
+
+BOOST_AUTO_TEST_CASE(fields)
+{
+  Template    tmpl("{{prefix}}{{ major }}.{{minor}}.{{build}}.{{patch}} "
+                   "{{PREFIX}}{{base_year}} {{version}} {{filename}}");
+  VersionInfo vi(1, 2, 345, 6, 2013, IncrementType::Simple);
+  Config      conf;
+
+  conf.prefix   = "my_";
+  conf.filename = "out.h";
+
+  BOOST_CHECK_EQUAL(tmpl.render(vi, conf),
+                    "my_1.2.345.6 MY_2013 1.2.345.6 out.h");
+}
+
+BOOST_AUTO_TEST_CASE(time_field)
+{
+  Template    tmpl("[{{time}}]");
+  VersionInfo vi;
+  Config      conf;
+  string      out = tmpl.render(vi, conf, 0);
+
+  BOOST_CHECK_EQUAL(out.size(), 10u);
+  BOOST_CHECK_EQUAL(out[3], ':');
+  BOOST_CHECK_EQUAL(out[6], ':');
+}
+
+BOOST_AUTO_TEST_CASE(sections)
+{
+  Template    tmpl("a\n"
+                   "{{#basic}}\n"
+                   "  basic\n"
+                   "  {{#doxygen}}\n"
+                   "  both\n"
+                   "  {{/doxygen}}\n"
+                   "{{/basic}}\n"
+                   "{{^basic}}\n"
+                   "not basic {{! ignored }}\n"
+                   "{{/basic}}\n"
+                   "z{{#struct}}!{{/struct}}\n");
+  VersionInfo vi;
+  Config      conf;
+
+  conf.groups = OutputGroups::None;
+  BOOST_CHECK_EQUAL(tmpl.render(vi, conf), "a\nnot basic \nz\n");
+
+  conf.groups = OutputGroups::Basic;
+  BOOST_CHECK_EQUAL(tmpl.render(vi, conf), "a\n  basic\nz\n");
+
+  conf.groups = OutputGroups::All;
+  BOOST_CHECK_EQUAL(tmpl.render(vi, conf), "a\n  basic\n  both\nz!\n");
+}
+
+BOOST_AUTO_TEST_CASE(flat_ops)
+{
+  Template tmpl("x{{#basic}}{{major}}{{/basic}}y");
+  auto     ops = tmpl.get_ops();
+
+  BOOST_REQUIRE_EQUAL(ops.size(), 4u);
+  BOOST_CHECK_EQUAL(ops[1].kind, TemplateOp::SkipUnless);
+  BOOST_CHECK_EQUAL(ops[1].offset, 3u);
+  BOOST_CHECK_EQUAL(ops[2].kind, TemplateOp::Field);
+}
+
+BOOST_AUTO_TEST_CASE(errors)
+{
+  Template tmpl;
+
+  BOOST_CHECK_THROW(tmpl.compile("{{major"), runtime_error);
+  BOOST_CHECK_THROW(tmpl.compile("{{nonsense}}"), runtime_error);
+  BOOST_CHECK_THROW(tmpl.compile("{{#basic}}"), runtime_error);
+  BOOST_CHECK_THROW(tmpl.compile("{{#basic}}{{/struct}}"), runtime_error);
+  BOOST_CHECK_THROW(tmpl.compile("{{#fancy}}{{/fancy}}"), runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  Template    tmpl("// {{date}} {{time}}\n"
+                   "{{#basic}}\n"
+                   "#define {{PREFIX}}BUILD {{build}}\n"
+                   "{{/basic}}\n"
+                   "{ {{base_year}}, {{major}}, {{minor}}, {{patch}} }\n");
+  VersionInfo vi(3, 1, 4159, 2, 2011, IncrementType::Simple);
+  VersionInfo back;
+  Config      conf;
+
+  conf.groups = OutputGroups::Basic;
+  conf.prefix = "x_";
+
+  BOOST_REQUIRE(tmpl.match(tmpl.render(vi, conf), conf, back));
+  BOOST_CHECK(back == vi);
+  BOOST_CHECK_EQUAL(back.get_base_year(), 2011);
+
+  BOOST_CHECK(!tmpl.match("// junk\n#define X_BUILD abc\n", conf, back));
+  BOOST_CHECK_EQUAL(back.get_build(), 4159);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Template_test.cpp ends here.
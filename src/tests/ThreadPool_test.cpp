@@ -0,0 +1,125 @@
+//
+// ThreadPool_test.cpp --- Thread pool tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 04:40:55
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file ThreadPool_test.cpp
+ * @author Paul Ward
+ * @brief Thread pool tests.
+ */
+
+#define BOOST_TEST_MODULE ThreadPool_test
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+
+#include "../verbuild/ThreadPool.hpp"
+
+using namespace std;
+
+/*
+ * Each task spawns @c fanout children until @c depth runs out, like
+ * the walk of a directory tree.
+ */
+static
+void
+spawn(ThreadPool &pool, atomic<size_t> &count, int depth, int fanout)
+{
+  count++;
+
+  if (depth == 0) {
+    return;
+  }
+
+  for (int i = 0; i < fanout; i++) {
+    pool.submit([&pool, &count, depth, fanout]() {
+      spawn(pool, count, depth - 1, fanout);
+    });
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(ThreadPool_test_suite)
+
+BOOST_AUTO_TEST_CASE(nested)
+{
+  ThreadPool     pool(4);
+  atomic<size_t> count(0);
+
+  BOOST_CHECK_EQUAL(pool.get_thread_count(), 4u);
+
+  // 1 + 4 + 16 + 64 + 256 + 1024 tasks.
+  pool.submit([&]() { spawn(pool, count, 5, 4); });
+  pool.wait();
+  BOOST_CHECK_EQUAL(count.load(), 1365u);
+
+  // The pool can be waited on again.
+  count = 0;
+  pool.submit([&]() { spawn(pool, count, 2, 3); });
+  pool.wait();
+  BOOST_CHECK_EQUAL(count.load(), 13u);
+}
+
+BOOST_AUTO_TEST_CASE(single)
+{
+  ThreadPool     pool(1);
+  atomic<size_t> count(0);
+
+  for (int i = 0; i < 100; i++) {
+    pool.submit([&]() { count++; });
+  }
+
+  pool.wait();
+  BOOST_CHECK_EQUAL(count.load(), 100u);
+  BOOST_CHECK_EQUAL(pool.get_steal_count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(throws)
+{
+  ThreadPool     pool(2);
+  atomic<size_t> count(0);
+
+  pool.submit([]() { throw runtime_error("boom"); });
+  pool.submit([&]() { count++; });
+  pool.wait();
+  BOOST_CHECK_EQUAL(count.load(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(idle)
+{
+  ThreadPool pool;
+
+  // Nothing to wait for.
+  pool.wait();
+  BOOST_CHECK(pool.get_thread_count() >= 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// ThreadPool_test.cpp ends here.
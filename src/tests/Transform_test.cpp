@@ -0,0 +1,246 @@
+//
+// Transform_test.cpp --- Transform round-trip tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:36:08
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_test.cpp
+ * @author Paul Ward
+ * @brief Transform round-trip tests.
+ */
+
+#define BOOST_TEST_MODULE Transform_test
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "../verbuild/Transform_C.hpp"
+#include "../verbuild/Transform_JSON.hpp"
+#include "../verbuild/Transform_CMake.hpp"
+#include "../verbuild/Transform_Env.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+void
+round_trip(const string &key)
+{
+  TempDir               tmp("transform");
+  fs::path              path = tmp / "rt";
+  unique_ptr<Transform> transform(GET_TRANSFORM_CREATE(key));
+  VersionInfo           vi(4, 3, 2109, 7, 2012, IncrementType::Simple);
+  VersionInfo           back;
+  Config                conf;
+
+  BOOST_TEST_MESSAGE("Transform " << key);
+  BOOST_REQUIRE(transform);
+
+  conf.groups = OutputGroups::All;
+  conf.prefix = "rt_";
+  transform->set_config(conf);
+  transform->set_filename(path.string());
+
+  BOOST_REQUIRE(transform->write(vi));
+  BOOST_REQUIRE(transform->read(back));
+  BOOST_CHECK(back == vi);
+  BOOST_CHECK_EQUAL(back.get_base_year(), 2012);
+}
+
+BOOST_AUTO_TEST_SUITE(Transform_test_suite)
+
+BOOST_AUTO_TEST_CASE(round_trips)
+{
+  round_trip("c");
+  round_trip("json");
+  round_trip("cmake");
+  round_trip("env");
+}
+
+BOOST_AUTO_TEST_CASE(hand_edited)
+{
+  TempDir               tmp("transform");
+  fs::path              path = tmp / "he.env";
+  unique_ptr<Transform> transform(GET_TRANSFORM_CREATE("env"));
+  VersionInfo           vi;
+  Config                conf;
+
+  ofstream(path) << "# local\n"
+                 << "export MY_VERSION_MAJOR=\"5\"\n"
+                 << "  MY_VERSION_BUILD=99\n"
+                 << "NOT_VERSION_MINOR 3\n";
+
+  transform->set_config(conf);
+  transform->set_filename(path.string());
+
+  BOOST_REQUIRE(transform->read(vi));
+  BOOST_CHECK_EQUAL(vi.get_major(), 5);
+  BOOST_CHECK_EQUAL(vi.get_build(), 99);
+  BOOST_CHECK_EQUAL(vi.get_minor(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(unreadable)
+{
+  TempDir               tmp("transform");
+  fs::path              path = tmp / "bad.json";
+  unique_ptr<Transform> transform(GET_TRANSFORM_CREATE("json"));
+  VersionInfo           vi;
+  Config                conf;
+
+  transform->set_config(conf);
+  transform->set_filename(path.string());
+
+  // Missing and empty files may be created; a file without a version
+  // must not be read as 0.0.0.0.
+  fs::remove(path);
+  BOOST_CHECK(!transform->read(vi) && !transform->exists());
+
+  ofstream(path).close();
+  BOOST_CHECK(!transform->read(vi) && !transform->exists());
+
+  ofstream(path) << "{ \"name\": \"no version here\" }\n";
+  BOOST_CHECK(!transform->read(vi));
+  BOOST_CHECK(transform->exists());
+}
+
+BOOST_AUTO_TEST_CASE(update_in_place)
+{
+  TempDir     tmp("transform");
+  fs::path    path = tmp / "update.h";
+  CTransform  transform;
+  VersionInfo vi(1, 2, 999, 3, 2015, IncrementType::Simple);
+  VersionInfo back;
+  Config      conf;
+  string      text;
+
+  ofstream(path) << "// Keep me.\n"
+                 << "#define VERSION_MAJOR 1 /* major */\n"
+                 << "#define VERSION_MINOR\t2\n"
+                 << "#define VERSION_BUILD 999\n"
+                 << "#define VERSION_STRING \"1.2.999.3\"\n"
+                 << "// Keep me too.\n";
+
+  conf.update = true;
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+
+  vi.set_minor(7);
+  BOOST_REQUIRE(transform.write(vi));
+
+  {
+    ifstream strm(path);
+
+    text.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+  }
+
+  BOOST_CHECK_EQUAL(text,
+                    "// Keep me.\n"
+                    "#define VERSION_MAJOR 1 /* major */\n"
+                    "#define VERSION_MINOR\t7\n"
+                    "#define VERSION_BUILD 999\n"
+                    "#define VERSION_STRING \"1.7.999.3\"\n"
+                    "// Keep me too.\n");
+
+  vi.set_build(1000);
+  BOOST_REQUIRE(transform.write(vi));
+  BOOST_REQUIRE(transform.read(back));
+  BOOST_CHECK_EQUAL(back.get_minor(), 7);
+  BOOST_CHECK_EQUAL(back.get_build(), 1000);
+
+  vi.set_build(5);
+  BOOST_REQUIRE(transform.write(vi));
+
+  {
+    ifstream strm(path);
+
+    text.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+  }
+
+  BOOST_CHECK_EQUAL(text,
+                    "// Keep me.\n"
+                    "#define VERSION_MAJOR 1 /* major */\n"
+                    "#define VERSION_MINOR\t7\n"
+                    "#define VERSION_BUILD 5\n"
+                    "#define VERSION_STRING \"1.7.5.3\"\n"
+                    "// Keep me too.\n");
+}
+
+BOOST_AUTO_TEST_CASE(cxx17_update_in_place)
+{
+  TempDir     tmp("transform");
+  fs::path    path = tmp / "cxx17.h";
+  CTransform  transform;
+  VersionInfo vi(1, 2, 3, 4, 2015, IncrementType::Simple);
+  VersionInfo back;
+  Config      conf;
+  string      text;
+
+  conf.groups = OutputGroups::Struct | OutputGroups::Cxx17;
+  conf.prefix = "my_";
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+  BOOST_REQUIRE(transform.write(vi));
+
+  {
+    ifstream strm(path);
+
+    text.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+  }
+
+  BOOST_CHECK(text.find("inline constexpr my_Version_t my_Version = {")
+              != string::npos);
+  BOOST_CHECK(text.find("constexpr const char *my_versionString()")
+              != string::npos);
+
+  // Both initialisers must be rewritten, not just the first.
+  conf.update = true;
+  transform.set_config(conf);
+  transform.set_filename(path.string());
+  vi.set_build(12345);
+  BOOST_REQUIRE(transform.write(vi));
+
+  {
+    ifstream strm(path);
+
+    text.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+  }
+
+  BOOST_CHECK(text.find("    3,\n") == string::npos);
+  BOOST_CHECK(text.find("    12345,\n") != text.rfind("    12345,\n"));
+
+  BOOST_REQUIRE(transform.read(back));
+  BOOST_CHECK(back == vi);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// Transform_test.cpp ends here.
@@ -0,0 +1,190 @@
+//
+// VersionConstraint_test.cpp --- Version constraint tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 15:03:18
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionConstraint_test.cpp
+ * @author Paul Ward
+ * @brief Version constraint tests.
+ */
+
+#define BOOST_TEST_MODULE VersionConstraint_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../verbuild/VersionConstraint.hpp"
+
+using namespace std;
+
+static
+VersionKey
+key(const char *text)
+{
+  VersionKey k;
+
+  BOOST_REQUIRE(parse_version_key(text, k));
+
+  return k;
+}
+
+static
+bool
+check(const string &expr, const char *version)
+{
+  VersionConstraint c;
+
+  BOOST_REQUIRE_MESSAGE(c.parse(expr), expr << ": " << c.get_error());
+
+  return c.matches(key(version));
+}
+
+BOOST_AUTO_TEST_CASE(version_keys)
+{
+  VersionKey k;
+
+  BOOST_CHECK(key("1") == VersionKey::make(1, 0, 0, 0));
+  BOOST_CHECK(key("1.2.3.4") == VersionKey::make(1, 2, 3, 4));
+  BOOST_CHECK(!parse_version_key("1.2.3.4.5", k));
+  BOOST_CHECK(!parse_version_key("1..2", k));
+  BOOST_CHECK(!parse_version_key("1.2.", k));
+  BOOST_CHECK(!parse_version_key("4294967296", k));
+  BOOST_CHECK(!parse_version_key("", k));
+}
+
+BOOST_AUTO_TEST_CASE(comparators)
+{
+  BOOST_CHECK(check("1.2", "1.2.5.9"));
+  BOOST_CHECK(!check("1.2", "1.3"));
+  BOOST_CHECK(check("=1.2.3.4", "1.2.3.4"));
+  BOOST_CHECK(!check("=1.2.3.4", "1.2.3.5"));
+  BOOST_CHECK(check("!=1.2", "1.3"));
+  BOOST_CHECK(!check("!=1.2", "1.2.0.1"));
+  BOOST_CHECK(check("<1.2", "1.1.99"));
+  BOOST_CHECK(!check("<1.2", "1.2"));
+  BOOST_CHECK(check("<=1.2", "1.2.9.9"));
+  BOOST_CHECK(!check("<=1.2", "1.3"));
+  BOOST_CHECK(check(">1.2", "1.3"));
+  BOOST_CHECK(!check(">1.2", "1.2.9"));
+  BOOST_CHECK(check(">= 1.2", "1.2"));
+  BOOST_CHECK(!check(">=1.2", "1.1.9"));
+  BOOST_CHECK(check("*", "0"));
+  BOOST_CHECK(check("", "7.7.7.7"));
+  BOOST_CHECK(!check("<0", "0"));
+}
+
+BOOST_AUTO_TEST_CASE(tilde_and_caret)
+{
+  BOOST_CHECK(check("~1.2.3", "1.2.9"));
+  BOOST_CHECK(!check("~1.2.3", "1.3.0"));
+  BOOST_CHECK(!check("~1.2.3", "1.2.2"));
+  BOOST_CHECK(check("~1", "1.9"));
+  BOOST_CHECK(!check("~1", "2"));
+  BOOST_CHECK(check("^1.2.3", "1.9"));
+  BOOST_CHECK(!check("^1.2.3", "2.0"));
+  BOOST_CHECK(check("^0.2.3", "0.2.9"));
+  BOOST_CHECK(!check("^0.2.3", "0.3"));
+  BOOST_CHECK(check("^0.0.3", "0.0.3.7"));
+  BOOST_CHECK(!check("^0.0.3", "0.0.4"));
+  BOOST_CHECK(check("^0.0", "0.0.9"));
+  BOOST_CHECK(!check("^0.0", "0.1"));
+  BOOST_CHECK(check("^4294967295.1", "4294967295.9"));
+}
+
+BOOST_AUTO_TEST_CASE(compound)
+{
+  VersionConstraint c;
+  string            expr(">=1.2.0 <2.0.0 || ~3.4");
+
+  BOOST_REQUIRE(c.parse(expr));
+  BOOST_CHECK_EQUAL(c.get_intervals().size(), 2U);
+  BOOST_CHECK(c.matches(key("1.2")));
+  BOOST_CHECK(c.matches(key("1.99.99.99")));
+  BOOST_CHECK(!c.matches(key("2.0")));
+  BOOST_CHECK(c.matches(key("3.4.7")));
+  BOOST_CHECK(!c.matches(key("3.5")));
+
+  BOOST_CHECK(check("1.2 - 1.4", "1.4.9"));
+  BOOST_CHECK(!check("1.2 - 1.4", "1.5"));
+  BOOST_CHECK(!check("1.2 - 1.4", "1.1"));
+
+  // Touching alternatives merge into one interval.
+  BOOST_REQUIRE(c.parse("1.2 || 1.3 || >=1.4 <1.5 || 9"));
+  BOOST_CHECK_EQUAL(c.get_intervals().size(), 2U);
+
+  // Contradictions compile to nothing.
+  BOOST_REQUIRE(c.parse(">2 <1"));
+  BOOST_CHECK(c.get_intervals().empty());
+}
+
+BOOST_AUTO_TEST_CASE(errors)
+{
+  VersionConstraint c;
+
+  for (const char *expr : { ">=", "1.2 |", "1.x.3", "1.2.3.4.5", ">=a",
+                            "1.2 - ", "1.2 | 1.3" }) {
+    BOOST_CHECK_MESSAGE(!c.parse(expr), expr);
+    BOOST_CHECK(!c.get_error().empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(batch)
+{
+  VersionConstraint c;
+  mt19937           rng(9);
+  VersionKeyVector  keys(10000);
+  vector<uint8_t>   hits(keys.size());
+  size_t            want = 0;
+
+  BOOST_REQUIRE(c.parse(">=1.2.0 <2.0.0 || ~3.4 || 5.1.7.x"));
+
+  for (auto &it : keys) {
+    it = VersionKey::make(rng() % 6, rng() % 8, rng() % 10, rng() % 2);
+  }
+
+  for (auto &it : keys) {
+    uint32_t ma = it.get_major();
+    uint32_t mi = it.get_minor();
+
+    want += (ma == 1 && mi >= 2) ||
+            (ma == 3 && mi == 4) ||
+            (ma == 5 && mi == 1 && it.get_build() == 7);
+  }
+
+  BOOST_CHECK_EQUAL(c.match(keys.data(), keys.size(), hits.data()), want);
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    BOOST_CHECK_EQUAL(hits[i] != 0, c.matches(keys[i]));
+  }
+}
+
+// VersionConstraint_test.cpp ends here.
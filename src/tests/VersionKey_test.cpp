@@ -0,0 +1,137 @@
+//
+// VersionKey_test.cpp --- Packed version key tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 14:02:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionKey_test.cpp
+ * @author Paul Ward
+ * @brief Packed version key tests.
+ */
+
+#define BOOST_TEST_MODULE VersionKey_test
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "../verbuild/VersionKey.hpp"
+#include "../verbuild/VersionInfo.hpp"
+
+using namespace std;
+
+BOOST_AUTO_TEST_CASE(packing)
+{
+  constexpr VersionKey key = VersionKey::make(1, 2, 3, 4);
+  VersionInfo          vi(1, 2, 3, 4, 2013, IncrementType::Simple);
+  stringstream         ss;
+
+  static_assert(key.get_major() == 1 && key.get_patch() == 4,
+                "keys are usable in constant expressions");
+
+  BOOST_CHECK_EQUAL(key.get_minor(), 2U);
+  BOOST_CHECK_EQUAL(key.get_build(), 3U);
+  BOOST_CHECK(vi.to_key() == key);
+
+  ss << VersionKey::make(4294967295U, 0, 1058, 2);
+  BOOST_CHECK_EQUAL(ss.str(), "4294967295.0.1058.2");
+}
+
+BOOST_AUTO_TEST_CASE(ordering)
+{
+  VersionKey a = VersionKey::make(1, 2, 3, 4);
+  VersionKey b = VersionKey::make(1, 2, 3, 5);
+  VersionKey c = VersionKey::make(1, 3, 0, 0);
+  VersionKey d = VersionKey::make(2, 0, 0, 0);
+
+  BOOST_CHECK(a < b && b < c && c < d);
+  BOOST_CHECK(d > a && a <= a && a >= a);
+  BOOST_CHECK(a != b && !(a == b));
+  BOOST_CHECK(VersionKey::make(0, 4294967295U, 0, 0) < c);
+}
+
+static
+VersionKeyVector
+random_keys(size_t count, mt19937 &rng)
+{
+  VersionKeyVector keys(count);
+
+  // Few majors and minors, many builds and the odd wide value, as in
+  // real artifact stores.
+  for (auto &it : keys) {
+    it = VersionKey::make(rng() % 3,
+                          rng() % 20,
+                          (rng() % 100 == 0) ? rng() : rng() % 5000,
+                          rng() % 2);
+  }
+
+  return keys;
+}
+
+BOOST_AUTO_TEST_CASE(sorting)
+{
+  mt19937 rng(7);
+
+  for (size_t count : { 0, 1, 17, 255, 256, 1000, 100000 }) {
+    VersionKeyVector keys = random_keys(count, rng);
+    VersionKeyVector want = keys;
+
+    sort(want.begin(), want.end());
+    sort_version_keys(keys.data(), keys.size());
+
+    BOOST_CHECK(keys == want);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(unique_and_minmax)
+{
+  mt19937          rng(11);
+  VersionKeyVector keys = random_keys(50000, rng);
+  VersionKey       lowest;
+  VersionKey       highest;
+  size_t           count;
+
+  BOOST_CHECK(!minmax_version_keys(keys.data(), 0, lowest, highest));
+  BOOST_CHECK(minmax_version_keys(keys.data(), keys.size(),
+                                  lowest, highest));
+  BOOST_CHECK(lowest == *min_element(keys.begin(), keys.end()));
+  BOOST_CHECK(highest == *max_element(keys.begin(), keys.end()));
+
+  sort_version_keys(keys.data(), keys.size());
+  count = unique_version_keys(keys.data(), keys.size());
+
+  BOOST_CHECK(count < keys.size());
+  BOOST_CHECK(adjacent_find(keys.begin(), keys.begin() + count) ==
+              keys.begin() + count);
+  BOOST_CHECK(keys[0] == lowest);
+  BOOST_CHECK(keys[count - 1] == highest);
+}
+
+// VersionKey_test.cpp ends here.
@@ -0,0 +1,226 @@
+//
+// VersionScanner_test.cpp --- Version string scanner tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 10:40:09
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionScanner_test.cpp
+ * @author Paul Ward
+ * @brief Version string scanner tests.
+ */
+
+#define BOOST_TEST_MODULE VersionScanner_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../verbuild/VersionScanner.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+static
+string
+render(const VersionMatchVector &matches)
+{
+  string out;
+
+  for (auto &it : matches) {
+    out += to_string(it.offset) + ":" +
+           to_string(it.major) + "." + to_string(it.minor) + "." +
+           to_string(it.build) + "." + to_string(it.patch) + " ";
+  }
+
+  return out;
+}
+
+/*
+ * The obvious way: split into runs of digits and dots, trim the dots
+ * and check for four numbers.
+ */
+static
+string
+reference(const string &text)
+{
+  VersionMatchVector out;
+  size_t             i = 0;
+
+  while (i < text.size()) {
+    size_t end;
+
+    if (!isdigit(static_cast<unsigned char>(text[i])) && text[i] != '.') {
+      i++;
+      continue;
+    }
+
+    for (end = i;
+         end < text.size() &&
+           (isdigit(static_cast<unsigned char>(text[end])) || text[end] == '.');
+         end++) {
+    }
+
+    if (end - i <= VSCAN_MAX_RUN) {
+      size_t         b = i;
+      size_t         e = end;
+      vector<string> parts(1);
+      bool           ok = true;
+
+      while (b < e && text[b] == '.') {
+        b++;
+      }
+
+      while (e > b && text[e - 1] == '.') {
+        e--;
+      }
+
+      for (size_t k = b; k < e; k++) {
+        if (text[k] == '.') {
+          parts.emplace_back();
+        } else {
+          parts.back() += text[k];
+        }
+      }
+
+      ok = (e > b) && parts.size() == 4;
+
+      for (auto &p : parts) {
+        size_t z = p.find_first_not_of('0');
+        string digits = (z == string::npos) ? "0" : p.substr(z);
+
+        ok = ok && !p.empty() &&
+             (digits.size() < 10 ||
+              (digits.size() == 10 && digits <= "4294967295"));
+      }
+
+      if (ok) {
+        out.push_back({ b,
+                        static_cast<uint32_t>(stoul(parts[0])),
+                        static_cast<uint32_t>(stoul(parts[1])),
+                        static_cast<uint32_t>(stoul(parts[2])),
+                        static_cast<uint32_t>(stoul(parts[3])) });
+      }
+    }
+
+    i = end;
+  }
+
+  return render(out);
+}
+
+static
+string
+scan(const string &text)
+{
+  VersionMatchVector out;
+
+  VersionScanner::scan(text.data(), text.size(), out);
+
+  return render(out);
+}
+
+BOOST_AUTO_TEST_CASE(simple)
+{
+  BOOST_CHECK_EQUAL(scan("built 1.2.3.4 ok"), "6:1.2.3.4 ");
+  BOOST_CHECK_EQUAL(scan("1.2.3.4"), "0:1.2.3.4 ");
+  BOOST_CHECK_EQUAL(scan("v10.0.601.2."), "1:10.0.601.2 ");
+  BOOST_CHECK_EQUAL(scan("lib.so.1.2.3.4"), "7:1.2.3.4 ");
+  BOOST_CHECK_EQUAL(scan("a 1.2.3 b 1.2.3.4.5 c 1..2.3.4"), "");
+  BOOST_CHECK_EQUAL(scan("4294967295.0.0.1 4294967296.0.0.1"),
+                    "0:4294967295.0.0.1 ");
+  BOOST_CHECK_EQUAL(scan(""), "");
+}
+
+BOOST_AUTO_TEST_CASE(long_input)
+{
+  string text(10000, 'x');
+  string want;
+
+  // Matches on either side of every block boundary.
+  for (size_t at = 50; at + 16 < text.size(); at += 61) {
+    text.replace(at, 7, "1.2.3.4");
+    want += to_string(at) + ":1.2.3.4 ";
+  }
+
+  BOOST_CHECK_EQUAL(scan(text), want);
+}
+
+BOOST_AUTO_TEST_CASE(chunked)
+{
+  mt19937      rng(42);
+  const string alphabet("0123456789......./- x\n");
+
+  for (unsigned round = 0; round < 200; round++) {
+    string             text(1 + rng() % 2000, ' ');
+    VersionScanner     scanner;
+    VersionMatchVector out;
+
+    for (auto &c : text) {
+      c = alphabet[rng() % alphabet.size()];
+    }
+
+    for (size_t pos = 0; pos < text.size(); ) {
+      size_t n = min<size_t>(text.size() - pos, 1 + rng() % 150);
+
+      scanner.feed(text.data() + pos, n, out);
+      pos += n;
+    }
+
+    scanner.finish(out);
+
+    BOOST_CHECK_EQUAL(render(out), reference(text));
+    BOOST_CHECK_EQUAL(scan(text), reference(text));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(file)
+{
+  TempDir            tmp("scan");
+  string             path((tmp / "scan.log").string());
+  VersionMatchVector out;
+
+  {
+    ofstream strm(path, ios::binary);
+
+    strm << "[12:00:01] starting build\n"
+         << "[12:00:09] built component 3.1.1058.0\n";
+  }
+
+  BOOST_CHECK(VersionScanner::scan_file(path, out));
+  BOOST_CHECK_EQUAL(render(out), "53:3.1.1058.0 ");
+
+  fs::remove(path);
+  BOOST_CHECK(!VersionScanner::scan_file(path, out));
+}
+
+// VersionScanner_test.cpp ends here.
@@ -0,0 +1,142 @@
+//
+// VersionValue_test.cpp --- Plain version value tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:05:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionValue_test.cpp
+ * @author Paul Ward
+ * @brief Plain version value tests.
+ */
+
+#define BOOST_TEST_MODULE VersionValue_test
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include "../verbuild/VersionValue.hpp"
+#include "../verbuild/VersionInfo.hpp"
+
+using namespace std;
+
+static constexpr VersionDate TODAY = { 2026, 10, 19 };
+
+static constexpr
+VersionValue
+bumped(VersionValue v, IncrementMode mode)
+{
+  v.increment(mode, TODAY);
+
+  return v;
+}
+
+BOOST_AUTO_TEST_CASE(constant_expressions)
+{
+  constexpr VersionValue v = { 1, 2, 3, 4, 2013, IncrementType::Simple };
+  constexpr VersionValue n = bumped(v, IncrementMode::MinorBuildAndPatch);
+
+  static_assert(n.major == 1 && n.minor == 3, "minor is bumped");
+  static_assert(n.build == 4 && n.patch == 5, "build and patch are bumped");
+  static_assert(v < n && n > v && v != n, "compare at compile time");
+  static_assert(bumped(v, IncrementMode::None) == v, "None is a no-op");
+
+  BOOST_CHECK(n.to_key() == VersionKey::make(1, 3, 4, 5));
+}
+
+BOOST_AUTO_TEST_CASE(plain_data)
+{
+  VersionValue         v = { 5, 6, 7, 8, 2000, IncrementType::ByDate };
+  VersionValue         w;
+  vector<VersionValue> vec(3, v);
+  stringstream         ss;
+
+  ::memcpy(&w, &v, sizeof(w));
+  BOOST_CHECK(w == v);
+  BOOST_CHECK_EQUAL(w.base_year, 2000U);
+  BOOST_CHECK(w.type == IncrementType::ByDate);
+
+  vec[1].patch = 9;
+  BOOST_CHECK(vec[0] == vec[2] && vec[0] < vec[1]);
+
+  ss << v;
+  BOOST_CHECK_EQUAL(ss.str(), "5.6.7.8");
+}
+
+BOOST_AUTO_TEST_CASE(date_builds)
+{
+  VersionValue v = { 1, 0, 0, 0, 2013, IncrementType::ByDate };
+
+  BOOST_CHECK(v.perform(TODAY) == VersionStatus::Ok);
+  BOOST_CHECK_EQUAL(v.build, 20261019U);
+
+  v.type = IncrementType::ByYears;
+  BOOST_CHECK(v.perform(TODAY) == VersionStatus::Ok);
+  BOOST_CHECK_EQUAL(v.build, 131019U);
+
+  v.type = IncrementType::ByMonths;
+  BOOST_CHECK(v.perform(TODAY) == VersionStatus::Ok);
+  BOOST_CHECK_EQUAL(v.build, (13U * 12 + 10) * 100 + 19);
+
+  // Before the base year there is no sensible build number.
+  v.base_year = 2030;
+  BOOST_CHECK(v.perform(TODAY) == VersionStatus::OutOfRange);
+  BOOST_CHECK_EQUAL(v.build, 0U);
+}
+
+BOOST_AUTO_TEST_CASE(saturation_and_policy)
+{
+  VersionValue v = { UINT32_MAX, 0, 41, UINT32_MAX, 0, IncrementType::GitSha };
+
+  BOOST_CHECK(v.increment(IncrementMode::All, TODAY)
+              == VersionStatus::NeedsPolicy);
+  BOOST_CHECK_EQUAL(v.major, UINT32_MAX);
+  BOOST_CHECK_EQUAL(v.minor, 1U);
+  BOOST_CHECK_EQUAL(v.build, 41U);
+  BOOST_CHECK_EQUAL(v.patch, UINT32_MAX);
+}
+
+BOOST_AUTO_TEST_CASE(wrapper)
+{
+  VersionValue v = { 1, 2, 3, 4, 0, IncrementType::Simple };
+  VersionInfo  vi(v);
+  VersionInfo  other(1, 2, 3, 4, 0, IncrementType::Simple);
+
+  BOOST_CHECK(vi == other);
+
+  vi.increment(IncrementMode::BuildAndPatch);
+  BOOST_CHECK(vi != other);
+  BOOST_CHECK(vi.get_value() == bumped(v, IncrementMode::BuildAndPatch));
+
+  other.set_value(vi.get_value());
+  BOOST_CHECK(vi == other);
+  BOOST_CHECK_EQUAL(other.to_string(), "1.2.4.5");
+}
+
+// VersionValue_test.cpp ends here.
@@ -0,0 +1,176 @@
+//
+// Watcher_test.cpp --- File change notification tests.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 22:58:36
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Watcher_test.cpp
+ * @author Paul Ward
+ * @brief File change notification tests.
+ */
+
+#define BOOST_TEST_MODULE Watcher_test
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "../verbuild/Watcher.hpp"
+#include "TempDir.hpp"
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#if PLATFORM_EQ(PLATFORM_LINUX)
+
+/*
+ * Just enough of a git directory to watch.
+ */
+struct WatchDir
+  : public TempDir
+{
+  WatchDir()
+    : TempDir("watch")
+  {
+    fs::create_directories(path / "refs" / "heads");
+  }
+};
+
+/*
+ * Replace a file the way git does: write a lock file, then rename it.
+ */
+static
+void
+git_write(const fs::path &path, const string &text)
+{
+  fs::path lock(path.string() + ".lock");
+
+  ofstream(lock) << text;
+  fs::rename(lock, path);
+}
+
+BOOST_AUTO_TEST_SUITE(Watcher_test_suite)
+
+BOOST_AUTO_TEST_CASE(file_replaced)
+{
+  WatchDir dir;
+  Watcher  watcher;
+
+  git_write(dir.path / "HEAD", "ref: refs/heads/main\n");
+
+  BOOST_REQUIRE(watcher.open());
+  BOOST_REQUIRE(watcher.add_file((dir.path / "HEAD").string()));
+
+  thread writer([&]() {
+    this_thread::sleep_for(chrono::milliseconds(20));
+
+    // Neither an unrelated file nor a stray lock file counts.
+    ofstream(dir.path / "config") << "[core]\n";
+    ofstream(dir.path / "HEAD.lock") << "x";
+    fs::remove(dir.path / "HEAD.lock");
+
+    git_write(dir.path / "HEAD", "ref: refs/heads/other\n");
+  });
+
+  BOOST_CHECK(watcher.wait(50));
+  writer.join();
+
+  // The watch survives the rename, so a second change is seen too.
+  writer = thread([&]() {
+    this_thread::sleep_for(chrono::milliseconds(20));
+    git_write(dir.path / "HEAD", "ref: refs/heads/main\n");
+  });
+
+  BOOST_CHECK(watcher.wait(50));
+  writer.join();
+}
+
+BOOST_AUTO_TEST_CASE(burst_coalesces)
+{
+  WatchDir dir;
+  Watcher  watcher;
+  auto     start = chrono::steady_clock::now();
+
+  BOOST_REQUIRE(watcher.open());
+  BOOST_REQUIRE(watcher.add_tree((dir.path / "refs").string()));
+
+  thread writer([&]() {
+    for (int i = 0; i < 5; i++) {
+      git_write(dir.path / "refs" / "heads" / ("b" + to_string(i)), "x\n");
+      this_thread::sleep_for(chrono::milliseconds(30));
+    }
+  });
+
+  // Changes 30 ms apart keep a 100 ms debounce from expiring until
+  // the last one.
+  BOOST_CHECK(watcher.wait(100));
+  BOOST_CHECK(chrono::steady_clock::now() - start >=
+              chrono::milliseconds(220));
+  writer.join();
+  watcher.drain();
+}
+
+BOOST_AUTO_TEST_CASE(new_directories)
+{
+  WatchDir dir;
+  Watcher  watcher;
+  size_t   before;
+
+  BOOST_REQUIRE(watcher.open());
+  BOOST_REQUIRE(watcher.add_tree((dir.path / "refs").string()));
+  before = watcher.get_watch_count();
+
+  fs::create_directories(dir.path / "refs" / "tags");
+  BOOST_CHECK(watcher.wait(10));
+  BOOST_CHECK_EQUAL(watcher.get_watch_count(), before + 1);
+
+  thread writer([&]() {
+    this_thread::sleep_for(chrono::milliseconds(20));
+    git_write(dir.path / "refs" / "tags" / "v1", "x\n");
+  });
+
+  BOOST_CHECK(watcher.wait(10));
+  writer.join();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#else
+
+BOOST_AUTO_TEST_CASE(unsupported)
+{
+  Watcher watcher;
+
+  BOOST_CHECK(!watcher.open());
+}
+
+#endif
+
+// Watcher_test.cpp ends here.
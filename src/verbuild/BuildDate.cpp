@@ -0,0 +1,288 @@
+//
+// BuildDate.cpp --- Batch build number to date decoding.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:10:48
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file BuildDate.cpp
+ * @author Paul Ward
+ * @brief Batch build number to date decoding.
+ */
+
+#include "BuildDate.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace std;
+
+std::ostream &
+operator<<(std::ostream &os, const BuildDateStatus &status)
+{
+  switch (status) {
+    case BuildDateStatus::Ok:       os << "ok";        break;
+    case BuildDateStatus::NoDate:   os << "no date";   break;
+    case BuildDateStatus::BadYear:  os << "bad year";  break;
+    case BuildDateStatus::BadMonth: os << "bad month"; break;
+    case BuildDateStatus::BadDay:   os << "bad day";   break;
+  }
+
+  return os;
+}
+
+/*
+ * Everything below is straight-line integer arithmetic so that the
+ * per-type loops in `decode_build_dates' can be vectorised; the
+ * ternaries compile to selects rather than branches.
+ */
+
+static inline
+int32_t
+month_days(int32_t year, int32_t month)
+{
+  int32_t leap = ((year % 4 == 0) & (year % 100 != 0)) | (year % 400 == 0);
+
+  // 31 for odd months up to July and even months from August on.
+  return (month == 2) ? 28 + leap : 30 + ((month ^ (month >> 3)) & 1);
+}
+
+static inline
+int32_t
+civil_days(int32_t year, int32_t month, int32_t day)
+{
+  int32_t era;
+  int32_t yoe;
+  int32_t doy;
+  int32_t doe;
+
+  // Rejected elements may reach -1 here; their result is discarded,
+  // so plain truncating `/' is fine.
+  year -= (month <= 2);
+  era   = year / 400;
+  yoe   = year - era * 400;
+  doy   = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  doe   = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+  return era * 146097 + doe - 719468;
+}
+
+/*
+ * `clamp' mirrors Boost's month arithmetic as used by the `bymonths'
+ * decoding: any day of January is valid and is then pulled back to
+ * the end of a shorter month.
+ */
+static inline
+void
+decode_one(uint32_t         build,
+           int32_t          year,
+           int32_t          month,
+           int32_t          day,
+           bool             clamp,
+           int32_t         &days,
+           BuildDateStatus &status)
+{
+  int32_t dim       = month_days(year, month);
+  bool    bad_year  = (year < BUILD_DATE_MIN_YEAR) |
+                      (year > BUILD_DATE_MAX_YEAR);
+  bool    bad_month = static_cast<uint32_t>(month - 1) >= 12;
+  bool    bad_day;
+
+  if (clamp) {
+    bad_day = static_cast<uint32_t>(day - 1) >= 31;
+    day     = min(day, dim);
+  } else {
+    bad_day = static_cast<uint32_t>(day - 1) >= static_cast<uint32_t>(dim);
+  }
+
+  status = (build == 0) ? BuildDateStatus::NoDate
+         : bad_year     ? BuildDateStatus::BadYear
+         : bad_month    ? BuildDateStatus::BadMonth
+         : bad_day      ? BuildDateStatus::BadDay
+         :                BuildDateStatus::Ok;
+  days   = (status == BuildDateStatus::Ok)
+         ? civil_days(year, month, day)
+         : 0;
+}
+
+/**
+ * @brief Decode an array of build numbers to dates.
+ * @param type The increment type the numbers were generated with.
+ * @param base_year The base year they were generated with.
+ * @param builds The build numbers.
+ * @param count Number of build numbers.
+ * @param days Receives each date as days since 1970-01-01, or 0.
+ * @param status Receives each number's status.
+ * @returns The number of elements whose status is not @c Ok.
+ *
+ * Types that do not encode a date, a zero base year and zero build
+ * numbers all give @c BuildDateStatus::NoDate.
+ */
+size_t
+decode_build_dates(IncrementType    type,
+                   uint32_t         base_year,
+                   const uint32_t  *builds,
+                   size_t           count,
+                   int32_t         *days,
+                   BuildDateStatus *status)
+{
+  size_t  failed = 0;
+  int32_t base;
+
+  if (base_year == 0 ||
+      (type != IncrementType::ByDate &&
+       type != IncrementType::ByYears &&
+       type != IncrementType::ByMonths)) {
+    fill(days, days + count, 0);
+    fill(status, status + count, BuildDateStatus::NoDate);
+    return count;
+  }
+
+  // Anything past the limit is a bad year anyway; this keeps the sums
+  // below in range.
+  base = static_cast<int32_t>(min<uint32_t>(base_year, BUILD_DATE_MAX_YEAR + 1));
+
+  switch (type) {
+    case IncrementType::ByDate:
+      for (size_t i = 0; i < count; i++) {
+        uint32_t b = builds[i];
+
+        decode_one(b,
+                   static_cast<int32_t>(b / 10000),
+                   static_cast<int32_t>(b / 100 % 100),
+                   static_cast<int32_t>(b % 100),
+                   false,
+                   days[i],
+                   status[i]);
+      }
+      break;
+
+    case IncrementType::ByYears:
+      for (size_t i = 0; i < count; i++) {
+        uint32_t b = builds[i];
+
+        decode_one(b,
+                   base + static_cast<int32_t>(b / 10000),
+                   static_cast<int32_t>(b / 100 % 100),
+                   static_cast<int32_t>(b % 100),
+                   false,
+                   days[i],
+                   status[i]);
+      }
+      break;
+
+    case IncrementType::ByMonths:
+      // Month 0 is December of the year before, as with `to_date'.
+      for (size_t i = 0; i < count; i++) {
+        uint32_t b = builds[i];
+        uint32_t m = b / 100 + 11;
+
+        decode_one(b,
+                   base + static_cast<int32_t>(m / 12) - 1,
+                   static_cast<int32_t>(m % 12) + 1,
+                   static_cast<int32_t>(b % 100),
+                   true,
+                   days[i],
+                   status[i]);
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    failed += (status[i] != BuildDateStatus::Ok);
+  }
+
+  return failed;
+}
+
+/**
+ * @brief Decode a single build number.
+ * @see decode_build_dates
+ */
+BuildDateStatus
+decode_build_date(IncrementType  type,
+                  uint32_t       base_year,
+                  uint32_t       build,
+                  int32_t       &days)
+{
+  BuildDateStatus status;
+
+  decode_build_dates(type, base_year, &build, 1, &days, &status);
+
+  return status;
+}
+
+/**
+ * @brief Convert a Gregorian date to days since 1970-01-01.
+ */
+int32_t
+days_from_civil(int year, unsigned month, unsigned day)
+{
+  return civil_days(year,
+                    static_cast<int32_t>(month),
+                    static_cast<int32_t>(day));
+}
+
+/**
+ * @brief Convert days since 1970-01-01 to a Gregorian date.
+ */
+void
+civil_from_days(int32_t days, int &year, unsigned &month, unsigned &day)
+{
+  int32_t  z   = days + 719468;
+  int32_t  era = (z >= 0 ? z : z - 146096) / 146097;
+  uint32_t doe = static_cast<uint32_t>(z - era * 146097);
+  uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  uint32_t mp  = (5 * doy + 2) / 153;
+
+  day   = doy - (153 * mp + 2) / 5 + 1;
+  month = (mp < 10) ? mp + 3 : mp - 9;
+  year  = static_cast<int>(yoe) + era * 400 + (month <= 2);
+}
+
+/**
+ * @brief Format days since 1970-01-01 as YYYY-MM-DD.
+ */
+string
+format_build_date(int32_t days)
+{
+  char     buf[32];
+  int      year;
+  unsigned month;
+  unsigned day;
+
+  civil_from_days(days, year, month, day);
+  snprintf(buf, sizeof(buf), "%04d-%02u-%02u", year, month, day);
+
+  return string(buf);
+}
+
+// BuildDate.cpp ends here.
@@ -0,0 +1,93 @@
+//
+// BuildDate.hpp --- Batch build number to date decoding.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:02:17
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file BuildDate.hpp
+ * @author Paul Ward
+ * @brief Batch build number to date decoding.
+ *
+ * Decodes arrays of date-based build numbers with integer arithmetic
+ * alone.  Each element gets its own status, so one bad number does
+ * not stop the batch.  Dates are returned as days since 1970-01-01.
+ */
+
+#pragma once
+#ifndef _BuildDate_hpp_
+#define _BuildDate_hpp_
+
+#include "Support.hpp"
+#include "Enums.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/**
+ * @def BUILD_DATE_MIN_YEAR
+ * @brief Earliest year a build number may decode to.
+ */
+#define BUILD_DATE_MIN_YEAR 1400
+
+/**
+ * @def BUILD_DATE_MAX_YEAR
+ * @brief Latest year a build number may decode to.
+ */
+#define BUILD_DATE_MAX_YEAR 9999
+
+enum class BuildDateStatus : std::uint8_t {
+  Ok       = 0,
+  NoDate,                       //!< Zero build or base year, or no date type.
+  BadYear,
+  BadMonth,
+  BadDay,
+};
+
+std::ostream &operator<<(std::ostream &, const BuildDateStatus &);
+
+std::size_t decode_build_dates(IncrementType,
+                               std::uint32_t,
+                               const std::uint32_t *,
+                               std::size_t,
+                               std::int32_t *,
+                               BuildDateStatus *);
+
+BuildDateStatus decode_build_date(IncrementType,
+                                  std::uint32_t,
+                                  std::uint32_t,
+                                  std::int32_t &);
+
+std::int32_t days_from_civil(int, unsigned, unsigned);
+void         civil_from_days(std::int32_t, int &, unsigned &, unsigned &);
+std::string  format_build_date(std::int32_t);
+
+#endif // !_BuildDate_hpp_
+
+// BuildDate.hpp ends here.
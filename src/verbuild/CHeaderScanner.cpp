@@ -0,0 +1,425 @@
+//
+// CHeaderScanner.cpp --- Incremental C header version scanner.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:10:27
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file CHeaderScanner.cpp
+ * @author Paul Ward
+ * @brief Incremental C header version scanner.
+ */
+
+#include "CHeaderScanner.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+#define DEFINE_MARKER     "VERSION_"
+#define DEFINE_MARKER_LEN 8
+
+#define NUMERIC_MASK ((1u << CHS_FIELDS) - 1)
+#define SPANS_MASK   ((1u << CHS_SPANS) - 1)
+
+// Struct initialisers list the base year first.
+static const CHeaderField struct_order[CHS_FIELDS] = {
+  CHeaderBaseYear,
+  CHeaderMajor,
+  CHeaderMinor,
+  CHeaderBuild,
+  CHeaderPatch
+};
+
+static const char *define_names[CHS_SPANS] = {
+  "MAJOR", "MINOR", "BUILD", "PATCH", "BASE_YEAR", "DATE", "TIME", "STRING"
+};
+
+static inline
+bool
+is_space(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+         c == '\f' || c == '\v';
+}
+
+static inline
+bool
+is_digit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+static inline
+bool
+is_word(char c)
+{
+  return is_digit(c) || c == '_' ||
+         (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+/*
+ * Accumulate a decimal digit, saturating just past UINT32_MAX so that
+ * oversized values can be rejected.
+ */
+static inline
+uint64_t
+accumulate(uint64_t value, char c)
+{
+  value = value * 10 + static_cast<uint64_t>(c - '0');
+
+  return (value > UINT32_MAX) ? static_cast<uint64_t>(UINT32_MAX) + 1 : value;
+}
+
+/**
+ * @brief Construct a scanner.
+ * @param spans Also record where each value lies.
+ *
+ * A span-tracking scanner keeps going until the quoted defines have
+ * been seen too, since they must be rewritten along with the numbers.
+ */
+CHeaderScanner::CHeaderScanner(bool spans)
+  : offset_(0),
+    spans_(spans),
+    def_state_(DefineSeek),
+    def_match_(0),
+    def_name_(),
+    def_name_len_(0),
+    def_value_(0),
+    def_start_(0),
+    def_mask_(0),
+    def_values_(),
+    def_spans_(),
+    st_state_(StructSeek),
+    st_count_(0),
+    st_value_(0),
+    st_start_(0),
+    st_run_values_(),
+    st_run_spans_(),
+    st_values_(),
+    st_spans_(),
+    st_complete_(false)
+{}
+
+/**
+ * @brief Scan the next piece of input.
+ * @returns The number of bytes consumed; less than @c len once done.
+ */
+size_t
+CHeaderScanner::feed(const char *data, size_t len)
+{
+  size_t i = 0;
+
+  while (i < len && !done()) {
+    step_define(data[i]);
+    step_struct(data[i]);
+    offset_++;
+    i++;
+  }
+
+  return i;
+}
+
+/**
+ * @brief Flush a value that runs up to the end of the input.
+ */
+void
+CHeaderScanner::finish()
+{
+  if (def_state_ == DefineDigits) {
+    emit_define(false);
+  }
+
+  def_state_ = DefineSeek;
+  def_match_ = 0;
+}
+
+bool
+CHeaderScanner::done() const
+{
+  // Initialisers may repeat, so only a full set of defines ends a
+  // span-tracking scan early.
+  if (spans_) {
+    return def_mask_ == SPANS_MASK;
+  }
+
+  return st_complete_ || (def_mask_ & NUMERIC_MASK) == NUMERIC_MASK;
+}
+
+bool
+CHeaderScanner::found() const
+{
+  return st_complete_ || (def_mask_ & NUMERIC_MASK) != 0;
+}
+
+uint64_t
+CHeaderScanner::get_offset() const
+{
+  return offset_;
+}
+
+/**
+ * @brief Store what was found in @c vi.
+ *
+ * A complete struct initialiser wins; otherwise each field seen in a
+ * define is set and the rest are left alone.
+ */
+void
+CHeaderScanner::apply(VersionInfo &vi) const
+{
+  const uint32_t *values = st_complete_ ? st_values_ : def_values_;
+  unsigned        mask   = st_complete_ ? NUMERIC_MASK : def_mask_;
+
+  if (mask & (1u << CHeaderMajor)) {
+    vi.set_major(values[CHeaderMajor]);
+  }
+
+  if (mask & (1u << CHeaderMinor)) {
+    vi.set_minor(values[CHeaderMinor]);
+  }
+
+  if (mask & (1u << CHeaderBuild)) {
+    vi.set_build(values[CHeaderBuild]);
+  }
+
+  if (mask & (1u << CHeaderPatch)) {
+    vi.set_patch(values[CHeaderPatch]);
+  }
+
+  if (mask & (1u << CHeaderBaseYear)) {
+    vi.set_base_year(values[CHeaderBaseYear]);
+  }
+}
+
+/**
+ * @brief Collect the spans of every value found, in file order.
+ *
+ * Only meaningful for a scanner constructed to track spans.
+ */
+void
+CHeaderScanner::get_spans(CHeaderSpanVector &spans) const
+{
+  spans.clear();
+
+  for (int i = 0; i < CHS_SPANS; i++) {
+    if (def_mask_ & (1u << i)) {
+      spans.push_back(def_spans_[i]);
+    }
+  }
+
+  spans.insert(spans.end(), st_spans_.begin(), st_spans_.end());
+
+  sort(spans.begin(), spans.end(), [](const CHeaderSpan &a,
+                                      const CHeaderSpan &b) {
+    return a.offset < b.offset;
+  });
+}
+
+void
+CHeaderScanner::step_define(char c)
+{
+  switch (def_state_) {
+    case DefineSeek:
+      if (c == DEFINE_MARKER[def_match_]) {
+        if (++def_match_ == DEFINE_MARKER_LEN) {
+          def_state_    = DefineName;
+          def_name_len_ = 0;
+        }
+      } else {
+        def_match_ = (c == DEFINE_MARKER[0]) ? 1 : 0;
+      }
+      break;
+
+    case DefineName:
+      if (is_word(c)) {
+        // Overlong names are kept as unknown rather than truncated.
+        if (def_name_len_ <= CHS_NAME_MAX) {
+          if (def_name_len_ < CHS_NAME_MAX) {
+            def_name_[def_name_len_] = c;
+          }
+          def_name_len_++;
+        }
+      } else if (is_space(c) && def_name_len_ > 0) {
+        def_state_ = DefineSpace;
+      } else {
+        def_state_ = DefineSeek;
+        def_match_ = 0;
+        step_define(c);
+      }
+      break;
+
+    case DefineSpace:
+      if (is_digit(c)) {
+        def_state_ = DefineDigits;
+        def_value_ = accumulate(0, c);
+        def_start_ = offset_;
+      } else if (c == '"' && spans_) {
+        def_state_ = DefineQuoted;
+        def_start_ = offset_ + 1;
+      } else if (!is_space(c)) {
+        def_state_ = DefineSeek;
+        def_match_ = 0;
+        step_define(c);
+      }
+      break;
+
+    case DefineDigits:
+      if (is_digit(c)) {
+        def_value_ = accumulate(def_value_, c);
+      } else {
+        emit_define(false);
+        def_state_ = DefineSeek;
+        def_match_ = 0;
+        step_define(c);
+      }
+      break;
+
+    case DefineQuoted:
+      if (c == '"') {
+        emit_define(true);
+        def_state_ = DefineSeek;
+        def_match_ = 0;
+      } else if (c == '\n' || c == '\\') {
+        // Escapes and unterminated strings are left alone.
+        def_state_ = DefineSeek;
+        def_match_ = 0;
+      }
+      break;
+  }
+}
+
+/*
+ * Record a define that has just ended at the current offset.  The
+ * first definition of each field wins.
+ */
+void
+CHeaderScanner::emit_define(bool quoted)
+{
+  int first = quoted ? CHS_FIELDS : 0;
+  int last  = quoted ? CHS_SPANS  : CHS_FIELDS;
+
+  if ((!quoted && def_value_ > UINT32_MAX) || def_name_len_ > CHS_NAME_MAX) {
+    return;
+  }
+
+  for (int i = first; i < last; i++) {
+    if (strlen(define_names[i]) == def_name_len_ &&
+        memcmp(define_names[i], def_name_, def_name_len_) == 0) {
+      if (def_mask_ & (1u << i)) {
+        return;
+      }
+
+      if (!quoted) {
+        def_values_[i] = static_cast<uint32_t>(def_value_);
+      }
+
+      def_spans_[i]  = CHeaderSpan { static_cast<CHeaderField>(i),
+                                     def_start_,
+                                     offset_ - def_start_ };
+      def_mask_     |= 1u << i;
+      return;
+    }
+  }
+}
+
+void
+CHeaderScanner::step_struct(char c)
+{
+  if (st_complete_ && !spans_) {
+    return;
+  }
+
+  switch (st_state_) {
+    case StructSeek:
+      if (c == '{') {
+        st_state_ = StructDigit;
+        st_count_ = 0;
+      }
+      break;
+
+    case StructDigit:
+      if (is_digit(c)) {
+        st_state_ = StructNumber;
+        st_value_ = accumulate(0, c);
+        st_start_ = offset_;
+      } else if (!is_space(c)) {
+        st_state_ = StructSeek;
+        step_struct(c);
+      }
+      break;
+
+    case StructNumber: {
+      CHeaderField field;
+
+      if (is_digit(c)) {
+        st_value_ = accumulate(st_value_, c);
+        break;
+      }
+
+      if (st_value_ > UINT32_MAX) {
+        st_state_ = StructSeek;
+        step_struct(c);
+        break;
+      }
+
+      field                 = struct_order[st_count_++];
+      st_run_values_[field] = static_cast<uint32_t>(st_value_);
+      st_run_spans_[field]  = CHeaderSpan { field,
+                                            st_start_,
+                                            offset_ - st_start_ };
+      st_state_             = StructSeparator;
+      step_struct(c);
+      break;
+    }
+
+    case StructSeparator:
+      if (is_space(c)) {
+        break;
+      }
+
+      if (c == ',' && st_count_ < CHS_FIELDS) {
+        st_state_ = StructDigit;
+      } else if (c == '}' && st_count_ == CHS_FIELDS) {
+        // The first initialiser supplies the values.
+        if (!st_complete_) {
+          copy(st_run_values_, st_run_values_ + CHS_FIELDS, st_values_);
+        }
+
+        st_spans_.insert(st_spans_.end(),
+                         st_run_spans_,
+                         st_run_spans_ + CHS_FIELDS);
+        st_complete_ = true;
+        st_state_    = StructSeek;
+      } else {
+        st_state_ = StructSeek;
+        step_struct(c);
+      }
+      break;
+  }
+}
+
+// CHeaderScanner.cpp ends here.
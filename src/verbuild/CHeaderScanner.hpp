@@ -0,0 +1,162 @@
+//
+// CHeaderScanner.hpp --- Incremental C header version scanner.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:02:44
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file CHeaderScanner.hpp
+ * @author Paul Ward
+ * @brief Incremental C header version scanner.
+ *
+ * Recognises the two forms the C transform writes:
+ *
+ *   #define <prefix>VERSION_<FIELD>  <digits>
+ *   { base_year, major, minor, build, patch }
+ *
+ * Input is fed a byte at a time through two small state machines, so a
+ * file can be read in chunks of any size without buffering lines, and
+ * scanning can stop as soon as every field has been seen.
+ *
+ * A scanner built to track spans also records where each value lies,
+ * including the quoted DATE, TIME and STRING defines, so that the
+ * values can be rewritten in place.  Since the struct and cxx17 groups
+ * each write an initialiser, it collects every complete initialiser
+ * rather than just the first.
+ */
+
+#pragma once
+#ifndef _CHeaderScanner_hpp_
+#define _CHeaderScanner_hpp_
+
+#include "Support.hpp"
+#include "VersionInfo.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @def CHS_FIELDS
+ * @brief Number of version fields: major, minor, build, patch, base year.
+ */
+#define CHS_FIELDS 5
+
+/**
+ * @def CHS_SPANS
+ * @brief Number of values whose spans are tracked.
+ */
+#define CHS_SPANS 8
+
+/**
+ * @def CHS_NAME_MAX
+ * @brief Longest field name kept after `VERSION_'.
+ */
+#define CHS_NAME_MAX 16
+
+enum CHeaderField : unsigned char {
+  CHeaderMajor = 0,
+  CHeaderMinor,
+  CHeaderBuild,
+  CHeaderPatch,
+  CHeaderBaseYear,
+  CHeaderDate,
+  CHeaderTime,
+  CHeaderString
+};
+
+struct CHeaderSpan
+{
+  CHeaderField  field;
+  std::uint64_t offset;         // First byte of the value.
+  std::uint64_t length;         // Length, excluding any quotes.
+};
+
+typedef std::vector<CHeaderSpan> CHeaderSpanVector;
+
+class CHeaderScanner
+{
+private:
+  enum DefineState : unsigned char {
+    DefineSeek,
+    DefineName,
+    DefineSpace,
+    DefineDigits,
+    DefineQuoted
+  };
+
+  enum StructState : unsigned char {
+    StructSeek,
+    StructDigit,
+    StructNumber,
+    StructSeparator
+  };
+
+  std::uint64_t offset_;
+  bool          spans_;
+
+  DefineState   def_state_;
+  std::size_t   def_match_;
+  char          def_name_[CHS_NAME_MAX];
+  std::size_t   def_name_len_;
+  std::uint64_t def_value_;
+  std::uint64_t def_start_;
+  unsigned      def_mask_;
+  std::uint32_t def_values_[CHS_FIELDS];
+  CHeaderSpan   def_spans_[CHS_SPANS];
+
+  StructState   st_state_;
+  std::size_t   st_count_;
+  std::uint64_t st_value_;
+  std::uint64_t st_start_;
+  std::uint32_t     st_run_values_[CHS_FIELDS];
+  CHeaderSpan       st_run_spans_[CHS_FIELDS];
+  std::uint32_t     st_values_[CHS_FIELDS];
+  CHeaderSpanVector st_spans_;
+  bool              st_complete_;
+
+public:
+  CHeaderScanner(bool = false);
+
+  std::size_t feed(const char *, std::size_t);
+  void        finish();
+
+  bool          done() const;
+  bool          found() const;
+  std::uint64_t get_offset() const;
+
+  void apply(VersionInfo &) const;
+  void get_spans(CHeaderSpanVector &) const;
+
+private:
+  void step_define(char);
+  void step_struct(char);
+  void emit_define(bool);
+};
+
+#endif // !_CHeaderScanner_hpp_
+
+// CHeaderScanner.hpp ends here.
@@ -0,0 +1,83 @@
+//
+// Command.cpp --- Sub-command registry.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 06:09:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Command.cpp
+ * @author Paul Ward
+ * @brief Sub-command registry.
+ */
+
+#include "Command.hpp"
+#include "Console.hpp"
+
+using namespace std;
+
+bool
+CommandFactory::register_command(const string &name,
+                                 const string &summary,
+                                 const Runner &fn)
+{
+  return entries_.insert(make_pair(name, Entry { summary, fn })).second;
+}
+
+const CommandFactory::Entry *
+CommandFactory::find(const string &name) const
+{
+  auto it = entries_.find(name);
+
+  DSAY(DEBUG_HIGH, "Looking up command", name);
+
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+
+  return &it->second;
+}
+
+CommandFactory::EntryMapIterator
+CommandFactory::begin() const
+{
+  return entries_.begin();
+}
+
+CommandFactory::EntryMapIterator
+CommandFactory::end() const
+{
+  return entries_.end();
+}
+
+CommandFactory &
+get_command_factory()
+{
+  static CommandFactory factory;
+
+  return factory;
+}
+
+// Command.cpp ends here.
@@ -0,0 +1,86 @@
+//
+// Command.hpp --- Sub-command registry.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 06:02:17
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Command.hpp
+ * @author Paul Ward
+ * @brief Sub-command registry.
+ *
+ * Commands are invoked as `verbuild <command> [OPTION]...' and are
+ * registered the same way as transforms.  Each is handed the command
+ * line from its own name onwards.
+ */
+
+#pragma once
+#ifndef _Command_hpp_
+#define _Command_hpp_
+
+#include "Support.hpp"
+
+#include <functional>
+#include <map>
+#include <string>
+
+class CommandFactory
+{
+public:
+  typedef std::function<int(int, char **)> Runner;
+
+  struct Entry
+  {
+    std::string summary;
+    Runner      run;
+  };
+
+  typedef std::map<std::string, Entry> EntryMap;
+  typedef EntryMap::const_iterator     EntryMapIterator;
+
+private:
+  EntryMap entries_;
+
+public:
+  bool register_command(const std::string &,
+                        const std::string &,
+                        const Runner      &);
+
+  const Entry *find(const std::string &) const;
+
+  EntryMapIterator begin() const;
+  EntryMapIterator end() const;
+};
+
+CommandFactory &get_command_factory();
+
+#define FIND_COMMAND(__k) get_command_factory().find(__k)
+#define COMMAND_BEGIN()   get_command_factory().begin()
+#define COMMAND_END()     get_command_factory().end()
+
+#endif // !_Command_hpp_
+
+// Command.hpp ends here.
@@ -0,0 +1,243 @@
+//
+// Command_Decode.cpp --- The `decode' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:43:39
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file Command_Decode.cpp
+ * @author Paul Ward
+ * @brief The `decode' command.
+ */
+
+#include "Command_Decode.hpp"
+#include "BuildDate.hpp"
+#include "IncrTypeParser.hpp"
+#include "Console.hpp"
+#include "Opts.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/program_options.hpp>
+
+using namespace std;
+
+namespace po   = boost::program_options;
+namespace date = boost::gregorian;
+
+static
+void
+usage(const po::options_description &desc)
+{
+  const char *name = get_program_name();
+
+  cout << "Usage: " << name << " decode -i TYPE [OPTION]... [BUILD]...\n"
+       << "Decode date-based build numbers to dates.\n\n"
+       << "Build numbers are read from standard input when none are given.\n"
+       << "Each is printed with its date as YYYY-MM-DD, or with the reason\n"
+       << "it could not be decoded.\n\n"
+       << desc << endl;
+}
+
+/*
+ * Decode one batch and print it; tokens that are not build numbers
+ * were flagged by the reader and are reported here in order.
+ */
+static
+size_t
+decode_batch(IncrementType         type,
+             uint32_t              base_year,
+             const vector<string> &tokens,
+             vector<uint32_t>     &builds,
+             vector<bool>         &valid)
+{
+  vector<int32_t>         days(builds.size());
+  vector<BuildDateStatus> status(builds.size());
+  size_t                  failed;
+  string                  out;
+
+  failed = decode_build_dates(type,
+                              base_year,
+                              builds.data(),
+                              builds.size(),
+                              days.data(),
+                              status.data());
+
+  for (size_t i = 0; i < builds.size(); i++) {
+    out += tokens[i];
+    out += '\t';
+
+    if (!valid[i]) {
+      out += "error: not a build number";
+    } else if (status[i] == BuildDateStatus::Ok) {
+      out += format_build_date(days[i]);
+    } else {
+      stringstream ss;
+
+      ss << "error: " << status[i];
+      out += ss.str();
+    }
+
+    out += '\n';
+  }
+
+  cout << out;
+
+  return failed;
+}
+
+static
+bool
+parse_build(const string &token, uint32_t &build)
+{
+  const char      *end = token.data() + token.size();
+  from_chars_result res = from_chars(token.data(), end, build);
+
+  return res.ec == errc() && res.ptr == end;
+}
+
+/**
+ * @brief Run `verbuild decode'.
+ * @param argc Argument count, from the command's name on.
+ * @param argv Arguments, from the command's name on.
+ */
+int
+decode_command(int argc, char **argv)
+{
+  po::options_description            desc("Decode options");
+  po::options_description            hidden;
+  po::options_description            all;
+  po::positional_options_description pos;
+  po::variables_map                  vmap;
+  vector<string>                     tokens;
+  vector<uint32_t>                   builds;
+  vector<bool>                       valid;
+  IncrementType                      type;
+  int                                year;
+  size_t                             failed = 0;
+
+  desc.add_options()
+    ("help,h", "Show this help message.")
+    ("increment,i",
+     po::value<IncrTypeParser>()->value_name("type"),
+     "Increment type the numbers were generated with.")
+    ("year,y",
+     po::value<int>()
+       ->default_value(date::day_clock::local_day().year())
+       ->value_name("year"),
+     "Base year the numbers were generated with.");
+
+  hidden.add_options()
+    ("build", po::value<vector<string>>());
+
+  pos.add("build", -1);
+  all.add(desc).add(hidden);
+
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                .options(all)
+                .positional(pos)
+                .run(),
+              vmap);
+    po::notify(vmap);
+  }
+  catch (std::exception &e) {
+    FATAL(e.what());
+    return EXIT_FAILURE;
+  }
+
+  if (vmap.count("help")) {
+    usage(desc);
+    return EXIT_SUCCESS;
+  }
+
+  if (!vmap.count("increment")) {
+    FATAL("No increment type was given; use `--increment'.");
+    return EXIT_FAILURE;
+  }
+
+  type = vmap["increment"].as<IncrTypeParser>().get_type();
+  year = vmap["year"].as<int>();
+
+  if (year < 1970) {
+    FATAL("Base year must be 1970 or greater.");
+    return EXIT_FAILURE;
+  }
+
+  if (vmap.count("build")) {
+    tokens = vmap["build"].as<vector<string>>();
+  }
+
+  auto flush_batch = [&]() {
+    builds.resize(tokens.size());
+    valid.resize(tokens.size());
+
+    // Unparsable tokens decode as build 0, which is never a date.
+    for (size_t i = 0; i < tokens.size(); i++) {
+      valid[i] = parse_build(tokens[i], builds[i]);
+
+      if (!valid[i]) {
+        builds[i] = 0;
+      }
+    }
+
+    failed += decode_batch(type, static_cast<uint32_t>(year),
+                           tokens, builds, valid);
+    tokens.clear();
+  };
+
+  if (!tokens.empty()) {
+    flush_batch();
+  } else {
+    string token;
+
+    ios_base::sync_with_stdio(false);
+
+    while (cin >> token) {
+      tokens.push_back(token);
+
+      if (tokens.size() == DECODE_BATCH_SIZE) {
+        flush_batch();
+      }
+    }
+
+    flush_batch();
+  }
+
+  cout << flush;
+
+  return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Command_Decode.cpp ends here.
@@ -0,0 +1,65 @@
+//
+// Command_Decode.hpp --- The `decode' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:41:05
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file Command_Decode.hpp
+ * @author Paul Ward
+ * @brief The `decode' command.
+ *
+ * Turns date-based build numbers back into dates, in batches.
+ */
+
+#pragma once
+#ifndef _Command_Decode_hpp_
+#define _Command_Decode_hpp_
+
+#include "Support.hpp"
+#include "Command.hpp"
+
+#define DECODE_COMMAND "decode"
+
+/**
+ * @def DECODE_BATCH_SIZE
+ * @brief Number of build numbers read from standard input per batch.
+ */
+#define DECODE_BATCH_SIZE 65536
+
+int decode_command(int, char **);
+
+static const bool UNUSED_VARIABLE(registered_decode_command) =
+  get_command_factory().register_command(
+    DECODE_COMMAND,
+    "Decode date-based build numbers to dates.",
+    decode_command
+  );
+
+#endif // !_Command_Decode_hpp_
+
+// Command_Decode.hpp ends here.
@@ -0,0 +1,293 @@
+//
+// Command_History.cpp --- The `history' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 07:20:51
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Command_History.cpp
+ * @author Paul Ward
+ * @brief The `history' command.
+ */
+
+#include "Command_History.hpp"
+#include "History.hpp"
+#include "HistoryArchive.hpp"
+#include "Console.hpp"
+#include "Opts.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+using namespace std;
+
+namespace po = boost::program_options;
+
+static
+void
+usage(const po::options_description &desc)
+{
+  const char *name = get_program_name();
+
+  cout << "Usage: " << name << " history list [OPTION]...\n"
+       << "       " << name << " history at TIME [OPTION]...\n"
+       << "       " << name << " history compact [OPTION]...\n"
+       << "       " << name << " history export ARCHIVE [OPTION]...\n"
+       << "       " << name << " history import ARCHIVE [OPTION]...\n"
+       << "Query, compact or archive an increment history.\n\n"
+       << "TIME is `now', `@' and seconds since the epoch, or a UTC date\n"
+       << "and time as YYYY-MM-DD[THH:MM[:SS]].  A date alone means the end\n"
+       << "of that day.\n\n"
+       << desc << endl;
+}
+
+static
+bool
+get_time(const po::variables_map &vmap,
+         const char              *key,
+         int64_t                  fallback,
+         int64_t                 &time)
+{
+  if (!vmap.count(key)) {
+    time = fallback;
+    return true;
+  }
+
+  if (!History::parse_time(vmap[key].as<string>(), time)) {
+    FATAL("Invalid time", vmap[key].as<string>());
+    return false;
+  }
+
+  return true;
+}
+
+static
+void
+print_entries(const HistoryEntryVector &entries)
+{
+  size_t width = 0;
+
+  for (auto &it : entries) {
+    width = max(width, it.component.length());
+  }
+
+  for (auto &it : entries) {
+    cout << History::format_time(it.time) << "  "
+         << left << setw(static_cast<int>(width)) << it.component << "  "
+         << it.before << " -> " << it.after << "  "
+         << it.type << '\n';
+  }
+
+  cout << flush;
+}
+
+/**
+ * @brief Run `verbuild history'.
+ * @param argc Argument count, from the command's name on.
+ * @param argv Arguments, from the command's name on.
+ */
+int
+history_command(int argc, char **argv)
+{
+  po::options_description            desc("History options");
+  po::options_description            hidden;
+  po::options_description            all;
+  po::positional_options_description pos;
+  po::variables_map                  vmap;
+  HistoryEntryVector                 entries;
+  string                             action;
+  string                             component;
+  int64_t                            since;
+  int64_t                            until;
+
+  desc.add_options()
+    ("help,h",    "Show this help message.")
+    ("file,F",
+     po::value<string>()->value_name("file"),
+     "The history journal.")
+    ("component",
+     po::value<string>()->value_name("name"),
+     "Only this component.")
+    ("since",
+     po::value<string>()->value_name("time"),
+     "list, export: only records at or after this time.")
+    ("until",
+     po::value<string>()->value_name("time"),
+     "list, export: only records at or before this time.")
+    ("before",
+     po::value<string>()->value_name("time"),
+     "compact: fold records older than this into one per component.");
+
+  hidden.add_options()
+    ("action", po::value<string>())
+    ("arg",    po::value<string>());
+
+  pos.add("action", 1).add("arg", 1);
+  all.add(desc).add(hidden);
+
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                .options(all)
+                .positional(pos)
+                .run(),
+              vmap);
+    po::notify(vmap);
+  }
+  catch (std::exception &e) {
+    FATAL(e.what());
+    return EXIT_FAILURE;
+  }
+
+  if (vmap.count("help") || !vmap.count("action")) {
+    usage(desc);
+    return vmap.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if (!vmap.count("file")) {
+    FATAL("No history file was given; use `--file'.");
+    return EXIT_FAILURE;
+  }
+
+  History history(vmap["file"].as<string>());
+
+  action = vmap["action"].as<string>();
+
+  if (vmap.count("component")) {
+    component = vmap["component"].as<string>();
+  }
+
+  if (action == "list") {
+    if (!get_time(vmap, "since", INT64_MIN, since) ||
+        !get_time(vmap, "until", INT64_MAX, until)) {
+      return EXIT_FAILURE;
+    }
+
+    if (!history.list(since, until, component, entries)) {
+      FATAL("Could not read", history.get_path());
+      return EXIT_FAILURE;
+    }
+
+    print_entries(entries);
+    return EXIT_SUCCESS;
+  }
+
+  if (action == "at") {
+    int64_t time;
+
+    if (!vmap.count("arg")) {
+      FATAL("`history at' needs a time.");
+      return EXIT_FAILURE;
+    }
+
+    if (!get_time(vmap, "arg", 0, time)) {
+      return EXIT_FAILURE;
+    }
+
+    if (!history.at(time, component, entries)) {
+      FATAL("Could not read", history.get_path());
+      return EXIT_FAILURE;
+    }
+
+    if (entries.empty()) {
+      ESAY("No history at", History::format_time(time));
+      return EXIT_FAILURE;
+    }
+
+    print_entries(entries);
+    return EXIT_SUCCESS;
+  }
+
+  if (action == "compact") {
+    int64_t before;
+    size_t  dropped;
+
+    if (!get_time(vmap, "before", INT64_MIN, before) ||
+        !history.compact(before, dropped)) {
+      return EXIT_FAILURE;
+    }
+
+    OK("Compacted", history.get_path() + ",", dropped, "records dropped.");
+    return EXIT_SUCCESS;
+  }
+
+  if (action == "export" || action == "import") {
+    HistoryArchive archive;
+    string         path;
+    size_t         added;
+
+    if (!vmap.count("arg")) {
+      FATAL("`history", action + "' needs an archive file.");
+      return EXIT_FAILURE;
+    }
+
+    path = vmap["arg"].as<string>();
+
+    if (action == "export") {
+      if (!get_time(vmap, "since", INT64_MIN, since) ||
+          !get_time(vmap, "until", INT64_MAX, until)) {
+        return EXIT_FAILURE;
+      }
+
+      if (!history.list(since, until, component, entries)) {
+        FATAL("Could not read", history.get_path());
+        return EXIT_FAILURE;
+      }
+
+      if (!HistoryArchive::save(path, entries)) {
+        FATAL("Could not write", path);
+        return EXIT_FAILURE;
+      }
+
+      OK("Exported", entries.size(), "records to", path);
+      return EXIT_SUCCESS;
+    }
+
+    if (!archive.load(path) || !archive.decode(entries)) {
+      FATAL("Could not read", path);
+      return EXIT_FAILURE;
+    }
+
+    if (!history.merge(entries, added)) {
+      return EXIT_FAILURE;
+    }
+
+    OK("Imported", added, "of", entries.size(), "records into",
+       history.get_path());
+    return EXIT_SUCCESS;
+  }
+
+  FATAL("Unknown history action", action);
+
+  return EXIT_FAILURE;
+}
+
+// Command_History.cpp ends here.
@@ -0,0 +1,59 @@
+//
+// Command_History.hpp --- The `history' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 07:12:26
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Command_History.hpp
+ * @author Paul Ward
+ * @brief The `history' command.
+ *
+ * Queries and compacts the journal written by `--history', and moves
+ * its records to and from archives.
+ */
+
+#pragma once
+#ifndef _Command_History_hpp_
+#define _Command_History_hpp_
+
+#include "Support.hpp"
+#include "Command.hpp"
+
+#define HISTORY_COMMAND "history"
+
+int history_command(int, char **);
+
+static const bool UNUSED_VARIABLE(registered_history_command) =
+  get_command_factory().register_command(
+    HISTORY_COMMAND,
+    "Query, compact or archive an increment history.",
+    history_command
+  );
+
+#endif // !_Command_History_hpp_
+
+// Command_History.hpp ends here.
@@ -0,0 +1,193 @@
+//
+// Command_Match.cpp --- The `match' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 14:25:37
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file Command_Match.cpp
+ * @author Paul Ward
+ * @brief The `match' command.
+ */
+
+#include "Command_Match.hpp"
+#include "VersionConstraint.hpp"
+#include "Console.hpp"
+#include "Opts.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+using namespace std;
+
+namespace po = boost::program_options;
+
+static
+void
+usage(const po::options_description &desc)
+{
+  const char *name = get_program_name();
+
+  cout << "Usage: " << name << " match [OPTION]... CONSTRAINT\n"
+       << "Filter versions through a constraint.\n\n"
+       << "Reads lines from standard input and prints those whose last field\n"
+       << "is a version that satisfies CONSTRAINT, such as\n\n"
+       << "  '>=1.2.0 <2.0.0 || ~3.4'\n\n"
+       << "Alternatives are separated by `||'.  Comparators are =, !=, <, <=,\n"
+       << ">, >=, ~ and ^, and `A - B' is an inclusive range.  Versions have\n"
+       << "one to four fields, and `x' or `*' stands for any value.\n\n"
+       << "The exit status is zero if any line was printed.\n\n"
+       << desc << endl;
+}
+
+/*
+ * The last field of a line, so the output of `scan' can be piped in.
+ */
+static
+string_view
+last_field(const string &line)
+{
+  size_t end   = line.find_last_not_of(" \t\r");
+  size_t start;
+
+  if (end == string::npos) {
+    return string_view();
+  }
+
+  start = line.find_last_of(" \t", end);
+  start = (start == string::npos) ? 0 : start + 1;
+
+  return string_view(line.data() + start, end + 1 - start);
+}
+
+/**
+ * @brief Run `verbuild match'.
+ * @param argc Argument count, from the command's name on.
+ * @param argv Arguments, from the command's name on.
+ */
+int
+match_command(int argc, char **argv)
+{
+  po::options_description            desc("Match options");
+  po::options_description            hidden;
+  po::options_description            all;
+  po::positional_options_description pos;
+  po::variables_map                  vmap;
+  VersionConstraint                  constraint;
+  vector<string>                     lines;
+  VersionKeyVector                   keys;
+  vector<uint8_t>                    hits;
+  string                             line;
+  bool                               invert;
+  size_t                             printed = 0;
+  size_t                             skipped = 0;
+
+  desc.add_options()
+    ("help,h",   "Show this help message.")
+    ("invert,v", "Print the versions that do not satisfy the constraint.");
+
+  hidden.add_options()
+    ("constraint", po::value<string>());
+
+  pos.add("constraint", 1);
+  all.add(desc).add(hidden);
+
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                .options(all)
+                .positional(pos)
+                .run(),
+              vmap);
+    po::notify(vmap);
+  }
+  catch (std::exception &e) {
+    FATAL(e.what());
+    return EXIT_FAILURE;
+  }
+
+  if (vmap.count("help") || !vmap.count("constraint")) {
+    usage(desc);
+    return vmap.count("help") ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if (!constraint.parse(vmap["constraint"].as<string>())) {
+    FATAL(constraint.get_error());
+    return EXIT_FAILURE;
+  }
+
+  invert = vmap.count("invert") > 0;
+
+  ios_base::sync_with_stdio(false);
+
+  for (bool more = true; more; ) {
+    string out;
+
+    lines.clear();
+    keys.clear();
+
+    while (lines.size() < MATCH_BATCH_SIZE && (more = !!getline(cin, line))) {
+      VersionKey key;
+
+      if (!parse_version_key(last_field(line), key)) {
+        skipped++;
+        continue;
+      }
+
+      lines.push_back(line);
+      keys.push_back(key);
+    }
+
+    hits.resize(keys.size());
+    constraint.match(keys.data(), keys.size(), hits.data());
+
+    for (size_t i = 0; i < lines.size(); i++) {
+      if ((hits[i] != 0) != invert) {
+        out += lines[i];
+        out += '\n';
+        printed++;
+      }
+    }
+
+    cout << out;
+  }
+
+  cout << flush;
+
+  if (skipped > 0) {
+    WSAY("Skipped", skipped, "lines without a version.");
+  }
+
+  return (printed > 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Command_Match.cpp ends here.
@@ -0,0 +1,65 @@
+//
+// Command_Match.hpp --- The `match' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 14:22:03
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file Command_Match.hpp
+ * @author Paul Ward
+ * @brief The `match' command.
+ *
+ * Filters versions read from standard input through a constraint.
+ */
+
+#pragma once
+#ifndef _Command_Match_hpp_
+#define _Command_Match_hpp_
+
+#include "Support.hpp"
+#include "Command.hpp"
+
+#define MATCH_COMMAND "match"
+
+/**
+ * @def MATCH_BATCH_SIZE
+ * @brief Number of lines tested against the constraint at a time.
+ */
+#define MATCH_BATCH_SIZE 65536
+
+int match_command(int, char **);
+
+static const bool UNUSED_VARIABLE(registered_match_command) =
+  get_command_factory().register_command(
+    MATCH_COMMAND,
+    "Filter versions through a constraint.",
+    match_command
+  );
+
+#endif // !_Command_Match_hpp_
+
+// Command_Match.hpp ends here.
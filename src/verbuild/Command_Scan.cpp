@@ -0,0 +1,209 @@
+//
+// Command_Scan.cpp --- The `scan' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 10:05:47
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file Command_Scan.cpp
+ * @author Paul Ward
+ * @brief The `scan' command.
+ */
+
+#include "Command_Scan.hpp"
+#include "VersionScanner.hpp"
+#include "Console.hpp"
+#include "Opts.hpp"
+
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <fcntl.h>
+# include <io.h>
+#endif
+
+#include <boost/program_options.hpp>
+
+using namespace std;
+
+namespace po = boost::program_options;
+
+static
+void
+usage(const po::options_description &desc)
+{
+  const char *name = get_program_name();
+
+  cout << "Usage: " << name << " scan [OPTION]... [FILE]...\n"
+       << "Find version strings in logs and other text.\n\n"
+       << "Prints the byte offset and version of every MAJOR.MINOR.BUILD.PATCH\n"
+       << "in each FILE, or in standard input when there is none.  With more\n"
+       << "than one FILE, each line starts with the file's name.\n\n"
+       << desc << endl;
+}
+
+static
+void
+append_number(string &out, uint64_t value)
+{
+  char            buf[24];
+  to_chars_result res = to_chars(buf, buf + sizeof(buf), value);
+
+  out.append(buf, res.ptr);
+}
+
+static
+void
+print_matches(const string             &prefix,
+              const VersionMatchVector &matches)
+{
+  string out;
+
+  out.reserve(matches.size() * 32);
+
+  for (auto &it : matches) {
+    out += prefix;
+    append_number(out, it.offset);
+    out += '\t';
+    append_number(out, it.major);
+    out += '.';
+    append_number(out, it.minor);
+    out += '.';
+    append_number(out, it.build);
+    out += '.';
+    append_number(out, it.patch);
+    out += '\n';
+  }
+
+  fwrite(out.data(), 1, out.size(), stdout);
+}
+
+static
+bool
+scan_stdin()
+{
+  VersionScanner     scanner;
+  VersionMatchVector matches;
+  vector<char>       buf(SCAN_READ_SIZE);
+  size_t             got;
+
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  _setmode(_fileno(stdin), _O_BINARY);
+#endif
+
+  while ((got = fread(buf.data(), 1, buf.size(), stdin)) > 0) {
+    scanner.feed(buf.data(), got, matches);
+    print_matches("", matches);
+    matches.clear();
+  }
+
+  scanner.finish(matches);
+  print_matches("", matches);
+
+  return !ferror(stdin);
+}
+
+/**
+ * @brief Run `verbuild scan'.
+ * @param argc Argument count, from the command's name on.
+ * @param argv Arguments, from the command's name on.
+ */
+int
+scan_command(int argc, char **argv)
+{
+  po::options_description            desc("Scan options");
+  po::options_description            hidden;
+  po::options_description            all;
+  po::positional_options_description pos;
+  po::variables_map                  vmap;
+  vector<string>                     files;
+  VersionMatchVector                 matches;
+  bool                               ok = true;
+
+  desc.add_options()
+    ("help,h", "Show this help message.");
+
+  hidden.add_options()
+    ("file", po::value<vector<string>>());
+
+  pos.add("file", -1);
+  all.add(desc).add(hidden);
+
+  try {
+    po::store(po::command_line_parser(argc, argv)
+                .options(all)
+                .positional(pos)
+                .run(),
+              vmap);
+    po::notify(vmap);
+  }
+  catch (std::exception &e) {
+    FATAL(e.what());
+    return EXIT_FAILURE;
+  }
+
+  if (vmap.count("help")) {
+    usage(desc);
+    return EXIT_SUCCESS;
+  }
+
+  if (vmap.count("file")) {
+    files = vmap["file"].as<vector<string>>();
+  }
+
+  if (files.empty()) {
+    if (!scan_stdin()) {
+      FATAL("Could not read standard input.");
+      return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  for (auto &it : files) {
+    matches.clear();
+
+    if (!VersionScanner::scan_file(it, matches)) {
+      ESAY("Could not read", it);
+      ok = false;
+      continue;
+    }
+
+    print_matches((files.size() > 1) ? it + ":" : "", matches);
+  }
+
+  fflush(stdout);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Command_Scan.cpp ends here.
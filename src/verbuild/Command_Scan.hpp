@@ -0,0 +1,65 @@
+//
+// Command_Scan.hpp --- The `scan' command.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 10:02:14
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file Command_Scan.hpp
+ * @author Paul Ward
+ * @brief The `scan' command.
+ *
+ * Finds version strings in logs and other text.
+ */
+
+#pragma once
+#ifndef _Command_Scan_hpp_
+#define _Command_Scan_hpp_
+
+#include "Support.hpp"
+#include "Command.hpp"
+
+#define SCAN_COMMAND "scan"
+
+/**
+ * @def SCAN_READ_SIZE
+ * @brief Bytes read from standard input at a time.
+ */
+#define SCAN_READ_SIZE (1024 * 1024)
+
+int scan_command(int, char **);
+
+static const bool UNUSED_VARIABLE(registered_scan_command) =
+  get_command_factory().register_command(
+    SCAN_COMMAND,
+    "Find version strings in logs and other text.",
+    scan_command
+  );
+
+#endif // !_Command_Scan_hpp_
+
+// Command_Scan.hpp ends here.
@@ -0,0 +1,519 @@
+//
+// CommitGraph.cpp --- Git commit-graph reader.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 00:25:06
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file CommitGraph.cpp
+ * @author Paul Ward
+ * @brief Git commit-graph reader.
+ */
+
+#include "CommitGraph.hpp"
+#include "Console.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using namespace std;
+
+#define GRAPH_SIGNATURE     "CGPH"
+#define GRAPH_HEADER_SIZE   8
+#define GRAPH_CHUNK_SIZE    12
+#define GRAPH_FANOUT_SIZE   (256 * 4)
+
+#define GRAPH_PARENT_NONE   0x70000000
+#define GRAPH_EXTRA_EDGES   0x80000000
+#define GRAPH_LAST_EDGE     0x80000000
+#define GRAPH_EDGE_MASK     0x7FFFFFFF
+
+static inline
+uint32_t
+be32(const unsigned char *p)
+{
+  return (static_cast<uint32_t>(p[0]) << 24) |
+         (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8)  |
+         static_cast<uint32_t>(p[3]);
+}
+
+static inline
+uint64_t
+be64(const unsigned char *p)
+{
+  return (static_cast<uint64_t>(be32(p)) << 32) | be32(p + 4);
+}
+
+static inline
+int
+hex_digit(char ch)
+{
+  if (ch >= '0' && ch <= '9') {
+    return ch - '0';
+  }
+
+  if (ch >= 'a' && ch <= 'f') {
+    return ch - 'a' + 10;
+  }
+
+  return -1;
+}
+
+static
+const unsigned char *
+map_file(const string &path, size_t &size)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  ifstream       strm(path, ios::binary);
+  unsigned char *buf;
+
+  if (!strm.is_open()) {
+    return nullptr;
+  }
+
+  strm.seekg(0, ios::end);
+  size = static_cast<size_t>(strm.tellg());
+  strm.seekg(0, ios::beg);
+
+  buf = new unsigned char[size];
+  strm.read(reinterpret_cast<char *>(buf), static_cast<streamsize>(size));
+
+  return buf;
+#else
+  struct stat st;
+  void       *map;
+  int         fd = ::open(path.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  size = static_cast<size_t>(st.st_size);
+  map  = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  return (map == MAP_FAILED) ? nullptr : static_cast<unsigned char *>(map);
+#endif
+}
+
+static
+void
+unmap_file(const unsigned char *map, size_t size)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  (void)size;
+  delete[] map;
+#else
+  ::munmap(const_cast<unsigned char *>(map), size);
+#endif
+}
+
+CommitGraph::CommitGraph()
+  : layers_(),
+    oid_len_(0),
+    count_(0)
+{}
+
+CommitGraph::~CommitGraph()
+{
+  close();
+}
+
+/**
+ * @brief Map the commit-graph of an object directory.
+ * @param objects The repository's `objects' directory.
+ * @returns false if there is no usable commit-graph.
+ */
+bool
+CommitGraph::open(const string &objects)
+{
+  string info(objects + "/info/");
+  string single(info + "commit-graph");
+
+  close();
+
+  if (load(single)) {
+    return true;
+  }
+
+  // A split graph: one layer per line, base first.
+  ifstream chain(info + "commit-graphs/commit-graph-chain");
+  string   line;
+
+  if (!chain.is_open()) {
+    DSAY(DEBUG_MEDIUM, "No commit-graph in", objects);
+    return false;
+  }
+
+  while (getline(chain, line)) {
+    trim(line);
+
+    if (line.empty()) {
+      continue;
+    }
+
+    if (!load(info + "commit-graphs/graph-" + line + ".graph")) {
+      close();
+      return false;
+    }
+  }
+
+  return is_open();
+}
+
+void
+CommitGraph::close()
+{
+  for (auto &it : layers_) {
+    unmap_file(it.map, it.size);
+  }
+
+  layers_.clear();
+  oid_len_ = 0;
+  count_   = 0;
+}
+
+bool
+CommitGraph::is_open() const
+{
+  return !layers_.empty();
+}
+
+uint32_t
+CommitGraph::get_count() const
+{
+  return count_;
+}
+
+size_t
+CommitGraph::get_oid_length() const
+{
+  return oid_len_;
+}
+
+/*
+ * Map one graph file and append it as the next layer.
+ */
+bool
+CommitGraph::load(const string &path)
+{
+  Layer                layer = {};
+  const unsigned char *chunk;
+  size_t               oid_len;
+  size_t               fanout_len = 0;
+  size_t               oids_len   = 0;
+  size_t               data_len   = 0;
+  size_t               edges_len  = 0;
+  unsigned             chunks;
+
+  layer.map = map_file(path, layer.size);
+  if (layer.map == nullptr) {
+    return false;
+  }
+
+  auto fail = [&](const char *why) {
+    WSAY("Ignoring commit-graph", path + ":", why);
+    unmap_file(layer.map, layer.size);
+    return false;
+  };
+
+  if (layer.size < GRAPH_HEADER_SIZE ||
+      ::memcmp(layer.map, GRAPH_SIGNATURE, 4) != 0) {
+    return fail("bad signature");
+  }
+
+  if (layer.map[4] != 1) {
+    return fail("unsupported version");
+  }
+
+  switch (layer.map[5]) {
+    case 1:  oid_len = 20; break;
+    case 2:  oid_len = 32; break;
+    default: return fail("unknown hash");
+  }
+
+  if (oid_len_ != 0 && oid_len != oid_len_) {
+    return fail("hash differs from the previous layer");
+  }
+
+  chunks = layer.map[6];
+  if (layer.size < GRAPH_HEADER_SIZE + (chunks + 1) * GRAPH_CHUNK_SIZE) {
+    return fail("truncated chunk table");
+  }
+
+  chunk = layer.map + GRAPH_HEADER_SIZE;
+
+  // Each chunk runs to the start of the next; the table ends with a
+  // terminating entry giving the end of the last.
+  for (unsigned i = 0; i < chunks; i++, chunk += GRAPH_CHUNK_SIZE) {
+    uint64_t start = be64(chunk + 4);
+    uint64_t end   = be64(chunk + GRAPH_CHUNK_SIZE + 4);
+
+    if (start > end || end > layer.size) {
+      return fail("chunk out of bounds");
+    }
+
+    if (::memcmp(chunk, "OIDF", 4) == 0) {
+      layer.fanout = layer.map + start;
+      fanout_len   = end - start;
+    } else if (::memcmp(chunk, "OIDL", 4) == 0) {
+      layer.oids = layer.map + start;
+      oids_len   = end - start;
+    } else if (::memcmp(chunk, "CDAT", 4) == 0) {
+      layer.data = layer.map + start;
+      data_len   = end - start;
+    } else if (::memcmp(chunk, "EDGE", 4) == 0) {
+      layer.edges = layer.map + start;
+      edges_len   = end - start;
+    }
+  }
+
+  if (layer.fanout == nullptr || fanout_len != GRAPH_FANOUT_SIZE ||
+      layer.oids == nullptr || layer.data == nullptr) {
+    return fail("missing chunk");
+  }
+
+  layer.count      = be32(layer.fanout + GRAPH_FANOUT_SIZE - 4);
+  layer.first      = count_;
+  layer.edge_count = edges_len / 4;
+
+  if (oids_len != layer.count * oid_len ||
+      data_len != layer.count * (oid_len + 16)) {
+    return fail("chunk sizes do not match the commit count");
+  }
+
+  oid_len_  = oid_len;
+  count_   += layer.count;
+  layers_.push_back(layer);
+
+  DSAY(DEBUG_MEDIUM, "Mapped", layer.count, "commits from", path);
+
+  return true;
+}
+
+const CommitGraph::Layer &
+CommitGraph::layer_for(uint32_t pos) const
+{
+  size_t idx = layers_.size() - 1;
+
+  while (idx > 0 && pos < layers_[idx].first) {
+    idx--;
+  }
+
+  return layers_[idx];
+}
+
+/**
+ * @brief Look up a commit by hex object name.
+ * @param pos Receives its global position.
+ */
+bool
+CommitGraph::find(const string &hex, uint32_t &pos) const
+{
+  unsigned char oid[32];
+
+  if (hex.length() != oid_len_ * 2) {
+    return false;
+  }
+
+  for (size_t i = 0; i < oid_len_; i++) {
+    int hi = hex_digit(hex[i * 2]);
+    int lo = hex_digit(hex[i * 2 + 1]);
+
+    if (hi < 0 || lo < 0) {
+      return false;
+    }
+
+    oid[i] = static_cast<unsigned char>((hi << 4) | lo);
+  }
+
+  for (auto &it : layers_) {
+    uint32_t lo = (oid[0] == 0) ? 0 : be32(it.fanout + (oid[0] - 1) * 4);
+    uint32_t hi = be32(it.fanout + oid[0] * 4);
+
+    while (lo < hi) {
+      uint32_t mid = lo + (hi - lo) / 2;
+      int      cmp = ::memcmp(it.oids + mid * oid_len_, oid, oid_len_);
+
+      if (cmp == 0) {
+        pos = it.first + mid;
+        return true;
+      }
+
+      if (cmp < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Topological level of a commit; 0 if the graph predates them.
+ */
+uint32_t
+CommitGraph::get_generation(uint32_t pos) const
+{
+  const Layer &layer = layer_for(pos);
+
+  return be32(layer.data +
+              (pos - layer.first) * (oid_len_ + 16) + oid_len_ + 8) >> 2;
+}
+
+/**
+ * @brief Collect the parents of a commit.
+ * @returns false if the graph is inconsistent.
+ */
+bool
+CommitGraph::parents(uint32_t pos, CommitPosVector &out) const
+{
+  const Layer         &layer = layer_for(pos);
+  const unsigned char *entry;
+  uint32_t             first;
+  uint32_t             second;
+
+  out.clear();
+
+  entry  = layer.data + (pos - layer.first) * (oid_len_ + 16) + oid_len_;
+  first  = be32(entry);
+  second = be32(entry + 4);
+
+  if (first == GRAPH_PARENT_NONE) {
+    return true;
+  }
+
+  out.push_back(first);
+
+  if (second == GRAPH_PARENT_NONE) {
+    return true;
+  }
+
+  if ((second & GRAPH_EXTRA_EDGES) == 0) {
+    out.push_back(second);
+    return true;
+  }
+
+  // An octopus merge: the rest are listed in EDGE, last one flagged.
+  for (size_t edge = second & GRAPH_EDGE_MASK; ; edge++) {
+    uint32_t value;
+
+    if (edge >= layer.edge_count) {
+      return false;
+    }
+
+    value = be32(layer.edges + edge * 4);
+    out.push_back(value & GRAPH_EDGE_MASK);
+
+    if ((value & GRAPH_LAST_EDGE) != 0) {
+      return true;
+    }
+  }
+}
+
+/**
+ * @brief Count the commits reachable from some starting commits.
+ * @param starts Global positions; duplicates are allowed.
+ * @param count Receives the number of distinct commits, including the
+ *              starting ones.
+ * @returns false if the graph is inconsistent.
+ *
+ * Each commit is marked in a bitmap when first seen, so every commit
+ * is expanded once however many paths lead to it.  A parent must have
+ * a lower generation than its child, which catches corrupt parent
+ * tables before they can loop.
+ */
+bool
+CommitGraph::count_reachable(const CommitPosVector &starts,
+                             uint64_t              &count) const
+{
+  vector<uint64_t> seen((count_ + 63) / 64, 0);
+  CommitPosVector  stack;
+  CommitPosVector  parents_of;
+
+  count = 0;
+
+  auto visit = [&](uint32_t pos) {
+    uint64_t &word = seen[pos >> 6];
+    uint64_t  bit  = static_cast<uint64_t>(1) << (pos & 63);
+
+    if ((word & bit) == 0) {
+      word |= bit;
+      stack.push_back(pos);
+    }
+  };
+
+  for (uint32_t pos : starts) {
+    if (pos >= count_) {
+      return false;
+    }
+
+    visit(pos);
+  }
+
+  while (!stack.empty()) {
+    uint32_t pos = stack.back();
+    uint32_t gen = get_generation(pos);
+
+    stack.pop_back();
+    count++;
+
+    if (!parents(pos, parents_of)) {
+      WSAY("Commit-graph has a broken octopus edge list.");
+      return false;
+    }
+
+    for (uint32_t parent : parents_of) {
+      if (parent >= count_ || (gen != 0 && get_generation(parent) >= gen)) {
+        WSAY("Commit-graph has an invalid parent at position", pos);
+        return false;
+      }
+
+      visit(parent);
+    }
+  }
+
+  return true;
+}
+
+// CommitGraph.cpp ends here.
@@ -0,0 +1,102 @@
+//
+// CommitGraph.hpp --- Git commit-graph reader.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 00:12:51
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file CommitGraph.hpp
+ * @author Paul Ward
+ * @brief Git commit-graph reader.
+ *
+ * Maps `objects/info/commit-graph', or each layer of a split graph
+ * named by `objects/info/commit-graphs/commit-graph-chain', and reads
+ * commits by their position in it.  Positions are global: a chain's
+ * base layer comes first and each later layer continues its
+ * numbering, as in git.
+ *
+ * Counting the commits reachable from a set of starting positions is
+ * a walk over the parent tables with one bit per commit.
+ */
+
+#pragma once
+#ifndef _CommitGraph_hpp_
+#define _CommitGraph_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+typedef std::vector<std::uint32_t> CommitPosVector;
+
+class CommitGraph
+{
+private:
+  struct Layer {
+    const unsigned char *map;           // Whole file.
+    std::size_t          size;
+    const unsigned char *fanout;        // OIDF: 256 cumulative counts.
+    const unsigned char *oids;          // OIDL: sorted object names.
+    const unsigned char *data;          // CDAT: tree, parents, generation.
+    const unsigned char *edges;         // EDGE: extra octopus parents.
+    std::size_t          edge_count;
+    std::uint32_t        count;
+    std::uint32_t        first;         // Global position of entry 0.
+  };
+
+  std::vector<Layer> layers_;
+  std::size_t        oid_len_;
+  std::uint32_t      count_;
+
+public:
+  CommitGraph();
+  CommitGraph(const CommitGraph &) = delete;
+  ~CommitGraph();
+
+  bool open(const std::string &);
+  void close();
+  bool is_open() const;
+
+  std::uint32_t get_count() const;
+  std::size_t   get_oid_length() const;
+
+  bool          find(const std::string &, std::uint32_t &) const;
+  bool          parents(std::uint32_t, CommitPosVector &) const;
+  std::uint32_t get_generation(std::uint32_t) const;
+
+  bool count_reachable(const CommitPosVector &, std::uint64_t &) const;
+
+private:
+  bool         load(const std::string &);
+  const Layer &layer_for(std::uint32_t) const;
+};
+
+#endif // !_CommitGraph_hpp_
+
+// CommitGraph.hpp ends here.
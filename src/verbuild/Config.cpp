@@ -49,9 +49,66 @@ Config::print() const
 
   lpv.push_back(ListPair("File name", filename));
   lpv.push_back(ListPair("Create file", (create ? "Yes" : "No")));
+  lpv.push_back(ListPair("Update in place", (update ? "Yes" : "No")));
   lpv.push_back(ListPair("Transform", transform));
+
+  for (size_t i = 1; i < outputs.size(); i++) {
+    lpv.push_back(ListPair("Also writing",
+                           outputs[i].transform + ":" + outputs[i].filename));
+  }
+
   lpv.push_back(ListPair("Prefix", prefix));
   lpv.push_back(ListPair("Base  year", to_string(base_year)));
+  lpv.push_back(ListPair("Scan limit",
+                         (scan_limit == 0
+                            ? "Unlimited"
+                            : to_string(scan_limit) + " bytes")));
+
+  if (watch) {
+    lpv.push_back(ListPair("Watch",
+                           to_string(watch_debounce) + " ms debounce"));
+
+    for (auto &it : watch_inputs) {
+      lpv.push_back(ListPair("Also watching", it));
+    }
+  }
+
+  for (auto &it : if_changed) {
+    lpv.push_back(ListPair("Increment if changed", it));
+  }
+
+  if (!if_changed.empty()) {
+    lpv.push_back(ListPair("Digest file", digest_file));
+  }
+
+  if (!history.empty()) {
+    lpv.push_back(ListPair("History", history));
+    lpv.push_back(ListPair("Component", component));
+  }
+
+  if (!template_file.empty()) {
+    lpv.push_back(ListPair("Template", template_file));
+  }
+
+  if (!policy.empty()) {
+    lpv.push_back(ListPair("Increment policy", policy));
+  }
+
+  if (!script.empty() || !policy.empty()) {
+    if (!script.empty()) {
+      lpv.push_back(ListPair("Script", script));
+    }
+    lpv.push_back(ListPair("Script cache",
+                           (script_cache.empty() ? "Disabled" : script_cache)));
+    lpv.push_back(ListPair("Lua memory limit",
+                           (lua_memory_limit == 0
+                              ? "Unlimited"
+                              : to_string(lua_memory_limit) + " bytes")));
+    lpv.push_back(ListPair("Lua instruction limit",
+                           (lua_instruction_limit == 0
+                              ? "Unlimited"
+                              : to_string(lua_instruction_limit))));
+  }
 
   {
     stringstream ss;
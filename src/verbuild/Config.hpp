@@ -41,17 +41,46 @@
 #include "Enums.hpp"
 
 #include <string>
+#include <vector>
+
+/**
+ * @brief One `--output' destination.
+ */
+struct OutputSpec
+{
+  std::string transform;
+  std::string filename;
+};
+
+typedef std::vector<OutputSpec> OutputSpecVector;
+typedef std::vector<std::string> PathVector;
 
 struct Config
 {
-  std::uint32_t base_year;
-  IncrementMode incr_mode;
-  IncrementType incr_type;
-  OutputGroups  groups;
-  std::string   transform;
-  std::string   prefix;
-  bool          create;
-  std::string   filename;
+  std::uint32_t    base_year;
+  IncrementMode    incr_mode;
+  IncrementType    incr_type;
+  OutputGroups     groups;
+  std::string      transform;
+  std::string      prefix;
+  bool             create;
+  bool             update;
+  std::string      filename;
+  OutputSpecVector outputs;
+  std::string      script;
+  std::string      script_cache;
+  std::string      policy;
+  PathVector       if_changed;
+  std::string      digest_file;
+  std::string      history;
+  std::string      component;
+  std::string      template_file;
+  std::size_t      lua_memory_limit;
+  std::uint64_t    lua_instruction_limit;
+  std::uint64_t    scan_limit;
+  bool             watch;
+  PathVector       watch_inputs;
+  unsigned         watch_debounce;
 
   Config()
     : base_year(1970),
@@ -61,7 +90,23 @@ struct Config
       transform(""),
       prefix(""),
       create(false),
-      filename("")
+      update(false),
+      filename(""),
+      outputs(),
+      script(""),
+      script_cache(""),
+      policy(""),
+      if_changed(),
+      digest_file(""),
+      history(""),
+      component(""),
+      template_file(""),
+      lua_memory_limit(64 * 1024 * 1024),
+      lua_instruction_limit(100000000),
+      scan_limit(4 * 1024 * 1024),
+      watch(false),
+      watch_inputs(),
+      watch_debounce(250)
   {};
 
   Config(const Config &) = delete;
@@ -0,0 +1,454 @@
+//
+// ElfObject.cpp --- Relocatable ELF object writer.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:02:51
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file ElfObject.cpp
+ * @author Paul Ward
+ * @brief Relocatable ELF object writer.
+ */
+
+#include "ElfObject.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+#define EHDR_SIZE 64
+#define SHDR_SIZE 64
+#define SYM_SIZE  24
+
+#define ET_REL     1
+#define EV_CURRENT 1
+
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB   2
+#define SHT_STRTAB   3
+#define SHT_NOTE     7
+
+#define SHF_ALLOC 0x2
+
+#define STB_GLOBAL 1
+#define STT_OBJECT 1
+
+// Sections are always written in this order.
+enum Section : unsigned {
+  SectionNull = 0,
+  SectionRodata,
+  SectionNote,
+  SectionStack,
+  SectionSymtab,
+  SectionStrtab,
+  SectionShstrtab,
+  SectionCount
+};
+
+static const char *section_names[SectionCount] = {
+  "",
+  ".rodata",
+  ".note.verbuild",
+  ".note.GNU-stack",            // Marks the stack as not executable.
+  ".symtab",
+  ".strtab",
+  ".shstrtab"
+};
+
+static inline
+void
+put(string &out, uint64_t value, unsigned bytes)
+{
+  for (unsigned i = 0; i < bytes; i++) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+static inline
+uint64_t
+get(const string &in, size_t offset, unsigned bytes)
+{
+  uint64_t value = 0;
+
+  for (unsigned i = 0; i < bytes; i++) {
+    value |= static_cast<uint64_t>(
+      static_cast<unsigned char>(in[offset + i])) << (8 * i);
+  }
+
+  return value;
+}
+
+static inline
+void
+pad(string &out, uint64_t align)
+{
+  while (out.size() % align != 0) {
+    out.push_back('\0');
+  }
+}
+
+static inline
+uint32_t
+add_name(string &table, const string &name)
+{
+  uint32_t offset = static_cast<uint32_t>(table.size());
+
+  table.append(name);
+  table.push_back('\0');
+
+  return offset;
+}
+
+ElfObject::ElfObject(ElfMachine machine)
+  : machine_(machine),
+    rodata_(),
+    notes_(),
+    symbols_(),
+    rodata_align_(1)
+{}
+
+ElfMachine
+ElfObject::get_machine() const
+{
+  return machine_;
+}
+
+/**
+ * @brief The machine verbuild itself was built for.
+ *
+ * Anything other than AArch64 gets x86-64.
+ */
+ElfMachine
+ElfObject::host_machine()
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return ElfMachine::AArch64;
+#else
+  return ElfMachine::X86_64;
+#endif
+}
+
+/**
+ * @brief Add a global object to @c .rodata.
+ * @param name Symbol name.
+ * @param data Bytes to copy.
+ * @param len Number of bytes.
+ * @param align Alignment, a power of two.
+ */
+void
+ElfObject::add_object(const string &name,
+                      const void   *data,
+                      size_t        len,
+                      size_t        align)
+{
+  pad(rodata_, align);
+  symbols_.push_back(Symbol { name, rodata_.size(), len });
+  rodata_.append(static_cast<const char *>(data), len);
+  rodata_align_ = max<uint64_t>(rodata_align_, align);
+}
+
+/**
+ * @brief Add a NUL-terminated string; its size includes the NUL.
+ */
+void
+ElfObject::add_string(const string &name, const string &value)
+{
+  add_object(name, value.c_str(), value.size() + 1, 1);
+}
+
+/**
+ * @brief Add a note to @c .note.verbuild.
+ * @param owner Note owner, e.g. `verbuild'.
+ * @param type Owner-defined note type.
+ */
+void
+ElfObject::add_note(const string &owner,
+                    uint32_t      type,
+                    const void   *desc,
+                    size_t        len)
+{
+  put(notes_, owner.size() + 1, 4);
+  put(notes_, len, 4);
+  put(notes_, type, 4);
+  notes_.append(owner);
+  notes_.push_back('\0');
+  pad(notes_, 4);
+  notes_.append(static_cast<const char *>(desc), len);
+  pad(notes_, 4);
+}
+
+/**
+ * @brief Lay out the object file.
+ *
+ * The ELF header is followed by the section contents and then the
+ * section header table.
+ */
+string
+ElfObject::to_string() const
+{
+  string   out(EHDR_SIZE, '\0');
+  string   shstrtab(1, '\0');
+  string   strtab(1, '\0');
+  string   symtab(SYM_SIZE, '\0');
+  string   headers;
+  uint32_t names[SectionCount];
+  uint64_t offsets[SectionCount] = {};
+  uint64_t shoff;
+
+  for (unsigned i = 1; i < SectionCount; i++) {
+    names[i] = add_name(shstrtab, section_names[i]);
+  }
+  names[SectionNull] = 0;
+
+  for (auto &it : symbols_) {
+    put(symtab, add_name(strtab, it.name), 4);
+    put(symtab, (STB_GLOBAL << 4) | STT_OBJECT, 1);
+    put(symtab, 0, 1);                          // STV_DEFAULT
+    put(symtab, SectionRodata, 2);
+    put(symtab, it.offset, 8);
+    put(symtab, it.size, 8);
+  }
+
+  struct {
+    const string *data;
+    uint64_t      align;
+  } contents[SectionCount] = {
+    { nullptr,   1             },
+    { &rodata_,  rodata_align_ },
+    { &notes_,   4             },
+    { nullptr,   1             },
+    { &symtab,   8             },
+    { &strtab,   1             },
+    { &shstrtab, 1             },
+  };
+
+  for (unsigned i = 1; i < SectionCount; i++) {
+    pad(out, contents[i].align);
+    offsets[i] = out.size();
+
+    if (contents[i].data != nullptr) {
+      out.append(*contents[i].data);
+    }
+  }
+
+  pad(out, 8);
+  shoff = out.size();
+
+  for (unsigned i = 0; i < SectionCount; i++) {
+    uint32_t type    = 0;
+    uint64_t flags   = 0;
+    uint32_t link    = 0;
+    uint32_t info    = 0;
+    uint64_t entsize = 0;
+    uint64_t size    = contents[i].data ? contents[i].data->size() : 0;
+
+    switch (i) {
+      case SectionRodata:
+        type  = SHT_PROGBITS;
+        flags = SHF_ALLOC;
+        break;
+
+      case SectionNote:
+        type  = SHT_NOTE;
+        flags = SHF_ALLOC;
+        break;
+
+      case SectionStack:
+        type = SHT_PROGBITS;
+        break;
+
+      case SectionSymtab:
+        type    = SHT_SYMTAB;
+        link    = SectionStrtab;
+        info    = 1;                // Only the null symbol is local.
+        entsize = SYM_SIZE;
+        break;
+
+      case SectionStrtab:
+      case SectionShstrtab:
+        type = SHT_STRTAB;
+        break;
+    }
+
+    put(headers, names[i], 4);
+    put(headers, type, 4);
+    put(headers, flags, 8);
+    put(headers, 0, 8);                         // sh_addr
+    put(headers, offsets[i], 8);
+    put(headers, size, 8);
+    put(headers, link, 4);
+    put(headers, info, 4);
+    put(headers, (i == SectionNull) ? 0 : contents[i].align, 8);
+    put(headers, entsize, 8);
+  }
+
+  out.append(headers);
+
+  // Now that the layout is known, fill in the ELF header.
+  string ehdr("\x7f" "ELF", 4);
+
+  put(ehdr, 2, 1);                              // ELFCLASS64
+  put(ehdr, 1, 1);                              // ELFDATA2LSB
+  put(ehdr, EV_CURRENT, 1);
+  put(ehdr, 0, 1);                              // ELFOSABI_NONE
+  pad(ehdr, 16);
+  put(ehdr, ET_REL, 2);
+  put(ehdr, static_cast<uint16_t>(machine_), 2);
+  put(ehdr, EV_CURRENT, 4);
+  put(ehdr, 0, 8);                              // e_entry
+  put(ehdr, 0, 8);                              // e_phoff
+  put(ehdr, shoff, 8);
+  put(ehdr, 0, 4);                              // e_flags
+  put(ehdr, EHDR_SIZE, 2);
+  put(ehdr, 0, 2);                              // e_phentsize
+  put(ehdr, 0, 2);                              // e_phnum
+  put(ehdr, SHDR_SIZE, 2);
+  put(ehdr, SectionCount, 2);
+  put(ehdr, SectionShstrtab, 2);
+
+  out.replace(0, EHDR_SIZE, ehdr);
+
+  return out;
+}
+
+/*
+ * Check that `image' starts with a 64-bit little-endian ELF header
+ * whose section header table lies within it.
+ */
+static
+bool
+check_header(const string &image)
+{
+  uint64_t shoff;
+  uint64_t shnum;
+
+  if (image.size() < EHDR_SIZE ||
+      memcmp(image.data(), "\x7f" "ELF", 4) != 0 ||
+      image[4] != 2 ||
+      image[5] != 1) {
+    return false;
+  }
+
+  shoff = get(image, 0x28, 8);
+  shnum = get(image, 0x3C, 2);
+
+  return get(image, 0x3A, 2) == SHDR_SIZE
+      && shoff <= image.size()
+      && shnum <= (image.size() - shoff) / SHDR_SIZE;
+}
+
+/**
+ * @brief Get the machine of an object written by @c ElfObject.
+ * @returns false if @c image is not one, or is for another machine.
+ */
+bool
+elf_get_machine(const string &image, ElfMachine &machine)
+{
+  uint64_t value;
+
+  if (!check_header(image)) {
+    return false;
+  }
+
+  value = get(image, 0x12, 2);
+
+  switch (value) {
+    case static_cast<uint16_t>(ElfMachine::X86_64):
+    case static_cast<uint16_t>(ElfMachine::AArch64):
+      machine = static_cast<ElfMachine>(value);
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief Find the first note with the given owner and type.
+ * @param image A 64-bit little-endian ELF file.
+ * @param desc Set to the note's descriptor.
+ * @returns false if there is no such note or the file is malformed.
+ */
+bool
+elf_find_note(const string &image,
+              const string &owner,
+              uint32_t      type,
+              string       &desc)
+{
+  uint64_t shoff;
+  uint64_t shnum;
+
+  if (!check_header(image)) {
+    return false;
+  }
+
+  shoff = get(image, 0x28, 8);
+  shnum = get(image, 0x3C, 2);
+
+  for (uint64_t i = 0; i < shnum; i++) {
+    uint64_t hdr = shoff + i * SHDR_SIZE;
+    uint64_t pos;
+    uint64_t end;
+
+    if (get(image, hdr + 4, 4) != SHT_NOTE) {
+      continue;
+    }
+
+    pos = get(image, hdr + 24, 8);
+    end = pos + get(image, hdr + 32, 8);
+
+    if (pos > image.size() || end > image.size() || end < pos) {
+      return false;
+    }
+
+    while (end - pos >= 12) {
+      uint64_t namesz = get(image, pos, 4);
+      uint64_t descsz = get(image, pos + 4, 4);
+      uint64_t ntype  = get(image, pos + 8, 4);
+      uint64_t name   = pos + 12;
+      uint64_t data   = name + ((namesz + 3) & ~3ULL);
+      uint64_t next   = data + ((descsz + 3) & ~3ULL);
+
+      if (next > end) {
+        return false;
+      }
+
+      if (ntype == type &&
+          namesz == owner.size() + 1 &&
+          image.compare(name, owner.size(), owner) == 0) {
+        desc.assign(image, data, descsz);
+        return true;
+      }
+
+      pos = next;
+    }
+  }
+
+  return false;
+}
+
+// ElfObject.cpp ends here.
@@ -0,0 +1,100 @@
+//
+// ElfObject.hpp --- Relocatable ELF object writer.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:48:22
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file ElfObject.hpp
+ * @author Paul Ward
+ * @brief Relocatable ELF object writer.
+ *
+ * Builds a 64-bit little-endian @c ET_REL object holding read-only data
+ * and notes, which the system linker can take as it stands.  Each
+ * object added gets a global symbol in @c .rodata.  Nothing refers to
+ * an address, so the object needs no relocations.
+ *
+ * All the ELF structures are written field by field, so the host's
+ * @c <elf.h> is not needed and the output is the same on every
+ * platform.
+ */
+
+#pragma once
+#ifndef _ElfObject_hpp_
+#define _ElfObject_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class ElfMachine : std::uint16_t {
+  X86_64  = 62,                 //!< EM_X86_64
+  AArch64 = 183,                //!< EM_AARCH64
+};
+
+class ElfObject
+{
+private:
+  struct Symbol {
+    std::string   name;
+    std::uint64_t offset;
+    std::uint64_t size;
+  };
+
+  ElfMachine          machine_;
+  std::string         rodata_;
+  std::string         notes_;
+  std::vector<Symbol> symbols_;
+  std::uint64_t       rodata_align_;
+
+public:
+  ElfObject(ElfMachine);
+
+  ElfMachine get_machine() const;
+
+  void add_object(const std::string &, const void *, std::size_t, std::size_t);
+  void add_string(const std::string &, const std::string &);
+  void add_note(const std::string &, std::uint32_t, const void *, std::size_t);
+
+  std::string to_string() const;
+
+  static ElfMachine host_machine();
+};
+
+bool elf_find_note(const std::string &,
+                   const std::string &,
+                   std::uint32_t,
+                   std::string &);
+
+bool elf_get_machine(const std::string &, ElfMachine &);
+
+#endif // !_ElfObject_hpp_
+
+// ElfObject.hpp ends here.
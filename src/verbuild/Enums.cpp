@@ -48,11 +48,15 @@ ostream &
 operator<<(ostream &os, const IncrementType &obj)
 {
   switch (obj) {
-    case IncrementType::ByMonths: os << "months";  break;
-    case IncrementType::ByYears:  os << "years";   break;
-    case IncrementType::ByDate:   os << "date";    break;
-    case IncrementType::Simple:   os << "simple";  break;
-    default:                      os << "<unset>"; break;
+    case IncrementType::ByMonths: os << "months";   break;
+    case IncrementType::ByYears:  os << "years";    break;
+    case IncrementType::ByDate:   os << "date";     break;
+    case IncrementType::Simple:   os << "simple";   break;
+    case IncrementType::Script:   os << "script";   break;
+    case IncrementType::GitTag:   os << "gittag";   break;
+    case IncrementType::GitSha:   os << "gitsha";   break;
+    case IncrementType::GitCount: os << "gitcount"; break;
+    default:                      os << "<unset>";  break;
   }
 
   return os;
@@ -105,6 +109,10 @@ operator<<(ostream &os, const OutputGroups &obj)
     modes.push_back("doxygen");
   }
 
+  if ((obj & OutputGroups::Cxx17) != OutputGroups::None) {
+    modes.push_back("cxx17");
+  }
+
   if (modes.size() == 0) {
     os << "<not set>";
   } else {
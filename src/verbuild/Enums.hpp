@@ -47,6 +47,10 @@ enum class IncrementType {
   ByYears,
   ByDate,
   Simple,
+  Script,
+  GitTag,
+  GitSha,
+  GitCount,
 };
 
 enum class IncrementMode : unsigned char {
@@ -68,6 +72,7 @@ enum class OutputGroups : unsigned char {
   Basic   = 0x01,
   Struct  = 0x02,
   Doxygen = 0x04,
+  Cxx17   = 0x08,
   All     = 0xFF
 };
 ENABLE_BITMASK_OPS(OutputGroups);
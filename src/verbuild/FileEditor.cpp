@@ -0,0 +1,383 @@
+//
+// FileEditor.cpp --- In-place file editing.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 19:09:51
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file FileEditor.cpp
+ * @author Paul Ward
+ * @brief In-place file editing.
+ */
+
+#include "FileEditor.hpp"
+#include "Console.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <fcntl.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using namespace std;
+
+static
+void
+sort_edits(FileEditVector &edits)
+{
+  sort(edits.begin(), edits.end(), [](const FileEdit &a, const FileEdit &b) {
+    return a.offset < b.offset;
+  });
+}
+
+FileEditor::FileEditor()
+  : fd_(-1),
+    path_(),
+    size_(0),
+    written_(0)
+{}
+
+FileEditor::~FileEditor()
+{
+  close();
+}
+
+/**
+ * @brief Open an existing file for editing.
+ * @returns false if the file cannot be opened for reading and writing.
+ */
+bool
+FileEditor::open(const string &path)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  DSAY(DEBUG_MEDIUM, "In-place editing is not supported on this platform.");
+  return false;
+#else
+  struct stat st;
+
+  close();
+
+  fd_ = ::open(path.c_str(), O_RDWR);
+  if (fd_ < 0) {
+    DSAY(DEBUG_MEDIUM, "Cannot open", path, "for editing:", strerror(errno));
+    return false;
+  }
+
+  if (::fstat(fd_, &st) != 0 || !S_ISREG(st.st_mode)) {
+    close();
+    return false;
+  }
+
+  path_    = path;
+  size_    = static_cast<uint64_t>(st.st_size);
+  written_ = 0;
+
+  return true;
+#endif
+}
+
+void
+FileEditor::close()
+{
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+#endif
+
+  fd_ = -1;
+}
+
+bool
+FileEditor::is_open() const
+{
+  return fd_ >= 0;
+}
+
+/**
+ * @brief Read the file sequentially from the start.
+ * @returns The number of bytes read; 0 at the end or on error.
+ */
+size_t
+FileEditor::read(char *buffer, size_t len)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  (void)buffer;
+  (void)len;
+
+  return 0;
+#else
+  ssize_t got;
+
+  do {
+    got = ::read(fd_, buffer, len);
+  } while (got < 0 && errno == EINTR);
+
+  return (got < 0) ? 0 : static_cast<size_t>(got);
+#endif
+}
+
+/**
+ * @brief Apply a set of edits.
+ * @param edits Non-overlapping edits, in any order; sorted on return.
+ * @returns false on overlapping edits or an I/O error.
+ *
+ * Edits whose text already matches the file are skipped.  Edits of
+ * unchanged width before the first change of width are written in
+ * place.  From that edit on, the region up to the end of the last
+ * edit is rebuilt in memory and the rest of the file is shifted.
+ */
+bool
+FileEditor::apply(FileEditVector &edits)
+{
+  FileEditVector live;
+  int64_t        delta = 0;
+  size_t         first = 0;
+
+  sort_edits(edits);
+
+  for (size_t i = 0; i < edits.size(); i++) {
+    const FileEdit &edit = edits[i];
+    string          old(edit.length, '\0');
+
+    if (i > 0 && edits[i - 1].offset + edits[i - 1].length > edit.offset) {
+      ESAY("Overlapping edits in", path_);
+      return false;
+    }
+
+    if (edit.offset + edit.length > size_) {
+      ESAY("Edit past the end of", path_);
+      return false;
+    }
+
+    if (!read_at(edit.offset, &old[0], old.size())) {
+      return false;
+    }
+
+    if (old != edit.text) {
+      live.push_back(edit);
+      delta += static_cast<int64_t>(edit.text.size()) -
+               static_cast<int64_t>(edit.length);
+    }
+  }
+
+  while (first < live.size() && live[first].text.size() == live[first].length) {
+    if (!write_at(live[first].offset,
+                  live[first].text.data(),
+                  live[first].text.size())) {
+      return false;
+    }
+
+    first++;
+  }
+
+  if (first == live.size()) {
+    return true;
+  }
+
+  {
+    uint64_t start = live[first].offset;
+    uint64_t end   = live.back().offset + live.back().length;
+    uint64_t pos   = start;
+    string   region(end - start, '\0');
+    string   rebuilt;
+
+    if (!read_at(start, &region[0], region.size())) {
+      return false;
+    }
+
+    rebuilt.reserve(region.size() + max<int64_t>(delta, 0));
+
+    for (size_t i = first; i < live.size(); i++) {
+      rebuilt.append(region, pos - start, live[i].offset - pos);
+      rebuilt.append(live[i].text);
+      pos = live[i].offset + live[i].length;
+    }
+
+    // The old region has been read, so the tail may now overwrite it.
+    if (!shift(end, delta) ||
+        !write_at(start, rebuilt.data(), rebuilt.size())) {
+      return false;
+    }
+  }
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+  if (delta < 0 &&
+      ::ftruncate(fd_, static_cast<off_t>(size_ + delta)) != 0) {
+    ESAY("Cannot truncate", path_ + ":", strerror(errno));
+    return false;
+  }
+#endif
+
+  size_ = static_cast<uint64_t>(static_cast<int64_t>(size_) + delta);
+
+  return true;
+}
+
+uint64_t
+FileEditor::get_size() const
+{
+  return size_;
+}
+
+/**
+ * @brief Bytes written by @c apply.
+ */
+uint64_t
+FileEditor::get_written() const
+{
+  return written_;
+}
+
+bool
+FileEditor::read_at(uint64_t offset, char *buffer, size_t len)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  (void)offset;
+  (void)buffer;
+  (void)len;
+
+  return false;
+#else
+  while (len > 0) {
+    ssize_t got = ::pread(fd_, buffer, len, static_cast<off_t>(offset));
+
+    if (got < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (got <= 0) {
+      ESAY("Cannot read", path_ + ":", (got < 0) ? strerror(errno) : "EOF");
+      return false;
+    }
+
+    buffer += got;
+    offset += got;
+    len    -= got;
+  }
+
+  return true;
+#endif
+}
+
+bool
+FileEditor::write_at(uint64_t offset, const char *buffer, size_t len)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  (void)offset;
+  (void)buffer;
+  (void)len;
+
+  return false;
+#else
+  while (len > 0) {
+    ssize_t put = ::pwrite(fd_, buffer, len, static_cast<off_t>(offset));
+
+    if (put < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (put < 0) {
+      ESAY("Cannot write", path_ + ":", strerror(errno));
+      return false;
+    }
+
+    buffer   += put;
+    offset   += put;
+    len      -= put;
+    written_ += put;
+  }
+
+  return true;
+#endif
+}
+
+/**
+ * @brief Move everything from @c from to the end of the file by @c delta.
+ *
+ * Growing copies from the end backwards and shrinking copies from the
+ * front forwards, so no chunk is overwritten before it has been read.
+ */
+bool
+FileEditor::shift(uint64_t from, int64_t delta)
+{
+  char     chunk[FILE_EDIT_CHUNK];
+  uint64_t remain = size_ - from;
+
+  if (delta == 0) {
+    return true;
+  }
+
+  while (remain > 0) {
+    size_t   len = static_cast<size_t>(min<uint64_t>(remain, sizeof(chunk)));
+    uint64_t src = (delta > 0) ? from + remain - len : size_ - remain;
+
+    if (!read_at(src, chunk, len) ||
+        !write_at(static_cast<uint64_t>(static_cast<int64_t>(src) + delta),
+                  chunk,
+                  len)) {
+      return false;
+    }
+
+    remain -= len;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Apply edits to a copy of a buffer.
+ * @param text The original contents.
+ * @param edits Non-overlapping edits; sorted on return.
+ *
+ * The in-memory counterpart of @c FileEditor::apply, for when the
+ * whole file is being written anyway.
+ */
+string
+splice_edits(const string &text, FileEditVector &edits)
+{
+  string out;
+  size_t pos = 0;
+
+  sort_edits(edits);
+  out.reserve(text.size() + 64 * edits.size());
+
+  for (auto &it : edits) {
+    out.append(text, pos, it.offset - pos);
+    out.append(it.text);
+    pos = it.offset + it.length;
+  }
+
+  out.append(text, pos, string::npos);
+
+  return out;
+}
+
+// FileEditor.cpp ends here.
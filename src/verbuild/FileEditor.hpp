@@ -0,0 +1,103 @@
+//
+// FileEditor.hpp --- In-place file editing.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 19 Oct 2026 19:02:18
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file FileEditor.hpp
+ * @author Paul Ward
+ * @brief In-place file editing.
+ *
+ * Replaces byte ranges of an existing file without rewriting it.
+ * Replacements of the same width are written where they stand; when
+ * a width changes, only the bytes from the first such edit onwards
+ * are moved, in bounded chunks.
+ *
+ * Only available on POSIX systems; elsewhere @c open fails and callers
+ * fall back to writing the whole file.
+ */
+
+#pragma once
+#ifndef _FileEditor_hpp_
+#define _FileEditor_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @def FILE_EDIT_CHUNK
+ * @brief Bytes moved per step when shifting the rest of a file.
+ */
+#define FILE_EDIT_CHUNK (64 * 1024)
+
+struct FileEdit
+{
+  std::uint64_t offset;         // First byte replaced.
+  std::uint64_t length;         // Number of bytes replaced.
+  std::string   text;           // Replacement.
+};
+
+typedef std::vector<FileEdit> FileEditVector;
+
+std::string splice_edits(const std::string &, FileEditVector &);
+
+class FileEditor
+{
+private:
+  int           fd_;
+  std::string   path_;
+  std::uint64_t size_;
+  std::uint64_t written_;
+
+public:
+  FileEditor();
+  FileEditor(const FileEditor &) = delete;
+  ~FileEditor();
+
+  bool open(const std::string &);
+  void close();
+  bool is_open() const;
+
+  std::size_t read(char *, std::size_t);
+  bool        apply(FileEditVector &);
+
+  std::uint64_t get_size() const;
+  std::uint64_t get_written() const;
+
+private:
+  bool read_at(std::uint64_t, char *, std::size_t);
+  bool write_at(std::uint64_t, const char *, std::size_t);
+  bool shift(std::uint64_t, std::int64_t);
+};
+
+#endif // !_FileEditor_hpp_
+
+// FileEditor.hpp ends here.
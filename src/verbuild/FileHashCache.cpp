@@ -0,0 +1,307 @@
+//
+// FileHashCache.cpp --- Persistent cache of file content hashes.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 03:57:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file FileHashCache.cpp
+ * @author Paul Ward
+ * @brief Persistent cache of file content hashes.
+ */
+
+#include "FileHashCache.hpp"
+#include "Console.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#define CACHE_MAGIC       "VBHC"
+#define CACHE_VERSION     1
+#define CACHE_HEADER_SIZE 16
+#define CACHE_RECORD_SIZE 48
+
+static inline
+uint64_t
+get_le(const char *p, int bytes)
+{
+  uint64_t val = 0;
+
+  for (int i = bytes - 1; i >= 0; i--) {
+    val = (val << 8) | static_cast<unsigned char>(p[i]);
+  }
+
+  return val;
+}
+
+static inline
+void
+put_le(string &out, uint64_t val, int bytes)
+{
+  for (int i = 0; i < bytes; i++, val >>= 8) {
+    out.push_back(static_cast<char>(val & 0xFF));
+  }
+}
+
+bool
+FileStat::operator==(const FileStat &other) const
+{
+  return dev == other.dev && ino == other.ino &&
+         mtime == other.mtime && size == other.size;
+}
+
+FileHashCache::FileHashCache()
+{
+  clear();
+}
+
+FileHashCache::~FileHashCache()
+{}
+
+void
+FileHashCache::clear()
+{
+  data_.clear();
+  count_     = 0;
+  records_   = nullptr;
+  pool_      = nullptr;
+  pool_size_ = 0;
+}
+
+size_t
+FileHashCache::size() const
+{
+  return count_;
+}
+
+/**
+ * @brief Load a cache file.
+ * @returns false if it is missing or malformed; the cache is then
+ *          empty and everything is a miss.
+ */
+bool
+FileHashCache::load(const string &path)
+{
+  ifstream strm(path, ios::binary);
+  size_t   count;
+  size_t   pool;
+
+  clear();
+
+  if (!strm.is_open()) {
+    return false;
+  }
+
+  strm.seekg(0, ios::end);
+  data_.resize(static_cast<size_t>(strm.tellg()));
+  strm.seekg(0, ios::beg);
+  strm.read(&data_[0], static_cast<streamsize>(data_.size()));
+
+  if (!strm ||
+      data_.size() < CACHE_HEADER_SIZE ||
+      ::memcmp(data_.data(), CACHE_MAGIC, 4) != 0 ||
+      get_le(data_.data() + 4, 4) != CACHE_VERSION) {
+    DSAY(DEBUG_MEDIUM, "Ignoring hash cache", path);
+    clear();
+    return false;
+  }
+
+  count = get_le(data_.data() + 8, 4);
+  pool  = get_le(data_.data() + 12, 4);
+
+  if (data_.size() != CACHE_HEADER_SIZE + count * CACHE_RECORD_SIZE + pool) {
+    WSAY("Hash cache", path, "is truncated, ignoring it.");
+    clear();
+    return false;
+  }
+
+  records_   = data_.data() + CACHE_HEADER_SIZE;
+  pool_      = records_ + count * CACHE_RECORD_SIZE;
+  pool_size_ = pool;
+
+  for (size_t i = 0; i < count; i++) {
+    const char *rec = records_ + i * CACHE_RECORD_SIZE;
+
+    if (get_le(rec, 4) + get_le(rec + 4, 4) > pool_size_) {
+      WSAY("Hash cache", path, "is corrupt, ignoring it.");
+      clear();
+      return false;
+    }
+  }
+
+  count_ = count;
+  DSAY(DEBUG_MEDIUM, "Loaded", count_, "cached hashes from", path);
+
+  return true;
+}
+
+/**
+ * @brief Find the hash of a file, if it has not changed.
+ * @param path The file's path, as it will be given to @c replace.
+ * @param stat Its identity now.
+ * @param hash Receives the cached hash.
+ * @returns false on a miss.
+ */
+bool
+FileHashCache::lookup(const string   &path,
+                      const FileStat &stat,
+                      uint64_t       &hash) const
+{
+  size_t lo = 0;
+  size_t hi = count_;
+
+  while (lo < hi) {
+    size_t      mid = lo + (hi - lo) / 2;
+    const char *rec = records_ + mid * CACHE_RECORD_SIZE;
+    size_t      len = get_le(rec + 4, 4);
+    int         cmp = path.compare(0,
+                                   string::npos,
+                                   pool_ + get_le(rec, 4),
+                                   len);
+
+    if (cmp == 0) {
+      FileStat cached;
+
+      cached.dev   = get_le(rec + 8, 8);
+      cached.ino   = get_le(rec + 16, 8);
+      cached.mtime = static_cast<int64_t>(get_le(rec + 24, 8));
+      cached.size  = get_le(rec + 32, 8);
+
+      if (!(cached == stat)) {
+        return false;
+      }
+
+      hash = get_le(rec + 40, 8);
+      return true;
+    }
+
+    if (cmp > 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Set what the next @c save writes: every file seen this run,
+ *        so files that have gone are dropped.  Takes the entries.
+ */
+void
+FileHashCache::replace(FileHashEntryVector &entries)
+{
+  fresh_.swap(entries);
+  entries.clear();
+}
+
+/**
+ * @brief Write the entries given to @c replace.
+ * @param path The cache file, replaced atomically.
+ * @param scanned When the files were scanned, in nanoseconds.  Entries
+ *                modified within @c HASH_CACHE_SLACK of it are left out:
+ *                a file can change again without its timestamp moving,
+ *                and must then be rehashed next time.
+ */
+bool
+FileHashCache::save(const string &path, int64_t scanned)
+{
+  int64_t    racy  = scanned - HASH_CACHE_SLACK;
+  string     out(CACHE_MAGIC);
+  string     pool;
+  string     tmp(temp_path(path));
+  size_t     count = 0;
+  error_code ec;
+
+  sort(fresh_.begin(),
+       fresh_.end(),
+       [](const FileHashEntry &lhs, const FileHashEntry &rhs) {
+         return lhs.path < rhs.path;
+       });
+
+  for (auto &it : fresh_) {
+    if (it.stat.mtime < racy) {
+      count++;
+    }
+  }
+
+  out.reserve(CACHE_HEADER_SIZE + count * CACHE_RECORD_SIZE);
+  put_le(out, CACHE_VERSION, 4);
+  put_le(out, count, 4);
+  put_le(out, 0, 4);                    // Pool size, patched below.
+
+  for (auto &it : fresh_) {
+    if (it.stat.mtime >= racy) {
+      continue;
+    }
+
+    put_le(out, pool.size(), 4);
+    put_le(out, it.path.size(), 4);
+    put_le(out, it.stat.dev, 8);
+    put_le(out, it.stat.ino, 8);
+    put_le(out, static_cast<uint64_t>(it.stat.mtime), 8);
+    put_le(out, it.stat.size, 8);
+    put_le(out, it.hash, 8);
+    pool.append(it.path);
+  }
+
+  for (int i = 0; i < 4; i++) {
+    out[12 + i] = static_cast<char>((pool.size() >> (i * 8)) & 0xFF);
+  }
+
+  {
+    ofstream strm(tmp, ios::binary);
+
+    strm.write(out.data(), static_cast<streamsize>(out.size()));
+    strm.write(pool.data(), static_cast<streamsize>(pool.size()));
+
+    if (!strm) {
+      strm.close();
+      fs::remove(tmp, ec);
+      return false;
+    }
+  }
+
+  fs::rename(tmp, path, ec);
+  if (ec) {
+    fs::remove(tmp, ec);
+    return false;
+  }
+
+  DSAY(DEBUG_MEDIUM, "Saved", count, "hashes to", path);
+
+  return true;
+}
+
+// FileHashCache.cpp ends here.
@@ -0,0 +1,126 @@
+//
+// FileHashCache.hpp --- Persistent cache of file content hashes.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 03:48:06
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file FileHashCache.hpp
+ * @author Paul Ward
+ * @brief Persistent cache of file content hashes.
+ *
+ * Maps a file's path and identity (device, inode, modification time in
+ * nanoseconds and size) to the hash of its contents, so a file that
+ * has not changed since the last run is never read.
+ *
+ * On disk the cache is a header, an array of fixed-size records
+ * sorted by path, and a pool holding the paths:
+ *
+ *   "VBHC" version:u32 count:u32 pool_size:u32
+ *   count x { path_offset:u32 path_length:u32 dev:u64 ino:u64
+ *             mtime_ns:i64 size:u64 hash:u64 }
+ *   pool_size bytes of paths
+ *
+ * All integers are little-endian.  It is loaded with one read and
+ * searched in place.
+ */
+
+#pragma once
+#ifndef _FileHashCache_hpp_
+#define _FileHashCache_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @def HASH_CACHE_SUFFIX
+ * @brief Appended to the digest file's name for the cache.
+ */
+#define HASH_CACHE_SUFFIX ".cache"
+
+/**
+ * @def HASH_CACHE_SLACK
+ * @brief Nanoseconds before a scan within which a file's timestamp is
+ *        too close to it to be trusted.
+ */
+#define HASH_CACHE_SLACK (2LL * 1000000000)
+
+/**
+ * @brief What identifies one version of a file.
+ */
+struct FileStat
+{
+  std::uint64_t dev;
+  std::uint64_t ino;
+  std::int64_t  mtime;          // Nanoseconds since the epoch.
+  std::uint64_t size;
+
+  bool operator==(const FileStat &) const;
+};
+
+struct FileHashEntry
+{
+  std::string   path;
+  FileStat      stat;
+  std::uint64_t hash;
+};
+
+typedef std::vector<FileHashEntry> FileHashEntryVector;
+
+class FileHashCache
+{
+private:
+  std::string         data_;            // The file as loaded.
+  std::size_t         count_;
+  const char         *records_;
+  const char         *pool_;
+  std::size_t         pool_size_;
+  FileHashEntryVector fresh_;
+
+public:
+  FileHashCache();
+  FileHashCache(const FileHashCache &) = delete;
+  ~FileHashCache();
+
+  bool load(const std::string &);
+  bool save(const std::string &, std::int64_t);
+
+  bool lookup(const std::string &, const FileStat &, std::uint64_t &) const;
+  void replace(FileHashEntryVector &);
+
+  std::size_t size() const;
+
+private:
+  void clear();
+};
+
+#endif // !_FileHashCache_hpp_
+
+// FileHashCache.hpp ends here.
@@ -0,0 +1,218 @@
+//
+// GitPolicy.cpp --- Git-derived increment policy implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 23:48:17
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file GitPolicy.cpp
+ * @author Paul Ward
+ * @brief Git-derived increment policy implementation.
+ */
+
+#include "GitPolicy.hpp"
+#include "VersionInfo.hpp"
+#include "Console.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+using namespace std;
+
+#define TAG_PREFIX "refs/tags/"
+
+static inline
+bool
+is_digit(char ch)
+{
+  return ch >= '0' && ch <= '9';
+}
+
+/*
+ * Parse a run of digits, refusing anything that overflows.
+ */
+static
+bool
+parse_number(const string &str, size_t &pos, uint32_t &val)
+{
+  size_t start = pos;
+
+  val = 0;
+
+  while (pos < str.length() && is_digit(str[pos])) {
+    uint32_t digit = static_cast<uint32_t>(str[pos] - '0');
+
+    if (val > (UINT32_MAX - digit) / 10) {
+      return false;
+    }
+
+    val = val * 10 + digit;
+    pos++;
+  }
+
+  return pos > start;
+}
+
+GitPolicy::GitPolicy()
+{}
+
+GitPolicy::~GitPolicy()
+{}
+
+/**
+ * @brief Find the repository containing a directory.
+ */
+bool
+GitPolicy::open(const string &dir)
+{
+  return repo_.open(dir);
+}
+
+/**
+ * @brief Extract major and minor from a tag name.
+ *
+ * Any non-numeric prefix is skipped, so `v1.2', `release-1.2.3' and
+ * `1.2-rc1' all give 1.2.
+ */
+bool
+GitPolicy::parse_tag(const string &name, uint32_t &major, uint32_t &minor)
+{
+  size_t pos = 0;
+
+  while (pos < name.length() && !is_digit(name[pos])) {
+    pos++;
+  }
+
+  if (!parse_number(name, pos, major)) {
+    return false;
+  }
+
+  if (pos >= name.length() || name[pos] != '.') {
+    return false;
+  }
+
+  pos++;
+
+  return parse_number(name, pos, minor);
+}
+
+/**
+ * @brief Find the highest version among the repository's tags.
+ * @returns false if no tag looks like a version.
+ */
+bool
+GitPolicy::latest_tag(uint32_t &major, uint32_t &minor) const
+{
+  GitRefVector tags;
+  bool         found = false;
+
+  repo_.list_refs(TAG_PREFIX, tags);
+
+  for (auto &it : tags) {
+    uint32_t tmajor;
+    uint32_t tminor;
+
+    if (!parse_tag(it.name.substr(sizeof(TAG_PREFIX) - 1), tmajor, tminor)) {
+      continue;
+    }
+
+    if (!found || tmajor > major || (tmajor == major && tminor > minor)) {
+      major = tmajor;
+      minor = tminor;
+      found = true;
+    }
+  }
+
+  DSAY(DEBUG_MEDIUM, "Scanned", tags.size(), "tags, version found:", found);
+
+  return found;
+}
+
+bool
+GitPolicy::apply(VersionInfo &vi)
+{
+  string   head;
+  uint32_t major  = 0;
+  uint32_t minor  = 0;
+  bool     tagged = false;
+
+  if (!repo_.resolve("HEAD", head)) {
+    ESAY("HEAD does not name a commit.");
+    return false;
+  }
+
+  tagged = latest_tag(major, minor);
+
+  switch (vi.get_increment_type()) {
+    case IncrementType::GitTag:
+      if (tagged && (major != vi.get_major() || minor != vi.get_minor())) {
+        vi.set_major(major);
+        vi.set_minor(minor);
+        vi.set_build(0);
+      } else if (vi.get_build() < UINT32_MAX) {
+        vi.set_build(vi.get_build() + 1);
+      }
+      break;
+
+    case IncrementType::GitSha:
+      if (tagged) {
+        vi.set_major(major);
+        vi.set_minor(minor);
+      }
+
+      // Seven hex digits fit comfortably in 32 bits.
+      vi.set_build(static_cast<uint32_t>(
+        ::strtoul(head.substr(0, GIT_SHORT_OID).c_str(), nullptr, 16)));
+      break;
+
+    case IncrementType::GitCount:
+      {
+        uint64_t count;
+
+        if (!repo_.count_commits(head, count)) {
+          return false;
+        }
+
+        if (tagged) {
+          vi.set_major(major);
+          vi.set_minor(minor);
+        }
+
+        vi.set_build(static_cast<uint32_t>(min<uint64_t>(count, UINT32_MAX)));
+      }
+      break;
+
+    default:
+      ESAY("Increment type", vi.get_increment_type(), "is not git-derived.");
+      return false;
+  }
+
+  vi.set_patch(repo_.is_dirty() ? 1 : 0);
+
+  return true;
+}
+
+// GitPolicy.cpp ends here.
@@ -0,0 +1,79 @@
+//
+// GitPolicy.hpp --- Git-derived increment policy.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 23:41:05
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file GitPolicy.hpp
+ * @author Paul Ward
+ * @brief Git-derived increment policy.
+ *
+ * Backs the `gittag', `gitsha' and `gitcount' increment types.  Major and minor
+ * come from the highest tag that looks like a version number, patch
+ * is 1 when tracked files are modified, and the build number depends
+ * on the type:
+ *
+ *   gittag    counts up from 0 after each new tag
+ *   gitsha    the abbreviated commit hash of HEAD, read as hex
+ *   gitcount  the number of commits reachable from HEAD
+ *
+ * Everything is read from the repository's files; git is never run.
+ */
+
+#pragma once
+#ifndef _GitPolicy_hpp_
+#define _GitPolicy_hpp_
+
+#include "Support.hpp"
+#include "IncrementPolicy.hpp"
+#include "GitRepo.hpp"
+
+#include <cstdint>
+#include <string>
+
+class GitPolicy
+  : public IncrementPolicy
+{
+private:
+  GitRepo repo_;
+
+public:
+  GitPolicy();
+  ~GitPolicy();
+
+  bool open(const std::string &);
+
+  bool latest_tag(std::uint32_t &, std::uint32_t &) const;
+
+  bool apply(VersionInfo &);
+
+  static bool parse_tag(const std::string &, std::uint32_t &, std::uint32_t &);
+};
+
+#endif // !_GitPolicy_hpp_
+
+// GitPolicy.hpp ends here.
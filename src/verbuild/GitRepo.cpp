@@ -0,0 +1,907 @@
+//
+// GitRepo.cpp --- Git repository access.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 22:07:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file GitRepo.cpp
+ * @author Paul Ward
+ * @brief Git repository access.
+ */
+
+#include "GitRepo.hpp"
+#include "Console.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <system_error>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+namespace fs = std::filesystem;
+using namespace std;
+
+/*
+ * Identity of a file on disk; a file replaced by rename has a new
+ * inode even if its size and timestamp happen to match.
+ */
+struct FileStamp {
+  uint64_t dev   = 0;
+  uint64_t ino   = 0;
+  int64_t  mtime = 0;           // Nanoseconds.
+  uint64_t size  = 0;
+
+  bool operator==(const FileStamp &other) const
+  {
+    return dev == other.dev && ino == other.ino &&
+           mtime == other.mtime && size == other.size;
+  }
+};
+
+struct PackedRefs {
+  FileStamp    stamp;
+  GitRefVector refs;            // Sorted by name.
+};
+
+typedef shared_ptr<const PackedRefs> PackedRefsPtr;
+
+static mutex                      packed_lock;
+static map<string, PackedRefsPtr> packed_cache;
+
+/*
+ * Read the first line of a small metadata file.
+ */
+static
+string
+first_line(const fs::path &path)
+{
+  ifstream strm(path);
+  string   line;
+
+  getline(strm, line);
+
+  return trim_copy(line);
+}
+
+static
+bool
+read_file(const string &path, string &data)
+{
+  ifstream strm(path, ios::binary);
+
+  if (!strm.is_open()) {
+    return false;
+  }
+
+  strm.seekg(0, ios::end);
+  data.resize(static_cast<size_t>(strm.tellg()));
+  strm.seekg(0, ios::beg);
+  strm.read(&data[0], static_cast<streamsize>(data.size()));
+
+  return !strm.bad();
+}
+
+static
+bool
+get_stamp(const string &path, FileStamp &stamp)
+{
+  struct stat st;
+
+  if (::stat(path.c_str(), &st) != 0) {
+    return false;
+  }
+
+  stamp.dev   = static_cast<uint64_t>(st.st_dev);
+  stamp.ino   = static_cast<uint64_t>(st.st_ino);
+  stamp.size  = static_cast<uint64_t>(st.st_size);
+  stamp.mtime = static_cast<int64_t>(st.st_mtime) * 1000000000;
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  stamp.mtime += st.st_mtim.tv_nsec;
+#endif
+
+  return true;
+}
+
+static inline
+bool
+is_oid(const string &str)
+{
+  if (str.length() != 40 && str.length() != 64) {
+    return false;
+  }
+
+  return all_of(str.begin(), str.end(), [](char ch) {
+    return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'f');
+  });
+}
+
+static inline
+bool
+ref_less(const GitRef &lhs, const GitRef &rhs)
+{
+  return lhs.name < rhs.name;
+}
+
+/*
+ * Parse `packed-refs', or return the copy parsed last time if the file
+ * has not been replaced since.  Peeled (`^') lines are skipped.
+ */
+static
+PackedRefsPtr
+load_packed_refs(const string &path)
+{
+  lock_guard<mutex> guard(packed_lock);
+  FileStamp         stamp;
+  string            data;
+
+  if (!get_stamp(path, stamp)) {
+    packed_cache.erase(path);
+    return nullptr;
+  }
+
+  auto cached = packed_cache.find(path);
+  if (cached != packed_cache.end() && cached->second->stamp == stamp) {
+    return cached->second;
+  }
+
+  if (!read_file(path, data)) {
+    return nullptr;
+  }
+
+  shared_ptr<PackedRefs> packed = make_shared<PackedRefs>();
+  const char            *p      = data.data();
+  const char            *end    = p + data.size();
+
+  packed->stamp = stamp;
+
+  while (p < end) {
+    const char *eol = static_cast<const char *>(::memchr(p, '\n', end - p));
+    const char *sp;
+
+    if (eol == nullptr) {
+      eol = end;
+    }
+
+    if (*p != '#' && *p != '^') {
+      sp = static_cast<const char *>(::memchr(p, ' ', eol - p));
+
+      if (sp != nullptr) {
+        GitRef ref;
+
+        ref.oid.assign(p, sp);
+        ref.name.assign(sp + 1, eol);
+        rtrim(ref.name);
+
+        if (is_oid(ref.oid)) {
+          packed->refs.push_back(move(ref));
+        }
+      }
+    }
+
+    p = eol + 1;
+  }
+
+  // Git writes them sorted, but nothing requires it.
+  if (!is_sorted(packed->refs.begin(), packed->refs.end(), ref_less)) {
+    sort(packed->refs.begin(), packed->refs.end(), ref_less);
+  }
+
+  DSAY(DEBUG_HIGH, "Loaded", packed->refs.size(), "packed refs from", path);
+  packed_cache[path] = packed;
+
+  return packed;
+}
+
+static inline
+uint32_t
+be32(const unsigned char *p)
+{
+  return (static_cast<uint32_t>(p[0]) << 24) |
+         (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8)  |
+         static_cast<uint32_t>(p[3]);
+}
+
+static inline
+uint16_t
+be16(const unsigned char *p)
+{
+  return static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+/*
+ * Index v4 prefix length: git's offset varint, where each
+ * continuation adds one before shifting.
+ */
+static
+bool
+index_varint(const unsigned char *&p, const unsigned char *end, size_t &val)
+{
+  unsigned char ch;
+
+  if (p >= end) {
+    return false;
+  }
+
+  ch  = *p++;
+  val = ch & 0x7F;
+
+  while (ch & 0x80) {
+    if (p >= end) {
+      return false;
+    }
+
+    ch  = *p++;
+    val = ((val + 1) << 7) | (ch & 0x7F);
+  }
+
+  return true;
+}
+
+/*
+ * Compare an index entry's cached stat data with the file on disk.
+ */
+static
+bool
+entry_changed(const string   &path,
+              const uint32_t  mode,
+              const uint32_t  mtime,
+              const uint32_t  ino,
+              const uint32_t  size)
+{
+  struct stat st;
+
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  if (::stat(path.c_str(), &st) != 0) {
+    return true;
+  }
+#else
+  if (::lstat(path.c_str(), &st) != 0) {
+    return true;
+  }
+
+  if (S_ISLNK(st.st_mode) != ((mode & 0170000) == 0120000)) {
+    return true;
+  }
+
+  if (S_ISREG(st.st_mode) &&
+      ((st.st_mode & S_IXUSR) != 0) != ((mode & 0111) != 0)) {
+    return true;
+  }
+#endif
+
+  return static_cast<uint32_t>(st.st_mtime) != mtime ||
+         static_cast<uint32_t>(st.st_size) != size ||
+         (ino != 0 && static_cast<uint32_t>(st.st_ino) != ino);
+}
+
+typedef pair<string, uint64_t> CommitCount;
+typedef vector<CommitCount>     CommitCountVector;
+
+static
+void
+load_counts(const string &path, CommitCountVector &counts)
+{
+  ifstream strm(path);
+  string   oid;
+  uint64_t count;
+
+  counts.clear();
+
+  while (strm >> oid >> count) {
+    if (is_oid(oid)) {
+      counts.emplace_back(oid, count);
+    }
+  }
+}
+
+static
+bool
+find_count(const CommitCountVector &counts, const string &oid, uint64_t &count)
+{
+  for (auto &it : counts) {
+    if (it.first == oid) {
+      count = it.second;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Remember a count, most recent first, replacing the file atomically
+ * so a concurrent reader never sees half of it.  The file is shared by
+ * every run in the repository, so each writes its own temporary file.
+ */
+static
+void
+save_counts(const string      &path,
+            CommitCountVector &counts,
+            const string      &oid,
+            const uint64_t     count)
+{
+  string     tmp(temp_path(path));
+  error_code ec;
+
+  counts.insert(counts.begin(), CommitCount(oid, count));
+
+  for (size_t i = 1; i < counts.size(); i++) {
+    if (counts[i].first == oid) {
+      counts.erase(counts.begin() + i);
+      break;
+    }
+  }
+
+  if (counts.size() > GIT_COUNT_CACHE_SIZE) {
+    counts.resize(GIT_COUNT_CACHE_SIZE);
+  }
+
+  {
+    ofstream strm(tmp);
+
+    for (auto &it : counts) {
+      strm << it.first << ' ' << it.second << '\n';
+    }
+
+    if (!strm) {
+      DSAY(DEBUG_MEDIUM, "Could not write", tmp);
+      strm.close();
+      fs::remove(tmp, ec);
+      return;
+    }
+  }
+
+  fs::rename(tmp, path, ec);
+  if (ec) {
+    DSAY(DEBUG_MEDIUM, "Could not replace", path + ":", ec.message());
+    fs::remove(tmp, ec);
+  }
+}
+
+GitRepo::GitRepo()
+{}
+
+GitRepo::~GitRepo()
+{}
+
+/**
+ * @brief Find the repository containing a path.
+ * @param start Directory to search from, then each of its parents.
+ * @returns false if no repository was found.
+ */
+bool
+GitRepo::open(const string &start)
+{
+  error_code ec;
+  error_code probe;
+  fs::path   dir = fs::absolute(start, ec);
+
+  work_tree_.clear();
+  git_dir_.clear();
+  common_dir_.clear();
+  graph_.reset();
+
+  for (; !ec && !dir.empty(); dir = dir.parent_path()) {
+    fs::path dot = dir / ".git";
+
+    if (fs::is_directory(dot, probe)) {
+      git_dir_   = dot.string();
+      work_tree_ = dir.string();
+      break;
+    }
+
+    // A worktree or submodule: `.git' is a file naming the directory.
+    if (fs::is_regular_file(dot, probe)) {
+      string line = first_line(dot);
+
+      if (line.compare(0, 8, "gitdir: ") == 0) {
+        fs::path target(line.substr(8));
+
+        if (target.is_relative()) {
+          target = dir / target;
+        }
+
+        git_dir_   = target.lexically_normal().string();
+        work_tree_ = dir.string();
+        break;
+      }
+    }
+
+    if (dir == dir.root_path()) {
+      break;
+    }
+  }
+
+  if (git_dir_.empty()) {
+    DSAY(DEBUG_MEDIUM, "No git repository found above", start);
+    return false;
+  }
+
+  common_dir_ = git_dir_;
+
+  {
+    string common = first_line(fs::path(git_dir_) / "commondir");
+
+    if (!common.empty()) {
+      fs::path target(common);
+
+      if (target.is_relative()) {
+        target = fs::path(git_dir_) / target;
+      }
+
+      common_dir_ = target.lexically_normal().string();
+    }
+  }
+
+  DSAY(DEBUG_MEDIUM, "Git directory:", git_dir_, "common:", common_dir_);
+
+  return true;
+}
+
+const string &
+GitRepo::get_work_tree() const
+{
+  return work_tree_;
+}
+
+const string &
+GitRepo::get_git_dir() const
+{
+  return git_dir_;
+}
+
+const string &
+GitRepo::get_common_dir() const
+{
+  return common_dir_;
+}
+
+/*
+ * HEAD, pseudo-refs and a few namespaces belong to each worktree; all
+ * other refs are shared.
+ */
+const string &
+GitRepo::ref_dir(const string &name) const
+{
+  if (name.find('/') == string::npos ||
+      name.compare(0, 14, "refs/worktree/") == 0 ||
+      name.compare(0, 12, "refs/bisect/") == 0 ||
+      name.compare(0, 15, "refs/rewritten/") == 0) {
+    return git_dir_;
+  }
+
+  return common_dir_;
+}
+
+/**
+ * @brief Resolve a ref to an object name.
+ * @param name `HEAD' or a full ref name.
+ * @param oid Receives the hex object name.
+ * @returns false if the ref does not exist, e.g. on an unborn branch.
+ */
+bool
+GitRepo::resolve(const string &name, string &oid) const
+{
+  string target(name);
+
+  // Git itself gives up on symbolic refs nested deeper than five.
+  for (int depth = 0; depth < 5; depth++) {
+    string content = first_line(fs::path(ref_dir(target)) / target);
+
+    if (content.compare(0, 5, "ref: ") == 0) {
+      target = trim_copy(content.substr(5));
+      continue;
+    }
+
+    if (is_oid(content)) {
+      oid = content;
+      return true;
+    }
+
+    if (!content.empty()) {
+      WSAY("Malformed ref", target, "in", ref_dir(target));
+      return false;
+    }
+
+    PackedRefsPtr packed = load_packed_refs(
+      (fs::path(common_dir_) / "packed-refs").string());
+
+    if (packed != nullptr) {
+      GitRef key;
+
+      key.name = target;
+
+      auto it = lower_bound(packed->refs.begin(),
+                            packed->refs.end(),
+                            key,
+                            ref_less);
+
+      if (it != packed->refs.end() && it->name == target) {
+        oid = it->oid;
+        return true;
+      }
+    }
+
+    DSAY(DEBUG_MEDIUM, "Ref", target, "does not exist.");
+    return false;
+  }
+
+  WSAY("Symbolic ref", name, "is nested too deeply.");
+
+  return false;
+}
+
+/**
+ * @brief List the refs under a prefix.
+ * @param prefix A ref namespace such as `refs/tags/'.
+ * @param refs Receives the refs, sorted by name.  A loose ref shadows
+ *             a packed one of the same name.
+ */
+void
+GitRepo::list_refs(const string &prefix, GitRefVector &refs) const
+{
+  map<string, string> found;
+  PackedRefsPtr       packed;
+  fs::path            base(fs::path(ref_dir(prefix)) / prefix);
+  error_code          ec;
+
+  packed = load_packed_refs((fs::path(common_dir_) / "packed-refs").string());
+  if (packed != nullptr) {
+    GitRef key;
+
+    key.name = prefix;
+
+    for (auto it = lower_bound(packed->refs.begin(),
+                               packed->refs.end(),
+                               key,
+                               ref_less);
+         it != packed->refs.end() &&
+           it->name.compare(0, prefix.length(), prefix) == 0;
+         ++it) {
+      found[it->name] = it->oid;
+    }
+  }
+
+  for (fs::recursive_directory_iterator it(base, ec), end;
+       !ec && it != end;
+       it.increment(ec)) {
+    string name;
+    string oid;
+
+    if (!it->is_regular_file(ec) || it->path().extension() == ".lock") {
+      continue;
+    }
+
+    name = prefix + it->path().lexically_relative(base).generic_string();
+    if (resolve(name, oid)) {
+      found[name] = oid;
+    }
+  }
+
+  refs.clear();
+  refs.reserve(found.size());
+
+  for (auto &it : found) {
+    refs.push_back(GitRef { it.first, it.second });
+  }
+}
+
+/**
+ * @brief Check the work tree for changes to tracked files.
+ *
+ * Each index entry's cached stat data is compared with the file on
+ * disk, as git does before it rehashes anything.  A file that was
+ * touched without being changed therefore counts as modified until git
+ * next refreshes the index.  Untracked files are ignored.
+ *
+ * @returns true if any tracked file was modified, deleted or is
+ *          unmerged.
+ */
+bool
+GitRepo::is_dirty() const
+{
+  string               data;
+  string               config;
+  string               path;
+  size_t               oid_len = 20;
+  const unsigned char *p;
+  const unsigned char *end;
+  uint32_t             version;
+  uint32_t             count;
+
+  if (!read_file((fs::path(git_dir_) / "index").string(), data)) {
+    DSAY(DEBUG_MEDIUM, "No index, nothing is tracked.");
+    return false;
+  }
+
+  if (read_file((fs::path(common_dir_) / "config").string(), config) &&
+      config.find("objectformat") != string::npos &&
+      config.find("sha256") != string::npos) {
+    oid_len = 32;
+  }
+
+  p   = reinterpret_cast<const unsigned char *>(data.data());
+  end = p + data.size();
+
+  if (data.size() < 12 || ::memcmp(p, "DIRC", 4) != 0) {
+    WSAY("Index in", git_dir_, "is not a git index.");
+    return true;
+  }
+
+  version = be32(p + 4);
+  count   = be32(p + 8);
+  p      += 12;
+
+  if (version < 2 || version > 4) {
+    WSAY("Unsupported index version", version);
+    return true;
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    const unsigned char *entry = p;
+    const unsigned char *name;
+    const unsigned char *nul;
+    size_t               fixed = 40 + oid_len + 2;
+    uint16_t             flags;
+    uint16_t             xflags = 0;
+
+    if (static_cast<size_t>(end - p) < fixed) {
+      WSAY("Index in", git_dir_, "is truncated.");
+      return true;
+    }
+
+    flags = be16(p + 40 + oid_len);
+    name  = p + fixed;
+
+    if (version >= 3 && (flags & 0x4000) != 0) {
+      xflags  = be16(name);
+      name   += 2;
+    }
+
+    if (version == 4) {
+      size_t strip;
+
+      if (!index_varint(name, end, strip) || strip > path.length()) {
+        WSAY("Index in", git_dir_, "is corrupt.");
+        return true;
+      }
+
+      path.resize(path.length() - strip);
+    } else {
+      path.clear();
+    }
+
+    nul = static_cast<const unsigned char *>(::memchr(name, 0, end - name));
+    if (nul == nullptr) {
+      WSAY("Index in", git_dir_, "is truncated.");
+      return true;
+    }
+
+    path.append(reinterpret_cast<const char *>(name), nul - name);
+
+    // Versions 2 and 3 pad each entry with NULs to a multiple of 8.
+    if (version == 4) {
+      p = nul + 1;
+    } else {
+      p = entry + ((nul - entry + 8) & ~static_cast<ptrdiff_t>(7));
+    }
+
+    // Unmerged, or added with `git add -N'.
+    if ((flags & 0x3000) != 0 || (xflags & 0x2000) != 0) {
+      DSAY(DEBUG_MEDIUM, "Dirty: unmerged or intent-to-add", path);
+      return true;
+    }
+
+    // Assume-unchanged, skip-worktree and submodules are not checked.
+    if ((flags & 0x8000) != 0 || (xflags & 0x4000) != 0 ||
+        (be32(entry + 24) & 0170000) == 0160000) {
+      continue;
+    }
+
+    if (entry_changed((fs::path(work_tree_) / path).string(),
+                      be32(entry + 24),
+                      be32(entry + 8),
+                      be32(entry + 20),
+                      be32(entry + 36))) {
+      DSAY(DEBUG_MEDIUM, "Dirty:", path);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Read the parents of a loose commit object.
+ * @returns false if the commit is not loose, or zlib is unavailable.
+ */
+bool
+GitRepo::read_commit(const string &oid, StringVector &parents) const
+{
+#ifdef HAVE_ZLIB
+  string        packed;
+  string        data;
+  unsigned char buf[4096];
+  z_stream      zs = {};
+  int           status;
+  size_t        pos;
+
+  parents.clear();
+
+  if (!is_oid(oid) ||
+      !read_file((fs::path(common_dir_) / "objects" / oid.substr(0, 2) /
+                  oid.substr(2)).string(), packed)) {
+    return false;
+  }
+
+  if (inflateInit(&zs) != Z_OK) {
+    return false;
+  }
+
+  zs.next_in  = reinterpret_cast<Bytef *>(&packed[0]);
+  zs.avail_in = static_cast<uInt>(packed.size());
+
+  do {
+    zs.next_out  = buf;
+    zs.avail_out = sizeof(buf);
+    status       = inflate(&zs, Z_NO_FLUSH);
+
+    if (status != Z_OK && status != Z_STREAM_END) {
+      break;
+    }
+
+    data.append(reinterpret_cast<char *>(buf), sizeof(buf) - zs.avail_out);
+  } while (status != Z_STREAM_END);
+
+  inflateEnd(&zs);
+
+  if (status != Z_STREAM_END || data.compare(0, 7, "commit ") != 0) {
+    DSAY(DEBUG_MEDIUM, "Object", oid, "is not a readable commit.");
+    return false;
+  }
+
+  // The header ends at the first blank line; parents follow the tree.
+  pos = data.find('\0');
+
+  while (pos != string::npos && pos + 1 < data.length()) {
+    size_t eol = data.find('\n', pos + 1);
+
+    if (eol == string::npos || eol == pos + 1) {
+      break;
+    }
+
+    if (data.compare(pos + 1, 7, "parent ") == 0) {
+      parents.push_back(data.substr(pos + 8, eol - pos - 8));
+    }
+
+    pos = eol;
+  }
+
+  return true;
+#else
+  (void)oid;
+  parents.clear();
+
+  return false;
+#endif
+}
+
+/**
+ * @brief Count the commits reachable from a commit, itself included.
+ *
+ * Equivalent to `git rev-list --count'.  Loose commits newer than the
+ * commit-graph are walked individually until they reach it; the rest
+ * is counted from the graph.
+ *
+ * @returns false if a commit is in neither the graph nor a loose
+ *          object, e.g. because the graph is missing or stale.
+ */
+bool
+GitRepo::count_commits(const string &oid, uint64_t &count) const
+{
+  string            cache((fs::path(common_dir_) / GIT_COUNT_CACHE).string());
+  CommitCountVector counts;
+  CommitPosVector   starts;
+  StringVector      todo;
+  StringVector      parents;
+  set<string>       loose;
+  uint64_t          known;
+  uint32_t          pos;
+
+  load_counts(cache, counts);
+
+  if (find_count(counts, oid, count)) {
+    DSAY(DEBUG_MEDIUM, "Commit count for", oid, "is cached.");
+    return true;
+  }
+
+  if (graph_ == nullptr) {
+    graph_.reset(new CommitGraph());
+    graph_->open((fs::path(common_dir_) / "objects").string());
+  }
+
+  // The usual case: one new commit on top of the last one counted.
+  if (!graph_->find(oid, pos) &&
+      read_commit(oid, parents) &&
+      parents.size() == 1 &&
+      find_count(counts, parents[0], known)) {
+    count = known + 1;
+    save_counts(cache, counts, oid, count);
+    return true;
+  }
+
+  todo.push_back(oid);
+
+  while (!todo.empty()) {
+    string next = todo.back();
+
+    todo.pop_back();
+
+    if (graph_->find(next, pos)) {
+      starts.push_back(pos);
+      continue;
+    }
+
+    if (loose.count(next) != 0) {
+      continue;
+    }
+
+    if (!read_commit(next, parents)) {
+      ESAY("Commit", next, "is not in the commit-graph.");
+      ESAY("Run `git commit-graph write --reachable' to update it.");
+      return false;
+    }
+
+    loose.insert(next);
+    todo.insert(todo.end(), parents.begin(), parents.end());
+  }
+
+  if (!graph_->count_reachable(starts, known)) {
+    return false;
+  }
+
+  count = known + loose.size();
+  DSAY(DEBUG_MEDIUM, "Counted", count, "commits,", loose.size(), "loose.");
+  save_counts(cache, counts, oid, count);
+
+  return true;
+}
+
+// GitRepo.cpp ends here.
@@ -0,0 +1,121 @@
+//
+// GitRepo.hpp --- Git repository access.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 22:03:14
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file GitRepo.hpp
+ * @author Paul Ward
+ * @brief Git repository access.
+ *
+ * Locates a repository's metadata without running git.  A linked
+ * worktree has its own git directory, holding HEAD, and shares the
+ * refs of a common directory named by its `commondir' file; for an
+ * ordinary checkout both are the same `.git' directory.
+ *
+ * References are resolved by reading loose ref files and
+ * `packed-refs' directly.  The parsed `packed-refs' is cached for the
+ * life of the process and reloaded only when its inode, size or
+ * modification time change.
+ *
+ * Commits are counted from the commit-graph.  Commits made since it
+ * was last written are read from their loose objects when zlib is
+ * available.  Counts are remembered per commit in the common directory,
+ * so asking again for the same HEAD, or for a commit whose only parent
+ * was counted before, costs one small file read.
+ */
+
+#pragma once
+#ifndef _GitRepo_hpp_
+#define _GitRepo_hpp_
+
+#include "Support.hpp"
+#include "CommitGraph.hpp"
+#include "Utils.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @def GIT_SHORT_OID
+ * @brief Number of hex digits in an abbreviated object name.
+ */
+#define GIT_SHORT_OID 7
+
+/**
+ * @def GIT_COUNT_CACHE
+ * @brief File in the common directory holding remembered commit counts.
+ */
+#define GIT_COUNT_CACHE "verbuild-commits"
+
+/**
+ * @def GIT_COUNT_CACHE_SIZE
+ * @brief Number of commit counts remembered, most recent first.
+ */
+#define GIT_COUNT_CACHE_SIZE 64
+
+struct GitRef {
+  std::string name;             //!< Full name, e.g. `refs/tags/v1.2'.
+  std::string oid;              //!< Hex object name.
+};
+typedef std::vector<GitRef> GitRefVector;
+
+class GitRepo
+{
+private:
+  std::string work_tree_;
+  std::string git_dir_;
+  std::string common_dir_;
+
+  mutable std::unique_ptr<CommitGraph> graph_;
+
+public:
+  GitRepo();
+  ~GitRepo();
+
+  bool open(const std::string &);
+
+  const std::string &get_work_tree() const;
+  const std::string &get_git_dir() const;
+  const std::string &get_common_dir() const;
+
+  bool resolve(const std::string &, std::string &) const;
+  void list_refs(const std::string &, GitRefVector &) const;
+  bool is_dirty() const;
+
+  bool read_commit(const std::string &, StringVector &) const;
+  bool count_commits(const std::string &, std::uint64_t &) const;
+
+private:
+  const std::string &ref_dir(const std::string &) const;
+};
+
+#endif // !_GitRepo_hpp_
+
+// GitRepo.hpp ends here.
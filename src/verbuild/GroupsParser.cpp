@@ -99,6 +99,7 @@ GroupsParser::generate_allowed()
   allowed_.push_back("basic");
   allowed_.push_back("struct");
   allowed_.push_back("doxygen");
+  allowed_.push_back("cxx17");
   allowed_.push_back("all");
 }
 
@@ -135,6 +136,11 @@ GroupsParser::parse(const string &what)
       DSAY(DEBUG_VERYHIGH, "Adding group `doxygen'.");
       groups_ |= OutputGroups::Doxygen;
     }
+
+    if (it == "cxx17") {
+      DSAY(DEBUG_VERYHIGH, "Adding group `cxx17'.");
+      groups_ |= OutputGroups::Cxx17;
+    }
   }
 }
 
@@ -161,6 +167,10 @@ GroupsParser::cache_string()
     list.push_back("doxygen");
   }
 
+  if ((groups_ & OutputGroups::Cxx17) != OutputGroups::None) {
+    list.push_back("cxx17");
+  }
+
 done:
   ss << boost::algorithm::join(list, ",");
   str_.assign(ss.str());
@@ -0,0 +1,258 @@
+//
+// Hash.cpp --- Fast non-cryptographic hashing.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 02:16:58
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Hash.cpp
+ * @author Paul Ward
+ * @brief Fast non-cryptographic hashing.
+ */
+
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+static const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+static const uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+static inline
+uint64_t
+rotl(uint64_t val, int bits)
+{
+  return (val << bits) | (val >> (64 - bits));
+}
+
+/*
+ * Little-endian loads, whatever the host.
+ */
+static inline
+uint64_t
+read64(const unsigned char *p)
+{
+  uint64_t val = 0;
+
+  for (int i = 7; i >= 0; i--) {
+    val = (val << 8) | p[i];
+  }
+
+  return val;
+}
+
+static inline
+uint32_t
+read32(const unsigned char *p)
+{
+  return static_cast<uint32_t>(p[0])         |
+         (static_cast<uint32_t>(p[1]) << 8)  |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static inline
+uint64_t
+xxh_round(uint64_t acc, uint64_t input)
+{
+  acc += input * PRIME2;
+  acc  = rotl(acc, 31);
+
+  return acc * PRIME1;
+}
+
+static inline
+uint64_t
+xxh_merge(uint64_t acc, uint64_t lane)
+{
+  acc ^= xxh_round(0, lane);
+
+  return acc * PRIME1 + PRIME4;
+}
+
+/*
+ * Consume whole stripes; returns the bytes used.
+ */
+static inline
+size_t
+stripes(uint64_t lanes[4], const unsigned char *p, size_t len)
+{
+  size_t used = 0;
+
+  for (; used + 32 <= len; used += 32, p += 32) {
+    lanes[0] = xxh_round(lanes[0], read64(p));
+    lanes[1] = xxh_round(lanes[1], read64(p + 8));
+    lanes[2] = xxh_round(lanes[2], read64(p + 16));
+    lanes[3] = xxh_round(lanes[3], read64(p + 24));
+  }
+
+  return used;
+}
+
+Hasher::Hasher(uint64_t seed)
+{
+  reset(seed);
+}
+
+void
+Hasher::reset(uint64_t seed)
+{
+  seed_     = seed;
+  length_   = 0;
+  buffered_ = 0;
+  lanes_[0] = seed + PRIME1 + PRIME2;
+  lanes_[1] = seed + PRIME2;
+  lanes_[2] = seed;
+  lanes_[3] = seed - PRIME1;
+}
+
+void
+Hasher::update(const void *data, size_t len)
+{
+  const unsigned char *p = static_cast<const unsigned char *>(data);
+
+  length_ += len;
+
+  if (buffered_ > 0) {
+    size_t take = min(len, sizeof(buffer_) - buffered_);
+
+    ::memcpy(buffer_ + buffered_, p, take);
+    buffered_ += take;
+    p         += take;
+    len       -= take;
+
+    if (buffered_ < sizeof(buffer_)) {
+      return;
+    }
+
+    stripes(lanes_, buffer_, sizeof(buffer_));
+    buffered_ = 0;
+  }
+
+  size_t used = stripes(lanes_, p, len);
+
+  ::memcpy(buffer_, p + used, len - used);
+  buffered_ = len - used;
+}
+
+uint64_t
+Hasher::digest() const
+{
+  const unsigned char *p   = buffer_;
+  const unsigned char *end = buffer_ + buffered_;
+  uint64_t             h;
+
+  if (length_ >= 32) {
+    h = rotl(lanes_[0], 1) + rotl(lanes_[1], 7) +
+        rotl(lanes_[2], 12) + rotl(lanes_[3], 18);
+    h = xxh_merge(h, lanes_[0]);
+    h = xxh_merge(h, lanes_[1]);
+    h = xxh_merge(h, lanes_[2]);
+    h = xxh_merge(h, lanes_[3]);
+  } else {
+    h = seed_ + PRIME5;
+  }
+
+  h += length_;
+
+  for (; p + 8 <= end; p += 8) {
+    h ^= xxh_round(0, read64(p));
+    h  = rotl(h, 27) * PRIME1 + PRIME4;
+  }
+
+  if (p + 4 <= end) {
+    h ^= static_cast<uint64_t>(read32(p)) * PRIME1;
+    h  = rotl(h, 23) * PRIME2 + PRIME3;
+    p += 4;
+  }
+
+  for (; p < end; p++) {
+    h ^= (*p) * PRIME5;
+    h  = rotl(h, 11) * PRIME1;
+  }
+
+  h ^= h >> 33;
+  h *= PRIME2;
+  h ^= h >> 29;
+  h *= PRIME3;
+  h ^= h >> 32;
+
+  return h;
+}
+
+uint64_t
+hash_bytes(const void *data, size_t len, uint64_t seed)
+{
+  Hasher hasher(seed);
+
+  hasher.update(data, len);
+
+  return hasher.digest();
+}
+
+string
+hash_to_hex(uint64_t hash)
+{
+  static const char digits[] = "0123456789abcdef";
+  string            hex(16, '0');
+
+  for (int i = 15; i >= 0; i--, hash >>= 4) {
+    hex[i] = digits[hash & 0xF];
+  }
+
+  return hex;
+}
+
+bool
+hash_from_hex(const string &hex, uint64_t &hash)
+{
+  if (hex.length() != 16) {
+    return false;
+  }
+
+  hash = 0;
+
+  for (char ch : hex) {
+    hash <<= 4;
+
+    if (ch >= '0' && ch <= '9') {
+      hash |= static_cast<uint64_t>(ch - '0');
+    } else if (ch >= 'a' && ch <= 'f') {
+      hash |= static_cast<uint64_t>(ch - 'a' + 10);
+    } else {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Hash.cpp ends here.
@@ -0,0 +1,77 @@
+//
+// Hash.hpp --- Fast non-cryptographic hashing.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 02:10:33
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Hash.hpp
+ * @author Paul Ward
+ * @brief Fast non-cryptographic hashing.
+ *
+ * XXH64, computed incrementally.  Input is consumed in 32-byte
+ * stripes across four independent 64-bit lanes, which keeps the
+ * multipliers pipelined and lets the compiler vectorise the loop; the
+ * result is bit-for-bit the published XXH64 so digests can be checked
+ * with other tools.
+ *
+ * Suitable for detecting change, not for anything adversarial.
+ */
+
+#pragma once
+#ifndef _Hash_hpp_
+#define _Hash_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class Hasher
+{
+private:
+  std::uint64_t lanes_[4];
+  std::uint64_t seed_;
+  std::uint64_t length_;
+  unsigned char buffer_[32];
+  std::size_t   buffered_;
+
+public:
+  Hasher(std::uint64_t = 0);
+
+  void          reset(std::uint64_t = 0);
+  void          update(const void *, std::size_t);
+  std::uint64_t digest() const;
+};
+
+std::uint64_t hash_bytes(const void *, std::size_t, std::uint64_t = 0);
+std::string   hash_to_hex(std::uint64_t);
+bool          hash_from_hex(const std::string &, std::uint64_t &);
+
+#endif // !_Hash_hpp_
+
+// Hash.hpp ends here.
@@ -0,0 +1,946 @@
+//
+// History.cpp --- Append-only increment history.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 06:31:48
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file History.cpp
+ * @author Paul Ward
+ * @brief Append-only increment history.
+ */
+
+#include "History.hpp"
+#include "VersionInfo.hpp"
+#include "Hash.hpp"
+#include "Console.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <random>
+#include <system_error>
+#include <tuple>
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <fcntl.h>
+# include <sys/file.h>
+# include <unistd.h>
+#endif
+
+namespace fs    = std::filesystem;
+namespace date  = boost::gregorian;
+namespace ptime = boost::posix_time;
+using namespace std;
+
+#define JOURNAL_MAGIC   "VBHJ"
+#define INDEX_MAGIC     "VBHI"
+#define HISTORY_VERSION 1
+#define HEADER_SIZE     16
+#define RECORD_FIXED    48              // Bytes after `size', less the name.
+#define INDEX_ENTRY     16
+
+/*
+ * Held while the journal is written; a separate file, so that it
+ * survives the journal being replaced by a compaction.
+ */
+class JournalLock
+{
+private:
+  int fd_;
+
+public:
+  JournalLock(const string &path)
+    : fd_(-1)
+  {
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+    fd_ = ::open((path + HISTORY_LOCK_SUFFIX).c_str(),
+                 O_RDWR | O_CREAT | O_CLOEXEC,
+                 0644);
+
+    if (fd_ >= 0) {
+      ::flock(fd_, LOCK_EX);
+    }
+#else
+    (void)path;
+#endif
+  }
+
+  ~JournalLock()
+  {
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+#endif
+  }
+};
+
+static inline
+uint64_t
+get_le(const char *p, int bytes)
+{
+  uint64_t val = 0;
+
+  for (int i = bytes - 1; i >= 0; i--) {
+    val = (val << 8) | static_cast<unsigned char>(p[i]);
+  }
+
+  return val;
+}
+
+static inline
+void
+put_le(string &out, uint64_t val, int bytes)
+{
+  for (int i = 0; i < bytes; i++, val >>= 8) {
+    out.push_back(static_cast<char>(val & 0xFF));
+  }
+}
+
+static
+void
+put_header(string &out, const char *magic, uint64_t generation)
+{
+  out.append(magic, 4);
+  put_le(out, HISTORY_VERSION, 4);
+  put_le(out, generation, 8);
+}
+
+static
+uint64_t
+new_generation()
+{
+  random_device rd;
+
+  return (static_cast<uint64_t>(rd()) << 32) ^ rd() ^
+         static_cast<uint64_t>(
+           chrono::steady_clock::now().time_since_epoch().count());
+}
+
+static
+void
+encode(const HistoryEntry &entry, string &out)
+{
+  string body;
+
+  put_le(body, static_cast<uint64_t>(entry.time), 8);
+  put_le(body, static_cast<uint64_t>(entry.type), 2);
+  put_le(body, entry.component.size(), 2);
+
+  for (const HistoryVersion *v : { &entry.before, &entry.after }) {
+    put_le(body, v->major, 4);
+    put_le(body, v->minor, 4);
+    put_le(body, v->build, 4);
+    put_le(body, v->patch, 4);
+  }
+
+  body.append(entry.component);
+
+  put_le(out, body.size() + 4, 4);
+  put_le(out, hash_bytes(body.data(), body.size()) & 0xFFFFFFFF, 4);
+  out.append(body);
+}
+
+/*
+ * Decode one record.  Anything short, oversized or failing its check
+ * is a torn or damaged record, and ends the journal.
+ */
+static
+bool
+decode(const char *p, size_t avail, HistoryEntry &entry, size_t &used)
+{
+  size_t      size;
+  const char *body = p + 8;
+
+  if (avail < 8) {
+    return false;
+  }
+
+  size = get_le(p, 4);
+
+  if (size < RECORD_FIXED || size > avail - 4 ||
+      get_le(body + 10, 2) != size - RECORD_FIXED ||
+      get_le(p + 4, 4) != (hash_bytes(body, size - 4) & 0xFFFFFFFF)) {
+    return false;
+  }
+
+  entry.time = static_cast<int64_t>(get_le(body, 8));
+  entry.type = static_cast<IncrementType>(get_le(body + 8, 2));
+
+  entry.before.major = get_le(body + 12, 4);
+  entry.before.minor = get_le(body + 16, 4);
+  entry.before.build = get_le(body + 20, 4);
+  entry.before.patch = get_le(body + 24, 4);
+  entry.after.major  = get_le(body + 28, 4);
+  entry.after.minor  = get_le(body + 32, 4);
+  entry.after.build  = get_le(body + 36, 4);
+  entry.after.patch  = get_le(body + 40, 4);
+
+  entry.component.assign(body + 44, size - RECORD_FIXED);
+  used = size + 4;
+
+  return true;
+}
+
+static
+bool
+read_header(const string &path, const char *magic, uint64_t &generation)
+{
+  ifstream strm(path, ios::binary);
+  char     buf[HEADER_SIZE];
+
+  if (!strm.read(buf, sizeof(buf)) ||
+      ::memcmp(buf, magic, 4) != 0 ||
+      get_le(buf + 4, 4) != HISTORY_VERSION) {
+    return false;
+  }
+
+  generation = get_le(buf + 8, 8);
+
+  return true;
+}
+
+bool
+HistoryVersion::operator==(const HistoryVersion &other) const
+{
+  return major == other.major && minor == other.minor &&
+         build == other.build && patch == other.patch;
+}
+
+bool
+HistoryVersion::operator!=(const HistoryVersion &other) const
+{
+  return !(*this == other);
+}
+
+ostream &
+operator<<(ostream &os, const HistoryVersion &obj)
+{
+  os << obj.major << '.' << obj.minor << '.' << obj.build << '.' << obj.patch;
+
+  return os;
+}
+
+/**
+ * @brief Construct a history.
+ * @param path The journal.
+ * @param component What @c record files increments under.
+ * @param stride Bytes of journal between index entries.
+ */
+History::History(const string &path, const string &component, size_t stride)
+  : path_(path),
+    component_(component),
+    stride_(max<size_t>(stride, 1))
+{}
+
+History::~History()
+{}
+
+const string &
+History::get_path() const
+{
+  return path_;
+}
+
+const string &
+History::get_component() const
+{
+  return component_;
+}
+
+/**
+ * @brief Read records from part of the journal.
+ * @param from Offset of the first record.
+ * @param to Offset to stop at, or @c UINT64_MAX for the end.
+ * @param entries Records are appended to this.
+ * @param end Receives the offset after the last good record.
+ * @returns false if the journal cannot be read.
+ */
+bool
+History::read_range(uint64_t            from,
+                    uint64_t            to,
+                    HistoryEntryVector &entries,
+                    uint64_t           *end) const
+{
+  ifstream     strm(path_, ios::binary);
+  string       data;
+  HistoryEntry entry;
+  uint64_t     size;
+  size_t       used;
+  size_t       off = 0;
+
+  if (!strm.is_open()) {
+    return false;
+  }
+
+  strm.seekg(0, ios::end);
+  size = static_cast<uint64_t>(strm.tellg());
+  to   = min(to, size);
+
+  if (from < to) {
+    data.resize(to - from);
+    strm.seekg(static_cast<streamoff>(from));
+
+    if (!strm.read(&data[0], static_cast<streamsize>(data.size()))) {
+      return false;
+    }
+  }
+
+  while (decode(data.data() + off, data.size() - off, entry, used)) {
+    entries.push_back(entry);
+    off += used;
+  }
+
+  if (end != nullptr) {
+    *end = from + off;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Load the index, rebuilding it from the journal if it is
+ *        missing or belongs to another generation of the journal.
+ * @returns false if there is no journal.
+ */
+bool
+History::load_index(IndexVector &index, uint64_t &generation) const
+{
+  string   idx_path(path_ + HISTORY_INDEX_SUFFIX);
+  uint64_t idx_generation;
+
+  index.clear();
+
+  if (!read_header(path_, JOURNAL_MAGIC, generation)) {
+    return false;
+  }
+
+  if (read_header(idx_path, INDEX_MAGIC, idx_generation) &&
+      idx_generation == generation) {
+    ifstream   strm(idx_path, ios::binary);
+    error_code ec;
+    uint64_t   size = fs::file_size(path_, ec);
+    char       buf[INDEX_ENTRY];
+    bool       sane = !ec;
+
+    strm.seekg(HEADER_SIZE);
+
+    while (sane && strm.read(buf, sizeof(buf))) {
+      IndexEntry entry = { static_cast<int64_t>(get_le(buf, 8)),
+                           get_le(buf + 8, 8) };
+
+      sane = entry.offset < size &&
+             (index.empty() || (entry.offset > index.back().offset &&
+                                entry.time >= index.back().time));
+      index.push_back(entry);
+    }
+
+    if (sane) {
+      return true;
+    }
+
+    index.clear();
+  }
+
+  DSAY(DEBUG_MEDIUM, "Rebuilding history index for", path_);
+
+  HistoryEntryVector entries;
+  string             data;
+  ifstream           strm(path_, ios::binary);
+  HistoryEntry       entry;
+  size_t             used;
+
+  data.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+
+  for (size_t off = HEADER_SIZE;
+       off < data.size() &&
+         decode(data.data() + off, data.size() - off, entry, used);
+       off += used) {
+    if (index.empty() || off >= index.back().offset + stride_) {
+      index.push_back({ entry.time, off });
+    }
+  }
+
+  return true;
+}
+
+/*
+ * Write a whole journal and its index, then move them into place.
+ */
+bool
+History::write(const string             &path,
+               const HistoryEntryVector &entries,
+               uint64_t                  generation) const
+{
+  string     journal;
+  string     index;
+  string     idx_path(path + HISTORY_INDEX_SUFFIX);
+  uint64_t   last = 0;
+  error_code ec;
+
+  put_header(journal, JOURNAL_MAGIC, generation);
+  put_header(index, INDEX_MAGIC, generation);
+
+  for (auto &it : entries) {
+    if (index.size() == HEADER_SIZE || journal.size() >= last + stride_) {
+      last = journal.size();
+      put_le(index, static_cast<uint64_t>(it.time), 8);
+      put_le(index, last, 8);
+    }
+
+    encode(it, journal);
+  }
+
+  for (auto &it : { make_pair(path, &journal), make_pair(idx_path, &index) }) {
+    ofstream strm(it.first + ".tmp", ios::binary);
+
+    strm.write(it.second->data(), static_cast<streamsize>(it.second->size()));
+
+    if (!strm) {
+      return false;
+    }
+  }
+
+  // The journal first: an index left behind is simply rebuilt.
+  fs::rename(path + ".tmp", path, ec);
+  if (!ec) {
+    fs::rename(idx_path + ".tmp", idx_path, ec);
+  }
+
+  return !ec;
+}
+
+/**
+ * @brief Record an increment of this history's component.
+ * @param before The version before the increment.
+ * @param after The version now.
+ */
+bool
+History::record(const HistoryVersion &before, const VersionInfo &after)
+{
+  HistoryEntryVector entries(1);
+
+  entries[0].time      = chrono::duration_cast<chrono::seconds>(
+    chrono::system_clock::now().time_since_epoch()).count();
+  entries[0].type      = after.get_increment_type();
+  entries[0].before    = before;
+  entries[0].after     = { after.get_major(),
+                           after.get_minor(),
+                           after.get_build(),
+                           after.get_patch() };
+  entries[0].component = component_;
+
+  return append(entries);
+}
+
+/**
+ * @brief Append records to the journal.
+ *
+ * A record's time is raised to that of the last record if the clock
+ * has gone backwards, so the journal stays sorted; @c entries is
+ * updated to match.
+ */
+bool
+History::append(HistoryEntryVector &entries)
+{
+  JournalLock        lock(path_);
+  IndexVector        index;
+  HistoryEntryVector tail;
+  uint64_t           generation;
+  uint64_t           end;
+  uint64_t           size;
+  int64_t            last  = INT64_MIN;
+  size_t             fresh;
+  bool               whole = false;
+  string             out;
+  string             idx_out;
+  error_code         ec;
+
+  for (auto &it : entries) {
+    if (it.component.size() > 0xFFFF) {
+      ESAY("Component name", it.component.substr(0, 32) + "...", "is too long.");
+      return false;
+    }
+  }
+
+  if (!load_index(index, generation)) {
+    // No journal yet, or not one of ours; start afresh.
+    if (fs::exists(path_, ec) && fs::file_size(path_, ec) > 0) {
+      ESAY(path_, "is not a history journal.");
+      return false;
+    }
+
+    generation = new_generation();
+    put_header(out, JOURNAL_MAGIC, generation);
+    whole = true;
+  }
+
+  if (!whole) {
+    uint64_t idx_generation = 0;
+
+    // The index is appended to, unless it had to be rebuilt.
+    whole = !read_header(path_ + HISTORY_INDEX_SUFFIX,
+                         INDEX_MAGIC,
+                         idx_generation) ||
+            idx_generation != generation ||
+            fs::file_size(path_ + HISTORY_INDEX_SUFFIX, ec) !=
+              HEADER_SIZE + index.size() * INDEX_ENTRY;
+
+    if (!read_range(index.empty() ? HEADER_SIZE : index.back().offset,
+                    UINT64_MAX,
+                    tail,
+                    &end)) {
+      return false;
+    }
+
+    size = fs::file_size(path_, ec);
+
+    if (!ec && end < size) {
+      WSAY("Discarding", size - end, "bytes of damaged history in", path_);
+      fs::resize_file(path_, end, ec);
+
+      if (ec) {
+        ESAY("Could not repair", path_ + ":", ec.message());
+        return false;
+      }
+    }
+
+    if (!tail.empty()) {
+      last = tail.back().time;
+    }
+  } else {
+    end = 0;                            // `out' starts with the header.
+  }
+
+  fresh = index.size();
+
+  for (auto &it : entries) {
+    uint64_t offset = end + out.size();
+
+    it.time = max(it.time, last);
+    last    = it.time;
+
+    if (index.empty() || offset >= index.back().offset + stride_) {
+      index.push_back({ it.time, offset });
+    }
+
+    encode(it, out);
+  }
+
+  {
+    ofstream strm(path_, ios::binary | ios::app);
+
+    strm.write(out.data(), static_cast<streamsize>(out.size()));
+
+    if (!strm.flush()) {
+      ESAY("Could not write history to", path_);
+      return false;
+    }
+  }
+
+  if (whole) {
+    put_header(idx_out, INDEX_MAGIC, generation);
+    fresh = 0;
+  }
+
+  for (size_t i = fresh; i < index.size(); i++) {
+    put_le(idx_out, static_cast<uint64_t>(index[i].time), 8);
+    put_le(idx_out, index[i].offset, 8);
+  }
+
+  {
+    ofstream strm(path_ + HISTORY_INDEX_SUFFIX,
+                  whole ? ios::binary | ios::trunc : ios::binary | ios::app);
+
+    strm.write(idx_out.data(), static_cast<streamsize>(idx_out.size()));
+
+    if (!strm.flush()) {
+      // The index can always be rebuilt from the journal.
+      WSAY("Could not update the history index for", path_);
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Records from @c since to @c until inclusive, oldest first.
+ * @param component Only this component's, unless empty.
+ */
+bool
+History::list(int64_t             since,
+              int64_t             until,
+              const string       &component,
+              HistoryEntryVector &entries) const
+{
+  IndexVector index;
+  uint64_t    generation;
+  size_t      block;
+
+  entries.clear();
+
+  if (!load_index(index, generation)) {
+    return false;
+  }
+
+  // Start in the last stretch that begins before `since'.
+  block = lower_bound(index.begin(),
+                      index.end(),
+                      since,
+                      [](const IndexEntry &lhs, int64_t rhs) {
+                        return lhs.time < rhs;
+                      }) - index.begin();
+  block = (block > 0) ? block - 1 : 0;
+
+  for (; block < index.size(); block++) {
+    HistoryEntryVector found;
+    uint64_t           to = (block + 1 < index.size())
+                              ? index[block + 1].offset
+                              : UINT64_MAX;
+
+    if (!read_range(index[block].offset, to, found)) {
+      return false;
+    }
+
+    for (auto &it : found) {
+      if (it.time > until) {
+        return true;
+      }
+
+      if (it.time >= since &&
+          (component.empty() || it.component == component)) {
+        entries.push_back(it);
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief The last record at or before @c time.
+ * @param component The component to look for.  If empty, the last
+ *                  record of every component is given, in name order.
+ * @param entries Receives the records; empty if there are none.
+ */
+bool
+History::at(int64_t             time,
+            const string       &component,
+            HistoryEntryVector &entries) const
+{
+  IndexVector index;
+  uint64_t    generation;
+  size_t      block;
+
+  entries.clear();
+
+  if (!load_index(index, generation)) {
+    return false;
+  }
+
+  if (component.empty()) {
+    map<string, HistoryEntry> latest;
+    HistoryEntryVector        found;
+
+    if (!list(INT64_MIN, time, "", found)) {
+      return false;
+    }
+
+    for (auto &it : found) {
+      latest[it.component] = it;
+    }
+
+    for (auto &it : latest) {
+      entries.push_back(it.second);
+    }
+
+    return true;
+  }
+
+  // Search back a stretch at a time from the one holding `time'.
+  block = upper_bound(index.begin(),
+                      index.end(),
+                      time,
+                      [](int64_t lhs, const IndexEntry &rhs) {
+                        return lhs < rhs.time;
+                      }) - index.begin();
+
+  while (block-- > 0) {
+    HistoryEntryVector found;
+    uint64_t           to = (block + 1 < index.size())
+                              ? index[block + 1].offset
+                              : UINT64_MAX;
+
+    if (!read_range(index[block].offset, to, found)) {
+      return false;
+    }
+
+    for (auto it = found.rbegin(); it != found.rend(); it++) {
+      if (it->time <= time && it->component == component) {
+        entries.push_back(*it);
+        return true;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Rewrite the journal without records that changed nothing, or
+ *        that are damaged.
+ * @param before Records before this time are also folded into one per
+ *               component, from its first version to its last.  Pass
+ *               @c INT64_MIN to keep them all.
+ * @param dropped Receives the number of records removed.
+ */
+bool
+History::compact(int64_t before, size_t &dropped)
+{
+  JournalLock         lock(path_);
+  HistoryEntryVector  entries;
+  HistoryEntryVector  kept;
+  map<string, size_t> folded;
+  uint64_t            generation;
+
+  dropped = 0;
+
+  if (!read_header(path_, JOURNAL_MAGIC, generation) ||
+      !read_range(HEADER_SIZE, UINT64_MAX, entries)) {
+    ESAY(path_, "is not a history journal.");
+    return false;
+  }
+
+  for (auto &it : entries) {
+    if (it.before == it.after) {
+      dropped++;
+      continue;
+    }
+
+    if (it.time >= before) {
+      kept.push_back(it);
+      continue;
+    }
+
+    auto found = folded.find(it.component);
+
+    if (found == folded.end()) {
+      folded[it.component] = kept.size();
+      kept.push_back(it);
+      continue;
+    }
+
+    HistoryEntry &first = kept[found->second];
+
+    first.time  = it.time;
+    first.type  = it.type;
+    first.after = it.after;
+    dropped++;
+  }
+
+  // A folded record takes its last time, which may reorder them.
+  stable_sort(kept.begin(),
+              kept.end(),
+              [](const HistoryEntry &lhs, const HistoryEntry &rhs) {
+                return lhs.time < rhs.time;
+              });
+
+  if (!write(path_, kept, new_generation())) {
+    ESAY("Could not rewrite", path_);
+    return false;
+  }
+
+  DSAY(DEBUG_MEDIUM, "Compacted", path_, "from", entries.size(),
+       "to", kept.size(), "records");
+
+  return true;
+}
+
+/**
+ * @brief Merge records into the journal, in time order.  Unlike
+ *        @c append, the records may be older than those already there.
+ * @param added Receives the number of records that were not already
+ *              in the journal.
+ */
+bool
+History::merge(const HistoryEntryVector &entries, size_t &added)
+{
+  JournalLock        lock(path_);
+  HistoryEntryVector merged;
+  uint64_t           generation;
+  size_t             before;
+  error_code         ec;
+
+  added = 0;
+
+  if (read_header(path_, JOURNAL_MAGIC, generation)) {
+    if (!read_range(HEADER_SIZE, UINT64_MAX, merged)) {
+      return false;
+    }
+  } else if (fs::exists(path_, ec) && fs::file_size(path_, ec) > 0) {
+    ESAY(path_, "is not a history journal.");
+    return false;
+  }
+
+  before = merged.size();
+  merged.insert(merged.end(), entries.begin(), entries.end());
+
+  auto key = [](const HistoryEntry &it) {
+    return make_tuple(it.time,
+                      cref(it.component),
+                      it.before.major, it.before.minor,
+                      it.before.build, it.before.patch,
+                      it.after.major, it.after.minor,
+                      it.after.build, it.after.patch,
+                      static_cast<int>(it.type));
+  };
+
+  sort(merged.begin(),
+       merged.end(),
+       [&key](const HistoryEntry &lhs, const HistoryEntry &rhs) {
+         return key(lhs) < key(rhs);
+       });
+
+  // Importing the same records twice changes nothing.
+  merged.erase(unique(merged.begin(),
+                      merged.end(),
+                      [&key](const HistoryEntry &lhs,
+                             const HistoryEntry &rhs) {
+                        return key(lhs) == key(rhs);
+                      }),
+               merged.end());
+
+  added = merged.size() - min(before, merged.size());
+
+  if (!write(path_, merged, new_generation())) {
+    ESAY("Could not rewrite", path_);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Format a time as ISO 8601, in UTC.
+ */
+string
+History::format_time(int64_t time)
+{
+  return ptime::to_iso_extended_string(
+           ptime::from_time_t(static_cast<time_t>(time))) + "Z";
+}
+
+/**
+ * @brief Parse a time given on the command line.
+ *
+ * Accepts `now', `@' and seconds since the epoch, or a UTC date and
+ * time as `YYYY-MM-DD[THH:MM[:SS]]'.  A date alone means the end of
+ * that day, so "the version on a date" includes that day's builds.
+ */
+bool
+History::parse_time(const string &str, int64_t &time)
+{
+  int  year;
+  int  month;
+  int  day;
+  int  hour   = 23;
+  int  minute = 59;
+  int  second = 59;
+  int  used   = 0;
+  char sep;
+
+  if (str == "now") {
+    time = chrono::duration_cast<chrono::seconds>(
+      chrono::system_clock::now().time_since_epoch()).count();
+    return true;
+  }
+
+  if (str.size() > 1 && str[0] == '@') {
+    char *end;
+
+    time = strtoll(str.c_str() + 1, &end, 10);
+    return *end == '\0';
+  }
+
+  if (sscanf(str.c_str(), "%4d-%2d-%2d%n", &year, &month, &day, &used) != 3) {
+    return false;
+  }
+
+  if (static_cast<size_t>(used) < str.size()) {
+    int rest = 0;
+
+    second = 0;
+
+    if (sscanf(str.c_str() + used, "%c%2d:%2d%n",
+               &sep, &hour, &minute, &rest) != 3 ||
+        (sep != 'T' && sep != ' ')) {
+      return false;
+    }
+
+    used += rest;
+
+    if (str[used] == ':') {
+      if (sscanf(str.c_str() + used, ":%2d%n", &second, &rest) != 1) {
+        return false;
+      }
+
+      used += rest;
+    }
+
+    if (str[used] == 'Z') {
+      used++;
+    }
+
+    if (static_cast<size_t>(used) != str.size() ||
+        hour > 23 || minute > 59 || second > 60) {
+      return false;
+    }
+  }
+
+  try {
+    date::date when(year, month, day);
+
+    time = static_cast<int64_t>((when - date::date(1970, 1, 1)).days()) *
+             86400 + hour * 3600 + minute * 60 + second;
+  }
+  catch (std::exception &) {
+    return false;
+  }
+
+  return true;
+}
+
+// History.cpp ends here.
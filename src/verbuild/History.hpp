@@ -0,0 +1,171 @@
+//
+// History.hpp --- Append-only increment history.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 06:15:03
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file History.hpp
+ * @author Paul Ward
+ * @brief Append-only increment history.
+ *
+ * Every increment of a component can be recorded in a journal: when it
+ * happened, the version before and after, and how it was incremented.
+ * Records are only ever appended, and their times never go backwards,
+ * so the journal is sorted by time.
+ *
+ * The journal is a header followed by checksummed records:
+ *
+ *   "VBHJ" version:u32 generation:u64
+ *   { size:u32 check:u32 time:i64 type:u16 name_length:u16
+ *     before:4 x u32 after:4 x u32 name }...
+ *
+ * @c size counts the bytes after itself and @c check is the low half of
+ * the XXH64 of the bytes after it.  A torn record at the end is cut
+ * off by the next append.
+ *
+ * Beside it, a sparse index holds the time and offset of the first
+ * record in each @c HISTORY_INDEX_STRIDE bytes of journal, so a time
+ * is found by a binary search and a scan of one stretch:
+ *
+ *   "VBHI" version:u32 generation:u64 { time:i64 offset:u64 }...
+ *
+ * The generation ties an index to its journal; an index that does not
+ * match is rebuilt.  All integers are little-endian.
+ */
+
+#pragma once
+#ifndef _History_hpp_
+#define _History_hpp_
+
+#include "Support.hpp"
+#include "Enums.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @def HISTORY_INDEX_SUFFIX
+ * @brief Appended to the journal's name for its index.
+ */
+#define HISTORY_INDEX_SUFFIX ".idx"
+
+/**
+ * @def HISTORY_LOCK_SUFFIX
+ * @brief Appended to the journal's name for the file locked while
+ *        writing.
+ */
+#define HISTORY_LOCK_SUFFIX ".lock"
+
+/**
+ * @def HISTORY_INDEX_STRIDE
+ * @brief Bytes of journal between index entries.
+ */
+#define HISTORY_INDEX_STRIDE (64 * 1024)
+
+class VersionInfo;
+
+struct HistoryVersion
+{
+  std::uint32_t major;
+  std::uint32_t minor;
+  std::uint32_t build;
+  std::uint32_t patch;
+
+  bool operator==(const HistoryVersion &) const;
+  bool operator!=(const HistoryVersion &) const;
+};
+
+std::ostream &operator<<(std::ostream &, const HistoryVersion &);
+
+struct HistoryEntry
+{
+  std::int64_t   time;          // Seconds since the epoch, UTC.
+  IncrementType  type;
+  HistoryVersion before;
+  HistoryVersion after;
+  std::string    component;
+};
+
+typedef std::vector<HistoryEntry> HistoryEntryVector;
+
+class History
+{
+private:
+  struct IndexEntry
+  {
+    std::int64_t  time;
+    std::uint64_t offset;
+  };
+
+  typedef std::vector<IndexEntry> IndexVector;
+
+  std::string path_;
+  std::string component_;
+  std::size_t stride_;
+
+public:
+  History(const std::string &,
+          const std::string & = "",
+          std::size_t         = HISTORY_INDEX_STRIDE);
+  History(const History &) = delete;
+  ~History();
+
+  const std::string &get_path() const;
+  const std::string &get_component() const;
+
+  bool record(const HistoryVersion &, const VersionInfo &);
+  bool append(HistoryEntryVector &);
+
+  bool list(std::int64_t,
+            std::int64_t,
+            const std::string &,
+            HistoryEntryVector &) const;
+  bool at(std::int64_t, const std::string &, HistoryEntryVector &) const;
+
+  bool compact(std::int64_t, std::size_t &);
+  bool merge(const HistoryEntryVector &, std::size_t &);
+
+  static std::string format_time(std::int64_t);
+  static bool        parse_time(const std::string &, std::int64_t &);
+
+private:
+  bool load_index(IndexVector &, std::uint64_t &) const;
+  bool read_range(std::uint64_t,
+                  std::uint64_t,
+                  HistoryEntryVector &,
+                  std::uint64_t * = nullptr) const;
+  bool write(const std::string &,
+             const HistoryEntryVector &,
+             std::uint64_t) const;
+};
+
+#endif // !_History_hpp_
+
+// History.hpp ends here.
@@ -0,0 +1,558 @@
+//
+// HistoryArchive.cpp --- Compact archive of increment history.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 09:21:37
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file HistoryArchive.cpp
+ * @author Paul Ward
+ * @brief Compact archive of increment history.
+ */
+
+#include "HistoryArchive.hpp"
+#include "Console.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <system_error>
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#define ARCHIVE_MAGIC   "VBHA"
+#define ARCHIVE_VERSION 1
+#define ARCHIVE_HEADER  16
+#define VARINT_HIGH     0x8080808080808080ULL
+
+typedef const unsigned char *Cursor;
+
+static inline
+uint64_t
+zigzag(int64_t val)
+{
+  return (static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63);
+}
+
+static inline
+int64_t
+unzigzag(uint64_t val)
+{
+  return static_cast<int64_t>(val >> 1) ^ -static_cast<int64_t>(val & 1);
+}
+
+static inline
+void
+put_varint(string &out, uint64_t val)
+{
+  while (val >= 0x80) {
+    out.push_back(static_cast<char>(val | 0x80));
+    val >>= 7;
+  }
+
+  out.push_back(static_cast<char>(val));
+}
+
+static inline
+bool
+get_varint(Cursor &p, Cursor end, uint64_t &val)
+{
+  val = 0;
+
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    unsigned char byte = *p++;
+
+    val |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Decode @c count zigzag varints.  Where the next eight bytes are all
+ * single-byte values, as they nearly always are, they are decoded
+ * together without a branch per byte.
+ */
+static
+bool
+decode_column(Cursor &p, Cursor end, int64_t *out, size_t count)
+{
+  size_t i = 0;
+
+  while (i < count) {
+    if (count - i >= 8 && end - p >= 8) {
+      uint64_t word;
+
+      ::memcpy(&word, p, sizeof(word));
+
+      if ((word & VARINT_HIGH) == 0) {
+        for (int k = 0; k < 8; k++) {
+          out[i + k] = unzigzag(p[k]);
+        }
+
+        p += 8;
+        i += 8;
+        continue;
+      }
+    }
+
+    uint64_t val;
+
+    if (!get_varint(p, end, val)) {
+      return false;
+    }
+
+    out[i++] = unzigzag(val);
+  }
+
+  return true;
+}
+
+static inline
+uint32_t
+get_le32(Cursor p)
+{
+  return static_cast<uint32_t>(p[0]) |
+         (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static inline
+int64_t
+delta(uint32_t now, uint32_t then)
+{
+  return static_cast<int64_t>(now) - static_cast<int64_t>(then);
+}
+
+static
+void
+encode_block(const HistoryEntry *entries, size_t count, string &out)
+{
+  string  bitmap((count + 7) / 8, '\0');
+  int64_t last = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    int64_t diff = entries[i].time - (i > 0 ? entries[i - 1].time : 0);
+
+    put_varint(out, zigzag(i < 2 ? diff : diff - last));
+    last = diff;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    put_varint(out, zigzag(static_cast<int64_t>(entries[i].type)));
+  }
+
+  for (int field = 0; field < 4; field++) {
+    uint32_t HistoryVersion::*member =
+      (field == 0) ? &HistoryVersion::major :
+      (field == 1) ? &HistoryVersion::minor :
+      (field == 2) ? &HistoryVersion::build :
+                     &HistoryVersion::patch;
+    uint32_t before = 0;
+
+    for (size_t i = 0; i < count; i++) {
+      put_varint(out, zigzag(delta(entries[i].after.*member, before)));
+      before = entries[i].after.*member;
+    }
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    if (i > 0 && entries[i].before == entries[i - 1].after) {
+      bitmap[i / 8] |= static_cast<char>(1 << (i % 8));
+    }
+  }
+
+  out.append(bitmap);
+
+  for (size_t i = 0; i < count; i++) {
+    const HistoryEntry &it = entries[i];
+
+    if ((bitmap[i / 8] & (1 << (i % 8))) == 0) {
+      put_varint(out, zigzag(delta(it.before.major, it.after.major)));
+      put_varint(out, zigzag(delta(it.before.minor, it.after.minor)));
+      put_varint(out, zigzag(delta(it.before.build, it.after.build)));
+      put_varint(out, zigzag(delta(it.before.patch, it.after.patch)));
+    }
+  }
+}
+
+size_t
+ArchiveColumns::size() const
+{
+  return time.size();
+}
+
+HistoryArchive::HistoryArchive()
+  : records_(0)
+{}
+
+HistoryArchive::~HistoryArchive()
+{}
+
+const HistoryArchive::SeriesVector &
+HistoryArchive::get_series() const
+{
+  return series_;
+}
+
+size_t
+HistoryArchive::get_block_count() const
+{
+  return blocks_.size();
+}
+
+size_t
+HistoryArchive::get_record_count() const
+{
+  return records_;
+}
+
+/**
+ * @brief Load an archive file.
+ */
+bool
+HistoryArchive::load(const string &path)
+{
+  ifstream strm(path, ios::binary);
+  string   data;
+
+  if (!strm.is_open()) {
+    return false;
+  }
+
+  data.assign(istreambuf_iterator<char>(strm), istreambuf_iterator<char>());
+
+  return parse(data);
+}
+
+/**
+ * @brief Take an archive from memory, and find its blocks.  Nothing is
+ *        decoded until asked for.
+ */
+bool
+HistoryArchive::parse(const string &data)
+{
+  Cursor   base;
+  Cursor   p;
+  Cursor   end;
+  uint64_t count;
+
+  data_.assign(data);
+  series_.clear();
+  blocks_.clear();
+  records_ = 0;
+
+  base = reinterpret_cast<Cursor>(data_.data());
+  end  = base + data_.size();
+
+  if (data_.size() < ARCHIVE_HEADER ||
+      ::memcmp(base, ARCHIVE_MAGIC, 4) != 0 ||
+      get_le32(base + 4) != ARCHIVE_VERSION) {
+    ESAY("Not a history archive.");
+    return false;
+  }
+
+  p = base + ARCHIVE_HEADER;
+
+  count = get_le32(base + 8);
+
+  for (uint64_t i = 0; i < count; i++) {
+    Series   series;
+    uint64_t len;
+    uint64_t records;
+    uint64_t blocks;
+    size_t   total = 0;
+
+    if (!get_varint(p, end, len) ||
+        len > static_cast<uint64_t>(end - p)) {
+      break;
+    }
+
+    series.component.assign(reinterpret_cast<const char *>(p), len);
+    p += len;
+
+    if (!get_varint(p, end, records) || !get_varint(p, end, blocks)) {
+      break;
+    }
+
+    series.records     = records;
+    series.first_block = blocks_.size();
+    series.blocks      = blocks;
+
+    for (uint64_t b = 0; b < blocks; b++) {
+      uint64_t num;
+      uint64_t size;
+
+      if (!get_varint(p, end, num) || !get_varint(p, end, size) ||
+          num == 0 || num > ARCHIVE_BLOCK_SIZE ||
+          size > static_cast<uint64_t>(end - p)) {
+        ESAY("History archive is damaged.");
+        return false;
+      }
+
+      blocks_.push_back({ num, static_cast<size_t>(p - base), size });
+      total += num;
+      p     += size;
+    }
+
+    if (total != records) {
+      ESAY("History archive is damaged.");
+      return false;
+    }
+
+    records_ += records;
+    series_.push_back(series);
+  }
+
+  if (series_.size() != count || p != end) {
+    ESAY("History archive is damaged.");
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Decode one block into columns.
+ */
+bool
+HistoryArchive::decode_block(size_t index, ArchiveColumns &cols)
+{
+  const Block &block = blocks_[index];
+  Cursor       p     = reinterpret_cast<Cursor>(data_.data()) + block.offset;
+  Cursor       end   = p + block.size;
+  size_t       n     = block.count;
+  int64_t     *vals;
+  int64_t      diff  = 0;
+
+  cols.time.resize(n);
+  cols.type.resize(n);
+  cols.before.resize(n);
+  cols.after.resize(n);
+  scratch_.resize(n);
+  vals = scratch_.data();
+
+  if (!decode_column(p, end, vals, n)) {
+    return false;
+  }
+
+  cols.time[0] = vals[0];
+
+  for (size_t i = 1; i < n; i++) {
+    diff         = (i == 1) ? vals[1] : diff + vals[i];
+    cols.time[i] = cols.time[i - 1] + diff;
+  }
+
+  if (!decode_column(p, end, vals, n)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    cols.type[i] = static_cast<IncrementType>(vals[i]);
+  }
+
+  for (int field = 0; field < 4; field++) {
+    uint32_t HistoryVersion::*member =
+      (field == 0) ? &HistoryVersion::major :
+      (field == 1) ? &HistoryVersion::minor :
+      (field == 2) ? &HistoryVersion::build :
+                     &HistoryVersion::patch;
+    int64_t sum = 0;
+
+    if (!decode_column(p, end, vals, n)) {
+      return false;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      sum                  += vals[i];
+      cols.after[i].*member = static_cast<uint32_t>(sum);
+    }
+  }
+
+  if (static_cast<size_t>(end - p) < (n + 7) / 8) {
+    return false;
+  }
+
+  Cursor bitmap = p;
+
+  // The first record has no predecessor to chain to.
+  if (bitmap[0] & 1) {
+    return false;
+  }
+
+  p += (n + 7) / 8;
+
+  for (size_t i = 0; i < n; i++) {
+    int64_t d[4];
+
+    if (bitmap[i / 8] & (1 << (i % 8))) {
+      cols.before[i] = cols.after[i - 1];
+      continue;
+    }
+
+    if (!decode_column(p, end, d, 4)) {
+      return false;
+    }
+
+    cols.before[i].major = static_cast<uint32_t>(cols.after[i].major + d[0]);
+    cols.before[i].minor = static_cast<uint32_t>(cols.after[i].minor + d[1]);
+    cols.before[i].build = static_cast<uint32_t>(cols.after[i].build + d[2]);
+    cols.before[i].patch = static_cast<uint32_t>(cols.after[i].patch + d[3]);
+  }
+
+  return p == end;
+}
+
+/**
+ * @brief Decode every record, oldest first, ready for a journal.
+ */
+bool
+HistoryArchive::decode(HistoryEntryVector &entries)
+{
+  ArchiveColumns cols;
+
+  entries.clear();
+  entries.reserve(records_);
+
+  for (auto &series : series_) {
+    for (size_t b = 0; b < series.blocks; b++) {
+      if (!decode_block(series.first_block + b, cols)) {
+        ESAY("History archive is damaged in", series.component);
+        return false;
+      }
+
+      for (size_t i = 0; i < cols.size(); i++) {
+        entries.push_back({ cols.time[i],
+                            cols.type[i],
+                            cols.before[i],
+                            cols.after[i],
+                            series.component });
+      }
+    }
+  }
+
+  stable_sort(entries.begin(),
+              entries.end(),
+              [](const HistoryEntry &lhs, const HistoryEntry &rhs) {
+                return lhs.time < rhs.time;
+              });
+
+  return true;
+}
+
+/**
+ * @brief Encode records as an archive.
+ */
+void
+HistoryArchive::encode(const HistoryEntryVector &entries, string &out)
+{
+  map<string, HistoryEntryVector> series;
+
+  for (auto &it : entries) {
+    series[it.component].push_back(it);
+  }
+
+  out.assign(ARCHIVE_MAGIC);
+
+  for (uint64_t val : { static_cast<uint64_t>(ARCHIVE_VERSION),
+                        static_cast<uint64_t>(series.size()),
+                        static_cast<uint64_t>(0) }) {
+    for (int i = 0; i < 4; i++) {
+      out.push_back(static_cast<char>((val >> (i * 8)) & 0xFF));
+    }
+  }
+
+  for (auto &it : series) {
+    HistoryEntryVector &records = it.second;
+    size_t              blocks  = (records.size() + ARCHIVE_BLOCK_SIZE - 1) /
+                                  ARCHIVE_BLOCK_SIZE;
+
+    stable_sort(records.begin(),
+                records.end(),
+                [](const HistoryEntry &lhs, const HistoryEntry &rhs) {
+                  return lhs.time < rhs.time;
+                });
+
+    put_varint(out, it.first.size());
+    out.append(it.first);
+    put_varint(out, records.size());
+    put_varint(out, blocks);
+
+    for (size_t start = 0; start < records.size(); start += ARCHIVE_BLOCK_SIZE) {
+      size_t count = min<size_t>(ARCHIVE_BLOCK_SIZE, records.size() - start);
+      string block;
+
+      encode_block(&records[start], count, block);
+      put_varint(out, count);
+      put_varint(out, block.size());
+      out.append(block);
+    }
+  }
+}
+
+/**
+ * @brief Write records to an archive file, replacing it atomically.
+ */
+bool
+HistoryArchive::save(const string &path, const HistoryEntryVector &entries)
+{
+  string     data;
+  string     tmp(temp_path(path));
+  error_code ec;
+
+  encode(entries, data);
+
+  {
+    ofstream strm(tmp, ios::binary);
+
+    strm.write(data.data(), static_cast<streamsize>(data.size()));
+
+    if (!strm) {
+      strm.close();
+      fs::remove(tmp, ec);
+      return false;
+    }
+  }
+
+  fs::rename(tmp, path, ec);
+  if (ec) {
+    fs::remove(tmp, ec);
+    return false;
+  }
+
+  return true;
+}
+
+// HistoryArchive.cpp ends here.
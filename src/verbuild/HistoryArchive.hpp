@@ -0,0 +1,142 @@
+//
+// HistoryArchive.hpp --- Compact archive of increment history.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 09:04:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file HistoryArchive.hpp
+ * @author Paul Ward
+ * @brief Compact archive of increment history.
+ *
+ * For keeping years of history from many components.  Records are
+ * grouped into one series per component, and each series is cut into
+ * blocks of up to @c ARCHIVE_BLOCK_SIZE records that can be decoded
+ * on their own.  Within a block the records are stored column by
+ * column, each as variable-length integers:
+ *
+ *   time    the first time, the first delta, then delta-of-deltas
+ *   type    the increment type
+ *   after   each of major, minor, build and patch, as deltas from the
+ *           previous record
+ *   linked  a bitmap of the records whose `before' is the previous
+ *           record's `after'
+ *   before  for the others, deltas from their own `after'
+ *
+ * Signed values are zigzag-encoded, so small deltas either way take a
+ * byte.  Regular builds make nearly every column a run of single-byte
+ * values, which are decoded eight at a time.
+ *
+ * The file is:
+ *
+ *   "VBHA" version:u32 series:u32 reserved:u32
+ *   { name_length:var name records:var blocks:var
+ *     { count:var size:var columns[size] }... }...
+ */
+
+#pragma once
+#ifndef _HistoryArchive_hpp_
+#define _HistoryArchive_hpp_
+
+#include "Support.hpp"
+#include "History.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @def ARCHIVE_BLOCK_SIZE
+ * @brief Most records in one block.
+ */
+#define ARCHIVE_BLOCK_SIZE 1024
+
+/**
+ * @brief One block, decoded into columns.
+ */
+struct ArchiveColumns
+{
+  std::vector<std::int64_t>   time;
+  std::vector<IncrementType>  type;
+  std::vector<HistoryVersion> before;
+  std::vector<HistoryVersion> after;
+
+  std::size_t size() const;
+};
+
+class HistoryArchive
+{
+public:
+  struct Series
+  {
+    std::string component;
+    std::size_t records;
+    std::size_t first_block;
+    std::size_t blocks;
+  };
+
+  typedef std::vector<Series> SeriesVector;
+
+private:
+  struct Block
+  {
+    std::size_t count;
+    std::size_t offset;
+    std::size_t size;
+  };
+
+  typedef std::vector<Block> BlockVector;
+
+  std::string  data_;
+  SeriesVector series_;
+  BlockVector  blocks_;
+  std::size_t  records_;
+
+  std::vector<std::int64_t> scratch_;
+
+public:
+  HistoryArchive();
+  HistoryArchive(const HistoryArchive &) = delete;
+  ~HistoryArchive();
+
+  bool load(const std::string &);
+  bool parse(const std::string &);
+
+  const SeriesVector &get_series() const;
+  std::size_t         get_block_count() const;
+  std::size_t         get_record_count() const;
+
+  bool decode_block(std::size_t, ArchiveColumns &);
+  bool decode(HistoryEntryVector &);
+
+  static void encode(const HistoryEntryVector &, std::string &);
+  static bool save(const std::string &, const HistoryEntryVector &);
+};
+
+#endif // !_HistoryArchive_hpp_
+
+// HistoryArchive.hpp ends here.
@@ -96,6 +96,10 @@ IncrTypeParser::generate_allowed()
   allowed_.push_back("bymonths");
   allowed_.push_back("byyears");
   allowed_.push_back("bydate");
+  allowed_.push_back("script");
+  allowed_.push_back("gittag");
+  allowed_.push_back("gitsha");
+  allowed_.push_back("gitcount");
 }
 
 void
@@ -114,6 +118,14 @@ IncrTypeParser::parse(const string &what)
     type_ = IncrementType::ByYears;
   } else if (lc == "bydate") {
     type_ = IncrementType::ByDate;
+  } else if (lc == "script") {
+    type_ = IncrementType::Script;
+  } else if (lc == "gittag") {
+    type_ = IncrementType::GitTag;
+  } else if (lc == "gitsha") {
+    type_ = IncrementType::GitSha;
+  } else if (lc == "gitcount") {
+    type_ = IncrementType::GitCount;
   }
 }
 
@@ -148,6 +160,10 @@ validate(boost::any         &v,
     allowed.push_back("byyears");
     allowed.push_back("bymonths");
     allowed.push_back("bydate");
+    allowed.push_back("script");
+    allowed.push_back("gittag");
+    allowed.push_back("gitsha");
+    allowed.push_back("gitcount");
   }
 
   if (find(allowed.begin(), allowed.end(), lc) == allowed.end()) {
@@ -0,0 +1,62 @@
+//
+// IncrementPolicy.hpp --- Pluggable build number policies.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 11:52:09
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file IncrementPolicy.hpp
+ * @author Paul Ward
+ * @brief Pluggable build number policies.
+ *
+ * Increment types that are not built into @c VersionInfo::perform are
+ * delegated to a policy object attached to the version.
+ */
+
+#pragma once
+#ifndef _IncrementPolicy_hpp_
+#define _IncrementPolicy_hpp_
+
+#include "Support.hpp"
+
+class VersionInfo;
+
+class IncrementPolicy
+{
+public:
+  virtual ~IncrementPolicy() {}
+
+  /**
+   * @brief Compute the next version.
+   * @param vi The version to update in place.
+   * @returns true on success; false leaves @c vi untouched.
+   */
+  virtual bool apply(VersionInfo &vi) = 0;
+};
+
+#endif // !_IncrementPolicy_hpp_
+
+// IncrementPolicy.hpp ends here.
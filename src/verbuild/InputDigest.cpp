@@ -0,0 +1,613 @@
+//
+// InputDigest.cpp --- Digest of a component's input files.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 02:38:20
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file InputDigest.cpp
+ * @author Paul Ward
+ * @brief Digest of a component's input files.
+ */
+
+#include "InputDigest.hpp"
+#include "Hash.hpp"
+#include "ThreadPool.hpp"
+#include "Console.hpp"
+#include "Utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#if PLATFORM_EQ(PLATFORM_LINUX)
+# include <dirent.h>
+# include <fcntl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#define DIGEST_TAG "xxh64"
+
+/*
+ * getdents64 buffer, and where its fields lie in each record.
+ */
+#define DENTS_SIZE      (32 * 1024)
+#define DENT_RECLEN_OFF 16
+#define DENT_TYPE_OFF   18
+#define DENT_NAME_OFF   19
+
+/*
+ * State shared by the tasks of one walk.
+ */
+struct DigestWalk
+{
+  ThreadPool          pool;
+  FileHashCache      *cache;
+  const set<string>  &excluded;
+  set<string>         excluded_names;
+  fs::path            cwd;
+  mutex               lock;
+  FileHashEntryVector files;
+  atomic<size_t>      bytes;
+  atomic<size_t>      hits;
+  atomic<bool>        failed;
+  string              error;
+
+  DigestWalk(unsigned           threads,
+             FileHashCache     *cache_,
+             const set<string> &excluded_)
+    : pool(threads),
+      cache(cache_),
+      excluded(excluded_),
+      excluded_names(),
+      cwd(),
+      bytes(0),
+      hits(0),
+      failed(false)
+  {
+    error_code ec;
+
+    for (auto &it : excluded) {
+      excluded_names.insert(fs::path(it).filename().string());
+    }
+
+    cwd = fs::current_path(ec);
+  }
+
+  /*
+   * Only a file whose name matches is turned into a full path, so an
+   * empty or unrelated exclude list costs next to nothing.  A file
+   * being written in place of an excluded one, by this or another
+   * run, is excluded with it.
+   */
+  bool is_excluded(const string &name) const
+  {
+    size_t   slash = name.rfind('/');
+    size_t   start = (slash == string::npos) ? 0 : slash + 1;
+    size_t   stop  = name.rfind(TEMP_SUFFIX);
+    fs::path full;
+
+    if (stop == string::npos || stop < start ||
+        name.find_first_not_of("0123456789",
+                               stop + strlen(TEMP_SUFFIX)) != string::npos) {
+      stop = name.size();
+    }
+
+    if (excluded_names.count(name.substr(start, stop - start)) == 0) {
+      return false;
+    }
+
+    full = name.substr(0, stop);
+    if (!full.is_absolute()) {
+      full = cwd / full;
+    }
+
+    return excluded.count(full.lexically_normal().generic_string()) != 0;
+  }
+
+  void fail(const string &msg)
+  {
+    lock_guard<mutex> guard(lock);
+
+    if (!failed) {
+      failed = true;
+      error  = msg;
+    }
+  }
+
+  void add(FileHashEntryVector &found)
+  {
+    lock_guard<mutex> guard(lock);
+
+    files.insert(files.end(),
+                 make_move_iterator(found.begin()),
+                 make_move_iterator(found.end()));
+  }
+};
+
+static inline
+FileStat
+to_file_stat(const struct stat &st)
+{
+  FileStat stat;
+
+  stat.dev   = static_cast<uint64_t>(st.st_dev);
+  stat.ino   = static_cast<uint64_t>(st.st_ino);
+  stat.size  = static_cast<uint64_t>(st.st_size);
+  stat.mtime = static_cast<int64_t>(st.st_mtime) * 1000000000;
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  stat.mtime += st.st_mtim.tv_nsec;
+#endif
+
+  return stat;
+}
+
+static
+bool
+hash_file(const string &path, uint64_t &hash, size_t &bytes)
+{
+  static thread_local vector<char> buf(DIGEST_READ_SIZE);
+  Hasher                           hasher;
+
+  bytes = 0;
+
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  for (;;) {
+    ssize_t got = ::read(fd, buf.data(), buf.size());
+
+    if (got < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (got <= 0) {
+      ::close(fd);
+      hash = hasher.digest();
+      return got == 0;
+    }
+
+    hasher.update(buf.data(), static_cast<size_t>(got));
+    bytes += static_cast<size_t>(got);
+  }
+#else
+  ifstream strm(path, ios::binary);
+
+  if (!strm.is_open()) {
+    return false;
+  }
+
+  while (strm) {
+    strm.read(buf.data(), static_cast<streamsize>(buf.size()));
+    hasher.update(buf.data(), static_cast<size_t>(strm.gcount()));
+    bytes += static_cast<size_t>(strm.gcount());
+  }
+
+  hash = hasher.digest();
+
+  return !strm.bad();
+#endif
+}
+
+/*
+ * Take a file's hash from the cache, or queue it to be read.  Hits
+ * are gathered in @c found.
+ */
+static
+void
+visit_file(DigestWalk          &walk,
+           string               name,
+           const FileStat      &stat,
+           FileHashEntryVector &found)
+{
+  uint64_t hash;
+
+  if (walk.is_excluded(name)) {
+    DSAY(DEBUG_HIGH, "Not hashing generated file", name);
+    return;
+  }
+
+  if (walk.cache != nullptr && walk.cache->lookup(name, stat, hash)) {
+    found.push_back({ move(name), stat, hash });
+    walk.hits++;
+    return;
+  }
+
+  walk.pool.submit([&walk, name, stat]() {
+    FileHashEntryVector one(1, { name, stat, 0 });
+    size_t              bytes;
+
+    if (walk.failed) {
+      return;
+    }
+
+    if (!hash_file(name, one[0].hash, bytes)) {
+      walk.fail("Could not read input " + name);
+      return;
+    }
+
+    walk.bytes += bytes;
+    walk.add(one);
+  });
+}
+
+/*
+ * List one directory, queueing its subdirectories as tasks of their
+ * own.  @c prefix is the directory's name with a trailing slash, and
+ * names the files within it.
+ */
+static
+void
+walk_dir(DigestWalk &walk, const string &prefix)
+{
+  FileHashEntryVector found;
+
+  if (walk.failed) {
+    return;
+  }
+
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  alignas(8) char buf[DENTS_SIZE];
+  int             fd = ::open(prefix.c_str(),
+                              O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+  if (fd < 0) {
+    // Unreadable directories are skipped, as they always were.
+    if (errno != EACCES) {
+      walk.fail("Could not read " + prefix + ": " + strerror(errno));
+    }
+
+    return;
+  }
+
+  for (;;) {
+    long got = ::syscall(SYS_getdents64, fd, buf, sizeof(buf));
+
+    if (got < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (got < 0) {
+      walk.fail("Could not read " + prefix + ": " + strerror(errno));
+      break;
+    }
+
+    if (got == 0) {
+      break;
+    }
+
+    for (long off = 0; off < got;) {
+      const char    *ent  = buf + off;
+      const char    *name = ent + DENT_NAME_OFF;
+      unsigned char  type = static_cast<unsigned char>(ent[DENT_TYPE_OFF]);
+      unsigned short reclen;
+      struct stat    st;
+
+      ::memcpy(&reclen, ent + DENT_RECLEN_OFF, sizeof(reclen));
+      off += reclen;
+
+      if (::strcmp(name, ".") == 0 || ::strcmp(name, "..") == 0) {
+        continue;
+      }
+
+      if (type == DT_UNKNOWN) {
+        if (::fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+          continue;
+        }
+
+        type = S_ISDIR(st.st_mode) ? DT_DIR
+             : S_ISLNK(st.st_mode) ? DT_LNK
+             : S_ISREG(st.st_mode) ? DT_REG
+             : DT_UNKNOWN;
+      }
+
+      if (type == DT_DIR) {
+        if (::strcmp(name, ".git") != 0) {
+          string sub(prefix + name + "/");
+
+          walk.pool.submit([&walk, sub]() { walk_dir(walk, sub); });
+        }
+
+        continue;
+      }
+
+      // Links to files are followed; links to directories are not.
+      if ((type != DT_REG && type != DT_LNK) ||
+          ::fstatat(fd, name, &st, 0) != 0 ||
+          !S_ISREG(st.st_mode)) {
+        continue;
+      }
+
+      visit_file(walk, prefix + name, to_file_stat(st), found);
+    }
+  }
+
+  ::close(fd);
+#else
+  error_code             ec;
+  fs::directory_iterator it(
+    prefix, fs::directory_options::skip_permission_denied, ec);
+
+  for (fs::directory_iterator end; !ec && it != end; it.increment(ec)) {
+    string      name(it->path().filename().string());
+    struct stat st;
+
+    if (!it->is_symlink(ec) && it->is_directory(ec)) {
+      if (name != ".git") {
+        string sub(prefix + name + "/");
+
+        walk.pool.submit([&walk, sub]() { walk_dir(walk, sub); });
+      }
+
+      continue;
+    }
+
+    if (::stat((prefix + name).c_str(), &st) != 0 || !S_ISREG(st.st_mode)) {
+      continue;
+    }
+
+    visit_file(walk, prefix + name, to_file_stat(st), found);
+  }
+
+  if (ec) {
+    walk.fail("Could not read " + prefix + ": " + ec.message());
+  }
+#endif
+
+  walk.add(found);
+}
+
+/**
+ * @brief Construct a digest of some inputs.
+ * @param inputs Files and directories.
+ * @param cache Hashes of files seen before, or null.  It is given this
+ *              run's hashes, and is for the caller to save.
+ * @param threads Workers to hash with; 0 for one per hardware thread.
+ */
+InputDigest::InputDigest(const PathVector &inputs,
+                         FileHashCache    *cache,
+                         unsigned          threads)
+  : inputs_(inputs),
+    excluded_(),
+    cache_(cache),
+    threads_(threads),
+    files_(0),
+    bytes_(0),
+    hits_(0),
+    started_(0)
+{}
+
+InputDigest::~InputDigest()
+{}
+
+size_t
+InputDigest::get_file_count() const
+{
+  return files_;
+}
+
+size_t
+InputDigest::get_byte_count() const
+{
+  return bytes_;
+}
+
+/**
+ * @brief Number of files whose hash came from the cache.
+ */
+size_t
+InputDigest::get_hit_count() const
+{
+  return hits_;
+}
+
+/**
+ * @brief When the last @c compute began, in nanoseconds since the
+ *        epoch; what to pass to @c FileHashCache::save.
+ */
+int64_t
+InputDigest::get_start_time() const
+{
+  return started_;
+}
+
+/**
+ * @brief Leave a file out of the digest.
+ * @param path The file, relative to the current directory or absolute.
+ *
+ * For files that are written on every run; hashing them would make
+ * the inputs look changed every time.  The file's temporary names,
+ * @c path followed by @c TEMP_SUFFIX and any digits, are left out too.
+ */
+void
+InputDigest::exclude(const string &path)
+{
+  error_code ec;
+  fs::path   full(fs::absolute(path, ec));
+
+  if (!path.empty() && !ec) {
+    excluded_.insert(full.lexically_normal().generic_string());
+  }
+}
+
+/**
+ * @brief Hash all of the inputs.
+ * @param digest Receives the combined digest.
+ * @returns false if an input is missing or unreadable.
+ */
+bool
+InputDigest::compute(uint64_t &digest)
+{
+  DigestWalk walk(threads_, cache_, excluded_);
+  Hasher     all;
+
+  files_   = 0;
+  bytes_   = 0;
+  hits_    = 0;
+  started_ = chrono::duration_cast<chrono::nanoseconds>(
+    chrono::system_clock::now().time_since_epoch()).count();
+
+  for (auto &input : inputs_) {
+    FileHashEntryVector found;
+    string              name(fs::path(input).generic_string());
+    struct stat         st;
+
+    if (::stat(input.c_str(), &st) != 0) {
+      ESAY("Input", input, "does not exist.");
+      walk.failed = true;
+      break;
+    }
+
+    if (S_ISREG(st.st_mode)) {
+      visit_file(walk, name, to_file_stat(st), found);
+      walk.add(found);
+    } else if (S_ISDIR(st.st_mode)) {
+      if (name.empty() || name.back() != '/') {
+        name += '/';
+      }
+
+      walk.pool.submit([&walk, name]() { walk_dir(walk, name); });
+    }
+  }
+
+  walk.pool.wait();
+
+  if (walk.failed) {
+    if (!walk.error.empty()) {
+      ESAY(walk.error);
+    }
+
+    return false;
+  }
+
+  sort(walk.files.begin(),
+       walk.files.end(),
+       [](const FileHashEntry &lhs, const FileHashEntry &rhs) {
+         return lhs.path < rhs.path;
+       });
+
+  walk.files.erase(unique(walk.files.begin(),
+                          walk.files.end(),
+                          [](const FileHashEntry &lhs,
+                             const FileHashEntry &rhs) {
+                            return lhs.path == rhs.path;
+                          }),
+                   walk.files.end());
+
+  for (auto &it : walk.files) {
+    unsigned char le[8];
+
+    for (int i = 0; i < 8; i++) {
+      le[i] = static_cast<unsigned char>(it.hash >> (i * 8));
+    }
+
+    // The NUL keeps `ab' + `c' apart from `a' + `bc'.
+    all.update(it.path.c_str(), it.path.length() + 1);
+    all.update(le, sizeof(le));
+  }
+
+  files_ = walk.files.size();
+  bytes_ = walk.bytes;
+  hits_  = walk.hits;
+  digest = all.digest();
+
+  DSAY(DEBUG_MEDIUM, "Hashed", files_, "inputs,", bytes_, "bytes,",
+       hits_, "cached:", hash_to_hex(digest));
+
+  if (cache_ != nullptr) {
+    cache_->replace(walk.files);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Read a stored digest.
+ * @returns false if there is none, or it is not ours.
+ */
+bool
+InputDigest::load(const string &path, uint64_t &digest)
+{
+  ifstream strm(path);
+  string   tag;
+  string   hex;
+
+  if (!(strm >> tag >> hex) || tag != DIGEST_TAG) {
+    return false;
+  }
+
+  return hash_from_hex(hex, digest);
+}
+
+/**
+ * @brief Store a digest, replacing the sidecar atomically.
+ */
+bool
+InputDigest::store(const string &path, uint64_t digest)
+{
+  string     tmp(temp_path(path));
+  error_code ec;
+
+  {
+    ofstream strm(tmp);
+
+    strm << DIGEST_TAG << ' ' << hash_to_hex(digest) << '\n';
+
+    if (!strm) {
+      strm.close();
+      fs::remove(tmp, ec);
+      return false;
+    }
+  }
+
+  fs::rename(tmp, path, ec);
+  if (ec) {
+    fs::remove(tmp, ec);
+    return false;
+  }
+
+  return true;
+}
+
+// InputDigest.cpp ends here.
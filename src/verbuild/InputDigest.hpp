@@ -0,0 +1,104 @@
+//
+// InputDigest.hpp --- Digest of a component's input files.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 02:31:47
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file InputDigest.hpp
+ * @author Paul Ward
+ * @brief Digest of a component's input files.
+ *
+ * Hashes every regular file under a set of files and directories into
+ * one value, so the build number need only change when the inputs do.
+ * Files are taken in path order and each contributes its path as well
+ * as its contents, so renaming, adding or removing a file changes the
+ * digest too.  `.git' directories are skipped, as is anything passed
+ * to @c exclude, such as the outputs and the sidecar files, which are
+ * rewritten on every run.
+ *
+ * The digest is kept in a small sidecar file next to the version.
+ *
+ * Directories are walked and files hashed on a thread pool, and with a
+ * @c FileHashCache a file whose identity is unchanged is not read.
+ */
+
+#pragma once
+#ifndef _InputDigest_hpp_
+#define _InputDigest_hpp_
+
+#include "Support.hpp"
+#include "Config.hpp"
+#include "FileHashCache.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+
+/**
+ * @def DIGEST_SUFFIX
+ * @brief Appended to the first output's name for the default sidecar.
+ */
+#define DIGEST_SUFFIX ".digest"
+
+/**
+ * @def DIGEST_READ_SIZE
+ * @brief Bytes read from an input file at a time.
+ */
+#define DIGEST_READ_SIZE (64 * 1024)
+
+class InputDigest
+{
+private:
+  PathVector            inputs_;
+  std::set<std::string> excluded_;
+  FileHashCache        *cache_;
+  unsigned              threads_;
+  std::size_t           files_;
+  std::size_t           bytes_;
+  std::size_t           hits_;
+  std::int64_t          started_;
+
+public:
+  InputDigest(const PathVector &, FileHashCache * = nullptr, unsigned = 0);
+  ~InputDigest();
+
+  void exclude(const std::string &);
+  bool compute(std::uint64_t &);
+
+  std::size_t  get_file_count() const;
+  std::size_t  get_byte_count() const;
+  std::size_t  get_hit_count() const;
+  std::int64_t get_start_time() const;
+
+  static bool load(const std::string &, std::uint64_t &);
+  static bool store(const std::string &, std::uint64_t);
+};
+
+#endif // !_InputDigest_hpp_
+
+// InputDigest.hpp ends here.
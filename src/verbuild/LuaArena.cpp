@@ -0,0 +1,235 @@
+//
+// LuaArena.cpp --- Bounded allocator for Lua states.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 13:34:02
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaArena.cpp
+ * @author Paul Ward
+ * @brief Bounded allocator for Lua states.
+ */
+
+#include "LuaArena.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+#define SMALLEST_CLASS 16
+
+static inline
+int
+size_class(size_t size)
+{
+  size_t bytes = SMALLEST_CLASS;
+  int    cls   = 0;
+
+  while (bytes < size) {
+    bytes <<= 1;
+    cls++;
+  }
+
+  return (cls < LUA_ARENA_CLASSES) ? cls : -1;
+}
+
+static inline
+size_t
+class_size(int cls)
+{
+  return static_cast<size_t>(SMALLEST_CLASS) << cls;
+}
+
+static inline
+size_t
+charge(size_t size)
+{
+  int cls = size_class(size);
+
+  return (cls < 0) ? size : class_size(cls);
+}
+
+/**
+ * @brief Construct an arena.
+ * @param limit Hard cap in bytes, or 0 for no cap.
+ */
+LuaArena::LuaArena(size_t limit)
+  : limit_(limit),
+    used_(0),
+    peak_(0),
+    free_(),
+    slabs_(),
+    cursor_(nullptr),
+    end_(nullptr)
+{
+  free_.fill(nullptr);
+}
+
+LuaArena::~LuaArena()
+{
+  for (char *slab : slabs_) {
+    ::free(slab);
+  }
+}
+
+size_t
+LuaArena::get_limit() const
+{
+  return limit_;
+}
+
+size_t
+LuaArena::get_used() const
+{
+  return used_;
+}
+
+size_t
+LuaArena::get_peak() const
+{
+  return peak_;
+}
+
+/**
+ * @brief @c lua_Alloc entry point; @c ud is the arena.
+ */
+void *
+LuaArena::alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+  LuaArena *arena = static_cast<LuaArena *>(ud);
+
+  if (nsize == 0) {
+    if (ptr != nullptr) {
+      arena->release(ptr, osize);
+    }
+
+    return nullptr;
+  }
+
+  // When ptr is NULL, osize is an object type tag rather than a size.
+  if (ptr == nullptr) {
+    return arena->allocate(nsize, false);
+  }
+
+  return arena->reallocate(ptr, osize, nsize);
+}
+
+void *
+LuaArena::allocate(size_t size, bool force)
+{
+  size_t cost = charge(size);
+  int    cls  = size_class(size);
+  void  *ptr;
+
+  if (!force && limit_ > 0 && used_ + cost > limit_) {
+    return nullptr;
+  }
+
+  if (cls < 0) {
+    ptr = ::malloc(size);
+  } else if (free_[cls] != nullptr) {
+    ptr        = free_[cls];
+    free_[cls] = free_[cls]->next;
+  } else {
+    ptr = carve(class_size(cls));
+  }
+
+  if (ptr == nullptr) {
+    return nullptr;
+  }
+
+  used_ += cost;
+  peak_  = max(peak_, used_);
+
+  return ptr;
+}
+
+void
+LuaArena::release(void *ptr, size_t size)
+{
+  int cls = size_class(size);
+
+  if (cls < 0) {
+    ::free(ptr);
+  } else {
+    FreeBlock *blk = static_cast<FreeBlock *>(ptr);
+
+    blk->next  = free_[cls];
+    free_[cls] = blk;
+  }
+
+  used_ -= charge(size);
+}
+
+void *
+LuaArena::reallocate(void *ptr, size_t osize, size_t nsize)
+{
+  int   ocls = size_class(osize);
+  int   ncls = size_class(nsize);
+  void *nptr;
+
+  if (ocls >= 0 && ocls == ncls) {
+    return ptr;
+  }
+
+  // Lua relies on shrinking never failing, so only growth is capped.
+  nptr = allocate(nsize, nsize <= osize);
+  if (nptr == nullptr) {
+    return nullptr;
+  }
+
+  ::memcpy(nptr, ptr, min(osize, nsize));
+  release(ptr, osize);
+
+  return nptr;
+}
+
+void *
+LuaArena::carve(size_t size)
+{
+  char *ptr;
+
+  if (cursor_ == nullptr || static_cast<size_t>(end_ - cursor_) < size) {
+    char *slab = static_cast<char *>(::malloc(LUA_ARENA_SLAB_SIZE));
+
+    if (slab == nullptr) {
+      return nullptr;
+    }
+
+    slabs_.push_back(slab);
+    cursor_ = slab;
+    end_    = slab + LUA_ARENA_SLAB_SIZE;
+  }
+
+  ptr      = cursor_;
+  cursor_ += size;
+
+  return ptr;
+}
+
+// LuaArena.cpp ends here.
@@ -0,0 +1,99 @@
+//
+// LuaArena.hpp --- Bounded allocator for Lua states.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 13:20:47
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file LuaArena.hpp
+ * @author Paul Ward
+ * @brief Bounded allocator for Lua states.
+ *
+ * Small blocks are carved from slabs and recycled through per-size
+ * class free lists; larger blocks go to the system allocator.  Every
+ * block counts against a hard cap, and an allocation that would
+ * exceed it fails, which Lua reports as a memory error.
+ */
+
+#pragma once
+#ifndef _LuaArena_hpp_
+#define _LuaArena_hpp_
+
+#include "Support.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @def LUA_ARENA_CLASSES
+ * @brief Number of small size classes (16 bytes to 1 KiB).
+ */
+#define LUA_ARENA_CLASSES 7
+
+/**
+ * @def LUA_ARENA_SLAB_SIZE
+ * @brief Size of each slab from which small blocks are carved.
+ */
+#define LUA_ARENA_SLAB_SIZE (64 * 1024)
+
+class LuaArena
+{
+private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  std::size_t limit_;
+  std::size_t used_;
+  std::size_t peak_;
+
+  std::array<FreeBlock *, LUA_ARENA_CLASSES> free_;
+  std::vector<char *>                        slabs_;
+  char                                      *cursor_;
+  char                                      *end_;
+
+public:
+  LuaArena(std::size_t);
+  LuaArena(const LuaArena &) = delete;
+  ~LuaArena();
+
+  std::size_t get_limit() const;
+  std::size_t get_used() const;
+  std::size_t get_peak() const;
+
+  static void *alloc(void *, void *, std::size_t, std::size_t);
+
+private:
+  void *allocate(std::size_t, bool);
+  void  release(void *, std::size_t);
+  void *reallocate(void *, std::size_t, std::size_t);
+  void *carve(std::size_t);
+};
+
+#endif // !_LuaArena_hpp_
+
+// LuaArena.hpp ends here.
@@ -0,0 +1,408 @@
+//
+// LuaCache.cpp --- Lua bytecode cache implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 09:27:51
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaCache.cpp
+ * @author Paul Ward
+ * @brief Lua bytecode cache implementation.
+ */
+
+#include "LuaCache.hpp"
+#include "Console.hpp"
+#include "Utils.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iterator>
+#include <filesystem>
+#include <system_error>
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <fcntl.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+extern "C" {
+#include "lauxlib.h"
+}
+
+using namespace std;
+namespace fs = std::filesystem;
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME        0x100000001b3ULL
+
+#define ENTRY_MAGIC      "VBLC"
+#define ENTRY_MAGIC_LEN  4
+#define ENTRY_HEADER_LEN (ENTRY_MAGIC_LEN + 4 + 8)
+
+static
+uint64_t
+hash_source(const string &source)
+{
+  // Seed with the Lua release, bytecode is not portable between
+  // interpreter versions.
+  const char *release = LUA_RELEASE;
+  uint64_t    hash    = FNV_OFFSET_BASIS;
+
+  for (const char *p = release; *p != '\0'; p++) {
+    hash ^= static_cast<unsigned char>(*p);
+    hash *= FNV_PRIME;
+  }
+
+  for (unsigned char ch : source) {
+    hash ^= ch;
+    hash *= FNV_PRIME;
+  }
+
+  return hash;
+}
+
+static inline
+void
+put_le(string &out, uint64_t value, unsigned bytes)
+{
+  for (unsigned i = 0; i < bytes; i++) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+static inline
+uint64_t
+get_le(const string &in, size_t offset, unsigned bytes)
+{
+  uint64_t value = 0;
+
+  for (unsigned i = 0; i < bytes; i++) {
+    value |= static_cast<uint64_t>(
+      static_cast<unsigned char>(in[offset + i])) << (8 * i);
+  }
+
+  return value;
+}
+
+/*
+ * Write `data' to a new file that only the current user can read or
+ * write.  The file must not already exist, so a planted link is never
+ * followed.
+ */
+static
+bool
+write_private(const string &path, const string &data)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  ofstream strm(path, ios::binary | ios::trunc);
+
+  strm.write(data.data(), data.size());
+
+  return strm.good();
+#else
+  const char *p    = data.data();
+  size_t      left = data.size();
+  int         fd;
+
+  fd = ::open(path.c_str(),
+              O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC,
+              0600);
+  if (fd < 0) {
+    return false;
+  }
+
+  while (left > 0) {
+    ssize_t n = ::write(fd, p, left);
+
+    if (n < 0) {
+      ::close(fd);
+      return false;
+    }
+
+    p    += n;
+    left -= static_cast<size_t>(n);
+  }
+
+  return ::close(fd) == 0;
+#endif
+}
+
+static
+int
+dump_writer(lua_State *, const void *data, size_t size, void *ud)
+{
+  static_cast<string *>(ud)->append(static_cast<const char *>(data), size);
+
+  return 0;
+}
+
+LuaCache::LuaCache()
+  : directory_(default_directory())
+{}
+
+LuaCache::LuaCache(const string &directory)
+  : directory_(directory)
+{}
+
+LuaCache::~LuaCache()
+{}
+
+const string &
+LuaCache::get_directory() const
+{
+  return directory_;
+}
+
+string
+LuaCache::default_directory()
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  const char *local = getenv("LOCALAPPDATA");
+
+  if (local != nullptr && *local != '\0') {
+    return string(local) + "\\verbuild\\cache";
+  }
+#else
+  const char *xdg  = getenv("XDG_CACHE_HOME");
+  const char *home = getenv("HOME");
+
+  if (xdg != nullptr && *xdg != '\0') {
+    return string(xdg) + "/verbuild";
+  }
+
+  if (home != nullptr && *home != '\0') {
+    return string(home) + "/.cache/verbuild";
+  }
+#endif
+
+  return "";
+}
+
+/**
+ * @brief Load a chunk, preferring cached bytecode.
+ * @param L The Lua state onto which the chunk is pushed.
+ * @param source The script source text.
+ * @param chunkname The chunk name used in error messages.
+ * @returns The status code from @c luaL_loadbufferx.
+ *
+ * On a cache miss the source is compiled and the dumped bytecode is
+ * written to the cache for the next run.
+ */
+int
+LuaCache::load(lua_State    *L,
+               const string &source,
+               const string &chunkname)
+{
+  string path;
+  string entry;
+  string bytecode;
+  int    status;
+
+  if (!directory_.empty()) {
+    path = path_for(source);
+
+    if (fetch(path, entry)) {
+      if (decode(entry, source, bytecode)) {
+        status = luaL_loadbufferx(L,
+                                  bytecode.data(),
+                                  bytecode.size(),
+                                  chunkname.c_str(),
+                                  "b");
+
+        if (status == LUA_OK) {
+          DSAY(DEBUG_MEDIUM, "Loaded cached bytecode from", path);
+          return status;
+        }
+
+        lua_pop(L, 1);
+      }
+
+      DSAY(DEBUG_MEDIUM, "Discarding unusable cache entry", path);
+    }
+  }
+
+  status = luaL_loadbufferx(L,
+                            source.data(),
+                            source.size(),
+                            chunkname.c_str(),
+                            "t");
+
+  if (status != LUA_OK || path.empty()) {
+    return status;
+  }
+
+  bytecode.clear();
+  if (lua_dump(L, dump_writer, &bytecode, 0) == 0) {
+    store(path, encode(source, bytecode));
+  }
+
+  return status;
+}
+
+/**
+ * @brief Build a cache entry for @c bytecode compiled from @c source.
+ */
+string
+LuaCache::encode(const string &source, const string &bytecode)
+{
+  string entry(ENTRY_MAGIC, ENTRY_MAGIC_LEN);
+
+  entry.reserve(ENTRY_HEADER_LEN + source.size() + bytecode.size());
+  put_le(entry, LUA_VERSION_NUM, 4);
+  put_le(entry, source.size(), 8);
+  entry.append(source);
+  entry.append(bytecode);
+
+  return entry;
+}
+
+/**
+ * @brief Get the bytecode from @c entry.
+ * @returns false unless the entry was written by this Lua release for
+ *          exactly @c source.
+ */
+bool
+LuaCache::decode(const string &entry, const string &source, string &bytecode)
+{
+  if (entry.size() < ENTRY_HEADER_LEN ||
+      entry.compare(0, ENTRY_MAGIC_LEN, ENTRY_MAGIC) != 0 ||
+      get_le(entry, ENTRY_MAGIC_LEN, 4) != LUA_VERSION_NUM ||
+      get_le(entry, ENTRY_MAGIC_LEN + 4, 8) != source.size() ||
+      entry.size() - ENTRY_HEADER_LEN <= source.size() ||
+      entry.compare(ENTRY_HEADER_LEN, source.size(), source) != 0) {
+    return false;
+  }
+
+  bytecode.assign(entry, ENTRY_HEADER_LEN + source.size(), string::npos);
+
+  return true;
+}
+
+string
+LuaCache::path_for(const string &source) const
+{
+  stringstream ss;
+
+  ss << setfill('0') << setw(16) << hex << hash_source(source) << ".luac";
+
+  return (fs::path(directory_) / ss.str()).string();
+}
+
+/*
+ * Read a cache entry.  On POSIX systems it must be a regular file that
+ * belongs to the current user and that nobody else can write, or it
+ * could have been planted.
+ */
+bool
+LuaCache::fetch(const string &path, string &out) const
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  ifstream strm(path, ios::binary);
+
+  if (!strm.good()) {
+    return false;
+  }
+
+  out.assign((istreambuf_iterator<char>(strm)),
+              istreambuf_iterator<char>());
+#else
+  struct stat st;
+  size_t      got = 0;
+  int         fd;
+
+  fd = ::open(path.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  if (::fstat(fd, &st) != 0 ||
+      !S_ISREG(st.st_mode) ||
+      st.st_uid != ::geteuid() ||
+      (st.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+    DSAY(DEBUG_LOW, "Ignoring cache entry not private to this user", path);
+    ::close(fd);
+    return false;
+  }
+
+  out.resize(static_cast<size_t>(st.st_size));
+
+  while (got < out.size()) {
+    ssize_t n = ::read(fd, &out[got], out.size() - got);
+
+    if (n <= 0) {
+      break;
+    }
+
+    got += static_cast<size_t>(n);
+  }
+
+  ::close(fd);
+  out.resize(got);
+#endif
+
+  return !out.empty();
+}
+
+void
+LuaCache::store(const string &path, const string &entry) const
+{
+  error_code ec;
+  string     tmp     = temp_path(path);
+  bool       created = !fs::exists(directory_, ec);
+
+  fs::create_directories(directory_, ec);
+  if (ec) {
+    DSAY(DEBUG_LOW, "Cannot create cache directory", directory_, ec.message());
+    return;
+  }
+
+  if (created) {
+    fs::permissions(directory_, fs::perms::owner_all, ec);
+  }
+
+  if (!write_private(tmp, entry)) {
+    DSAY(DEBUG_LOW, "Cannot write cache entry", tmp);
+    fs::remove(tmp, ec);
+    return;
+  }
+
+  // Rename is atomic, so concurrent runs never see a partial entry.
+  fs::rename(tmp, path, ec);
+  if (ec) {
+    DSAY(DEBUG_LOW, "Cannot commit cache entry", path, ec.message());
+    fs::remove(tmp, ec);
+    return;
+  }
+
+  DSAY(DEBUG_MEDIUM, "Stored bytecode in", path);
+}
+
+// LuaCache.cpp ends here.
@@ -0,0 +1,95 @@
+//
+// LuaCache.hpp --- Lua bytecode cache.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 09:20:03
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file LuaCache.hpp
+ * @author Paul Ward
+ * @brief Lua bytecode cache.
+ *
+ * Scripts are compiled once and the result of @c lua_dump is stored
+ * under a name derived from a hash of the script source.  Later runs
+ * load the precompiled chunk in binary mode and skip the parser.
+ *
+ * Lua does not verify bytecode, so an entry is only used when it is
+ * provably for this script.  Each entry is laid out as:
+ *
+ *   "VBLC"                 -- magic
+ *   uint32 LUA_VERSION_NUM -- little-endian
+ *   uint64 source length   -- little-endian
+ *   source text
+ *   bytecode
+ *
+ * and the stored source must match the script byte for byte.  The
+ * cache directory is created private to its owner.  On POSIX systems
+ * entries that another user owns, or that others may write, are
+ * ignored.
+ */
+
+#pragma once
+#ifndef _LuaCache_hpp_
+#define _LuaCache_hpp_
+
+#include "Support.hpp"
+
+#include <string>
+
+extern "C" {
+#include "lua.h"
+}
+
+class LuaCache
+{
+private:
+  std::string directory_;
+
+public:
+  LuaCache();
+  LuaCache(const std::string &);
+  ~LuaCache();
+
+  const std::string &get_directory() const;
+
+  int load(lua_State *, const std::string &, const std::string &);
+
+  static std::string default_directory();
+
+private:
+  std::string path_for(const std::string &) const;
+  bool        fetch(const std::string &, std::string &) const;
+  void        store(const std::string &, const std::string &) const;
+
+  static std::string encode(const std::string &, const std::string &);
+  static bool        decode(const std::string &,
+                            const std::string &,
+                            std::string &);
+};
+
+#endif // !_LuaCache_hpp_
+
+// LuaCache.hpp ends here.
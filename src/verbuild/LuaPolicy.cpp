@@ -0,0 +1,131 @@
+//
+// LuaPolicy.cpp --- Lua-defined increment policy implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 12:06:31
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaPolicy.cpp
+ * @author Paul Ward
+ * @brief Lua-defined increment policy implementation.
+ */
+
+#include "LuaPolicy.hpp"
+#include "VersionInfo.hpp"
+#include "Console.hpp"
+
+#include <cstdint>
+
+using namespace std;
+
+LuaPolicy::LuaPolicy()
+{}
+
+LuaPolicy::~LuaPolicy()
+{
+  if (fn_ref_ != LUA_NOREF) {
+    luaL_unref(state_->get(), LUA_REGISTRYINDEX, fn_ref_);
+  }
+}
+
+bool
+LuaPolicy::load(const string    &path,
+                const string    &cache_dir,
+                const LuaLimits &limits)
+{
+  lua_State *L;
+
+  state_.reset(new LuaState(limits));
+  fn_ref_ = LUA_NOREF;
+  L       = state_->get();
+
+  if (!state_->load_file(path, cache_dir)) {
+    ESAY("Lua:", state_->pop_error());
+    return false;
+  }
+
+  if (lua_istable(L, -1)) {
+    lua_getfield(L, -1, "increment");
+    lua_remove(L, -2);
+  }
+
+  if (!lua_isfunction(L, -1)) {
+    ESAY("Policy script", path, "did not return an increment function.");
+    lua_pop(L, 1);
+    return false;
+  }
+
+  fn_ref_ = luaL_ref(L, LUA_REGISTRYINDEX);
+  DSAY(DEBUG_MEDIUM, "Registered increment policy from", path);
+
+  return true;
+}
+
+bool
+LuaPolicy::loaded() const
+{
+  return fn_ref_ != LUA_NOREF;
+}
+
+bool
+LuaPolicy::apply(VersionInfo &vi)
+{
+  lua_State  *L;
+  lua_Integer build;
+  int         isnum = 0;
+
+  if (fn_ref_ == LUA_NOREF) {
+    return false;
+  }
+
+  L = state_->get();
+
+  lua_rawgeti(L, LUA_REGISTRYINDEX, fn_ref_);
+  lua_pushinteger(L, vi.get_build());
+  lua_pushinteger(L, vi.get_base_year());
+  lua_pushinteger(L, vi.get_major());
+  lua_pushinteger(L, vi.get_minor());
+  lua_pushinteger(L, vi.get_patch());
+
+  if (state_->pcall(5, 1) != LUA_OK) {
+    ESAY("Lua:", state_->pop_error());
+    return false;
+  }
+
+  build = lua_tointegerx(L, -1, &isnum);
+  lua_pop(L, 1);
+
+  if (!isnum || build < 0 || build > static_cast<lua_Integer>(UINT32_MAX)) {
+    ESAY("Increment policy returned an invalid build number.");
+    return false;
+  }
+
+  vi.set_build(static_cast<uint32_t>(build));
+
+  return true;
+}
+
+// LuaPolicy.cpp ends here.
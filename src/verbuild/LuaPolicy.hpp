@@ -0,0 +1,77 @@
+//
+// LuaPolicy.hpp --- Lua-defined increment policy.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 11:58:44
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file LuaPolicy.hpp
+ * @author Paul Ward
+ * @brief Lua-defined increment policy.
+ *
+ * The policy script returns a function, or a table with an
+ * `increment' field, called as:
+ *
+ *   increment(build, base_year, major, minor, patch) -> new build
+ *
+ * The function is resolved once and pinned in the registry with
+ * @c luaL_ref; each call only pushes integers.
+ */
+
+#pragma once
+#ifndef _LuaPolicy_hpp_
+#define _LuaPolicy_hpp_
+
+#include "Support.hpp"
+#include "IncrementPolicy.hpp"
+#include "LuaState.hpp"
+
+#include <memory>
+#include <string>
+
+class LuaPolicy
+  : public IncrementPolicy
+{
+private:
+  std::unique_ptr<LuaState> state_;
+  int                       fn_ref_ = LUA_NOREF;
+
+public:
+  LuaPolicy();
+  LuaPolicy(const LuaPolicy &) = delete;
+  ~LuaPolicy();
+
+  bool load(const std::string &,
+            const std::string &,
+            const LuaLimits & = LuaLimits());
+  bool loaded() const;
+
+  bool apply(VersionInfo &);
+};
+
+#endif // !_LuaPolicy_hpp_
+
+// LuaPolicy.hpp ends here.
@@ -0,0 +1,129 @@
+//
+// LuaPool.cpp --- Reusable Lua states.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 15:09:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaPool.cpp
+ * @author Paul Ward
+ * @brief Reusable Lua states.
+ */
+
+#include "LuaPool.hpp"
+#include "Console.hpp"
+
+using namespace std;
+
+LuaPool::LuaPool()
+  : lock_(),
+    states_(),
+    idle_()
+{}
+
+LuaPool::~LuaPool()
+{}
+
+/**
+ * @brief Take an idle state, or create one if there is none.
+ * @param limits Limits for a newly created state.
+ *
+ * Limits only apply to states created by this call; an idle state
+ * keeps the limits it was created with.
+ */
+LuaState *
+LuaPool::acquire(const LuaLimits &limits)
+{
+  LuaState *state;
+
+  {
+    lock_guard<mutex> guard(lock_);
+
+    if (!idle_.empty()) {
+      state = idle_.back();
+      idle_.pop_back();
+
+      return state;
+    }
+  }
+
+  // Construct outside the lock; it is the expensive part.
+  unique_ptr<LuaState> fresh(new LuaState(limits));
+
+  state = fresh.get();
+  DSAY(DEBUG_HIGH, "Created pooled Lua state");
+
+  {
+    lock_guard<mutex> guard(lock_);
+
+    states_.push_back(move(fresh));
+  }
+
+  return state;
+}
+
+/**
+ * @brief Reset a state and make it available again.
+ */
+void
+LuaPool::release(LuaState *state)
+{
+  if (state == nullptr) {
+    return;
+  }
+
+  state->reset();
+
+  lock_guard<mutex> guard(lock_);
+
+  idle_.push_back(state);
+}
+
+size_t
+LuaPool::size()
+{
+  lock_guard<mutex> guard(lock_);
+
+  return states_.size();
+}
+
+size_t
+LuaPool::idle()
+{
+  lock_guard<mutex> guard(lock_);
+
+  return idle_.size();
+}
+
+LuaPool &
+get_lua_pool()
+{
+  static LuaPool pool;
+
+  return pool;
+}
+
+// LuaPool.cpp ends here.
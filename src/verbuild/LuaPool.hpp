@@ -0,0 +1,77 @@
+//
+// LuaPool.hpp --- Reusable Lua states.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 15:02:18
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file LuaPool.hpp
+ * @author Paul Ward
+ * @brief Reusable Lua states.
+ *
+ * Setting up a sandboxed state costs far more than a typical script
+ * call, so states are kept once created.  A worker acquires a state
+ * for the file it is processing and releases it afterwards; the state
+ * is reset and handed to the next worker.  The pool only creates a
+ * state when none is idle, so it ends up holding one per concurrent
+ * worker.
+ */
+
+#pragma once
+#ifndef _LuaPool_hpp_
+#define _LuaPool_hpp_
+
+#include "Support.hpp"
+#include "LuaState.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class LuaPool
+{
+private:
+  std::mutex                             lock_;
+  std::vector<std::unique_ptr<LuaState>> states_;
+  std::vector<LuaState *>                idle_;
+
+public:
+  LuaPool();
+  LuaPool(const LuaPool &) = delete;
+  ~LuaPool();
+
+  LuaState *acquire(const LuaLimits &);
+  void      release(LuaState *);
+
+  std::size_t size();
+  std::size_t idle();
+};
+
+LuaPool &get_lua_pool();
+
+#endif // !_LuaPool_hpp_
+
+// LuaPool.hpp ends here.
@@ -0,0 +1,510 @@
+//
+// LuaState.cpp --- Lua interpreter state implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 09:41:17
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file LuaState.cpp
+ * @author Paul Ward
+ * @brief Lua interpreter state implementation.
+ */
+
+#include "LuaState.hpp"
+#include "LuaCache.hpp"
+#include "Console.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+static
+lua_Integer
+check_component(lua_State *L, int idx)
+{
+  lua_Integer val = luaL_checkinteger(L, idx);
+
+  luaL_argcheck(L,
+                val >= 0 && val <= static_cast<lua_Integer>(UINT32_MAX),
+                idx,
+                "version component out of range");
+
+  return val;
+}
+
+static
+int
+vi_to_string(lua_State *L)
+{
+  VersionInfo *vi = lua_check_version_info(L, 1);
+
+  lua_pushstring(L, vi->to_string().c_str());
+
+  return 1;
+}
+
+static
+int
+vi_index(lua_State *L)
+{
+  VersionInfo *vi  = lua_check_version_info(L, 1);
+  const char  *key = luaL_checkstring(L, 2);
+
+  if (strcmp(key, "major") == 0) {
+    lua_pushinteger(L, vi->get_major());
+  } else if (strcmp(key, "minor") == 0) {
+    lua_pushinteger(L, vi->get_minor());
+  } else if (strcmp(key, "build") == 0) {
+    lua_pushinteger(L, vi->get_build());
+  } else if (strcmp(key, "patch") == 0) {
+    lua_pushinteger(L, vi->get_patch());
+  } else if (strcmp(key, "base_year") == 0) {
+    lua_pushinteger(L, vi->get_base_year());
+  } else if (strcmp(key, "increment_type") == 0) {
+    stringstream ss;
+
+    ss << vi->get_increment_type();
+    lua_pushstring(L, ss.str().c_str());
+  } else if (strcmp(key, "to_string") == 0) {
+    lua_pushcfunction(L, vi_to_string);
+  } else {
+    lua_pushnil(L);
+  }
+
+  return 1;
+}
+
+static
+int
+vi_newindex(lua_State *L)
+{
+  VersionInfo *vi  = lua_check_version_info(L, 1);
+  const char  *key = luaL_checkstring(L, 2);
+  uint32_t     val = static_cast<uint32_t>(check_component(L, 3));
+
+  if (strcmp(key, "major") == 0) {
+    vi->set_major(val);
+  } else if (strcmp(key, "minor") == 0) {
+    vi->set_minor(val);
+  } else if (strcmp(key, "build") == 0) {
+    vi->set_build(val);
+  } else if (strcmp(key, "patch") == 0) {
+    vi->set_patch(val);
+  } else if (strcmp(key, "base_year") == 0) {
+    vi->set_base_year(val);
+  } else {
+    return luaL_error(L, "cannot set field '%s' of VersionInfo", key);
+  }
+
+  return 0;
+}
+
+static
+int
+vb_today(lua_State *L)
+{
+  date::date today(date::day_clock::local_day());
+
+  lua_pushinteger(L, today.year());
+  lua_pushinteger(L, today.month());
+  lua_pushinteger(L, today.day());
+
+  return 3;
+}
+
+static
+int
+vb_iso_week(lua_State *L)
+{
+  date::date today(date::day_clock::local_day());
+  int        week = today.week_number();
+  int        year = today.year();
+  int        wday = today.day_of_week();
+
+  // Early January may belong to the last week of the previous year,
+  // and late December to the first week of the next.
+  if (week >= 52 && today.month() == 1) {
+    year--;
+  } else if (week == 1 && today.month() == 12) {
+    year++;
+  }
+
+  lua_pushinteger(L, year);
+  lua_pushinteger(L, week);
+  lua_pushinteger(L, (wday == 0) ? 7 : wday);
+
+  return 3;
+}
+
+static const luaL_Reg vb_lib[] = {
+  { "today",    vb_today    },
+  { "iso_week", vb_iso_week },
+  { nullptr,    nullptr     }
+};
+
+static const luaL_Reg vi_meta[] = {
+  { "__index",    vi_index     },
+  { "__newindex", vi_newindex  },
+  { "__tostring", vi_to_string },
+  { nullptr,      nullptr      }
+};
+
+/**
+ * @brief Build the Lua limits requested on the command line.
+ */
+LuaLimits
+make_lua_limits(const Config &conf)
+{
+  LuaLimits limits;
+
+  limits.memory       = conf.lua_memory_limit;
+  limits.instructions = conf.lua_instruction_limit;
+
+  return limits;
+}
+
+void
+lua_push_version_info(lua_State *L, VersionInfo *vi)
+{
+  VersionInfo **ud = static_cast<VersionInfo **>(
+    lua_newuserdatauv(L, sizeof(VersionInfo *), 0)
+  );
+
+  *ud = vi;
+  luaL_setmetatable(L, LUA_VERSIONINFO_META);
+}
+
+VersionInfo *
+lua_check_version_info(lua_State *L, int idx)
+{
+  VersionInfo **ud = static_cast<VersionInfo **>(
+    luaL_checkudata(L, idx, LUA_VERSIONINFO_META)
+  );
+
+  return *ud;
+}
+
+static
+int
+safe_load(lua_State *L)
+{
+  // Force text mode; crafted bytecode can crash the VM.
+  if (lua_gettop(L) < 3) {
+    lua_settop(L, 3);
+  }
+
+  lua_pushliteral(L, "t");
+  lua_replace(L, 3);
+
+  lua_pushvalue(L, lua_upvalueindex(1));
+  lua_insert(L, 1);
+  lua_call(L, lua_gettop(L) - 1, LUA_MULTRET);
+
+  return lua_gettop(L);
+}
+
+static
+int
+panic(lua_State *L)
+{
+  const char *msg = lua_tostring(L, -1);
+
+  FATAL("Unprotected Lua error:", (msg == nullptr ? "(unknown)" : msg));
+
+  return 0;
+}
+
+static const luaL_Reg safe_libs[] = {
+  { LUA_GNAME,       luaopen_base      },
+  { LUA_COLIBNAME,   luaopen_coroutine },
+  { LUA_TABLIBNAME,  luaopen_table     },
+  { LUA_STRLIBNAME,  luaopen_string    },
+  { LUA_MATHLIBNAME, luaopen_math      },
+  { LUA_UTF8LIBNAME, luaopen_utf8      },
+  { nullptr,         nullptr           }
+};
+
+LuaState::LuaState()
+  : LuaState(LuaLimits())
+{}
+
+LuaState::LuaState(const LuaLimits &limits)
+  : arena_(limits.memory),
+    state_(nullptr),
+    budget_(limits.instructions),
+    remaining_(limits.instructions),
+    baseline_ref_(LUA_NOREF),
+    modules_()
+{
+  state_ = lua_newstate(LuaArena::alloc, &arena_);
+  if (state_ == nullptr) {
+    throw runtime_error("Cannot create Lua state");
+  }
+
+  lua_atpanic(state_, panic);
+  *static_cast<LuaState **>(lua_getextraspace(state_)) = this;
+
+  reset_budget();
+
+  open_libraries();
+
+  luaL_newmetatable(state_, LUA_VERSIONINFO_META);
+  luaL_setfuncs(state_, vi_meta, 0);
+  lua_pop(state_, 1);
+
+  luaL_newlib(state_, vb_lib);
+  lua_setglobal(state_, "verbuild");
+
+  snapshot_globals();
+}
+
+LuaState::~LuaState()
+{
+  lua_close(state_);
+
+  LSAY("Lua memory high-water mark:",
+       arena_.get_peak(),
+       "bytes of",
+       (arena_.get_limit() == 0 ? "unlimited" : to_string(arena_.get_limit())));
+}
+
+void
+LuaState::open_libraries()
+{
+  for (const luaL_Reg *lib = safe_libs; lib->func != nullptr; lib++) {
+    luaL_requiref(state_, lib->name, lib->func, 1);
+    lua_pop(state_, 1);
+  }
+
+  lua_pushnil(state_);
+  lua_setglobal(state_, "dofile");
+  lua_pushnil(state_);
+  lua_setglobal(state_, "loadfile");
+
+  lua_getglobal(state_, "load");
+  lua_pushcclosure(state_, safe_load, 1);
+  lua_setglobal(state_, "load");
+}
+
+/**
+ * @brief Record a shallow copy of the global table for @c reset.
+ */
+void
+LuaState::snapshot_globals()
+{
+  lua_newtable(state_);
+  lua_pushglobaltable(state_);
+  lua_pushnil(state_);
+  while (lua_next(state_, -2) != 0) {
+    lua_pushvalue(state_, -2);
+    lua_insert(state_, -2);
+    lua_rawset(state_, -5);
+  }
+  lua_pop(state_, 1);
+
+  baseline_ref_ = luaL_ref(state_, LUA_REGISTRYINDEX);
+}
+
+/**
+ * @brief Return the state to its freshly constructed condition.
+ *
+ * Globals added since construction are removed and replaced ones are
+ * restored.  The restore is shallow: changes made inside library
+ * tables survive.  Modules pinned by @c load_module are kept, so the
+ * next file does not need to load its script again.
+ */
+void
+LuaState::reset()
+{
+  lua_settop(state_, 0);
+  lua_pushglobaltable(state_);
+  lua_rawgeti(state_, LUA_REGISTRYINDEX, baseline_ref_);
+
+  // Clearing fields during traversal is permitted by lua_next.
+  lua_pushnil(state_);
+  while (lua_next(state_, 1) != 0) {
+    lua_pop(state_, 1);
+    lua_pushvalue(state_, -1);
+    if (lua_rawget(state_, 2) == LUA_TNIL) {
+      lua_pushvalue(state_, -2);
+      lua_pushnil(state_);
+      lua_rawset(state_, 1);
+    }
+    lua_pop(state_, 1);
+  }
+
+  lua_pushnil(state_);
+  while (lua_next(state_, 2) != 0) {
+    lua_pushvalue(state_, -2);
+    lua_insert(state_, -2);
+    lua_rawset(state_, 1);
+  }
+
+  lua_pushnil(state_);
+  lua_setmetatable(state_, 1);
+  lua_settop(state_, 0);
+
+  lua_gc(state_, LUA_GCCOLLECT);
+  reset_budget();
+}
+
+/*
+ * Once the budget is spent the hook fires on every instruction and
+ * raises again each time, so a script cannot carry on by catching the
+ * error with `pcall' or in a coroutine.  Only a return to C and a new
+ * budget clear it.
+ */
+void
+LuaState::count_hook(lua_State *L, lua_Debug *)
+{
+  LuaState *self = *static_cast<LuaState **>(lua_getextraspace(L));
+
+  if (self->remaining_ <= LUA_HOOK_INTERVAL) {
+    self->remaining_ = 0;
+    lua_sethook(L, count_hook, LUA_MASKCOUNT, 1);
+    if (L != self->state_) {
+      lua_sethook(self->state_, count_hook, LUA_MASKCOUNT, 1);
+    }
+
+    luaL_error(L, "instruction budget exhausted");
+    return;
+  }
+
+  self->remaining_ -= LUA_HOOK_INTERVAL;
+}
+
+/**
+ * @brief Protected call with a fresh instruction budget.
+ */
+int
+LuaState::pcall(int nargs, int nresults)
+{
+  reset_budget();
+
+  return lua_pcall(state_, nargs, nresults, 0);
+}
+
+void
+LuaState::reset_budget()
+{
+  remaining_ = budget_;
+
+  if (budget_ > 0) {
+    lua_sethook(state_, count_hook, LUA_MASKCOUNT, LUA_HOOK_INTERVAL);
+  }
+}
+
+size_t
+LuaState::get_memory_used() const
+{
+  return arena_.get_used();
+}
+
+size_t
+LuaState::get_memory_peak() const
+{
+  return arena_.get_peak();
+}
+
+lua_State *
+LuaState::get() const
+{
+  return state_;
+}
+
+/**
+ * @brief Load and run a script.
+ * @param path Path to the script.
+ * @param cache_dir Bytecode cache directory, or empty to disable.
+ * @returns true if the script ran; its first result is left on the
+ *          stack.  On failure the error message is left on the stack.
+ */
+bool
+LuaState::load_file(const string &path, const string &cache_dir)
+{
+  ifstream strm(path, ios::binary);
+  string   source;
+  LuaCache cache(cache_dir);
+
+  if (!strm.good()) {
+    lua_pushfstring(state_, "cannot open %s", path.c_str());
+    return false;
+  }
+
+  source.assign((istreambuf_iterator<char>(strm)),
+                 istreambuf_iterator<char>());
+
+  DSAY(DEBUG_MEDIUM, "Loading Lua script", path);
+  if (cache.load(state_, source, "@" + path) != LUA_OK) {
+    return false;
+  }
+
+  return pcall(0, 1) == LUA_OK;
+}
+
+/**
+ * @brief Push the value returned by the script at @c path.
+ *
+ * The script only runs the first time; later calls push the pinned
+ * result.  On failure the error message is left on the stack.
+ */
+bool
+LuaState::load_module(const string &path, const string &cache_dir)
+{
+  auto it = modules_.find(path);
+
+  if (it != modules_.end()) {
+    lua_rawgeti(state_, LUA_REGISTRYINDEX, it->second);
+    return true;
+  }
+
+  if (!load_file(path, cache_dir)) {
+    return false;
+  }
+
+  lua_pushvalue(state_, -1);
+  modules_[path] = luaL_ref(state_, LUA_REGISTRYINDEX);
+
+  return true;
+}
+
+string
+LuaState::pop_error()
+{
+  const char *msg = lua_tostring(state_, -1);
+  string      res(msg == nullptr ? "(error object is not a string)" : msg);
+
+  lua_pop(state_, 1);
+
+  return res;
+}
+
+// LuaState.cpp ends here.
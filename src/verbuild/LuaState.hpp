@@ -0,0 +1,144 @@
+//
+// LuaState.hpp --- Lua interpreter state.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 09:12:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file LuaState.hpp
+ * @author Paul Ward
+ * @brief Lua interpreter state.
+ */
+
+#pragma once
+#ifndef _LuaState_hpp_
+#define _LuaState_hpp_
+
+#include "Support.hpp"
+#include "VersionInfo.hpp"
+#include "LuaArena.hpp"
+#include "Config.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+extern "C" {
+#include "lua.h"
+#include "lauxlib.h"
+#include "lualib.h"
+}
+
+/**
+ * @def LUA_VERSIONINFO_META
+ * @brief Registry name of the metatable for @c VersionInfo userdata.
+ */
+#define LUA_VERSIONINFO_META "verbuild.VersionInfo"
+
+/**
+ * @def LUA_DEFAULT_MEMORY_LIMIT
+ * @brief Default cap on the memory a Lua state may allocate.
+ */
+#define LUA_DEFAULT_MEMORY_LIMIT (64 * 1024 * 1024)
+
+/**
+ * @def LUA_DEFAULT_INSTRUCTION_LIMIT
+ * @brief Default number of VM instructions allowed per call.
+ */
+#define LUA_DEFAULT_INSTRUCTION_LIMIT 100000000ULL
+
+/**
+ * @def LUA_HOOK_INTERVAL
+ * @brief Instructions between budget checks.
+ */
+#define LUA_HOOK_INTERVAL 1000
+
+/**
+ * @brief Resource limits for a Lua state; zero means unlimited.
+ */
+struct LuaLimits
+{
+  std::size_t   memory       = LUA_DEFAULT_MEMORY_LIMIT;
+  std::uint64_t instructions = LUA_DEFAULT_INSTRUCTION_LIMIT;
+};
+
+/**
+ * @brief A sandboxed Lua state.
+ *
+ * Memory comes from a capped @c LuaArena, every call runs against an
+ * instruction budget, and only the base, coroutine, table, string,
+ * math and utf8 libraries are available.  @c dofile and @c loadfile
+ * are removed and @c load only accepts source text.
+ *
+ * A state can be reused for several files: @c load_module keeps each
+ * script's result pinned in the registry, and @c reset puts the
+ * globals back the way they were after construction.
+ */
+class LuaState
+{
+private:
+  LuaArena      arena_;
+  lua_State    *state_;
+  std::uint64_t budget_;
+  std::uint64_t remaining_;
+  int           baseline_ref_;
+
+  std::map<std::string, int> modules_;
+
+public:
+  LuaState();
+  LuaState(const LuaLimits &);
+  LuaState(const LuaState &) = delete;
+  ~LuaState();
+
+  lua_State *get() const;
+
+  bool load_file(const std::string &, const std::string &);
+  bool load_module(const std::string &, const std::string &);
+  int  pcall(int, int);
+
+  void reset_budget();
+  void reset();
+
+  std::size_t get_memory_used() const;
+  std::size_t get_memory_peak() const;
+
+  std::string pop_error();
+
+private:
+  void open_libraries();
+  void snapshot_globals();
+
+  static void count_hook(lua_State *, lua_Debug *);
+};
+
+LuaLimits    make_lua_limits(const Config &);
+void         lua_push_version_info(lua_State *, VersionInfo *);
+VersionInfo *lua_check_version_info(lua_State *, int);
+
+#endif // !_LuaState_hpp_
+
+// LuaState.hpp ends here.
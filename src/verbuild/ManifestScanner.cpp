@@ -0,0 +1,581 @@
+//
+// ManifestScanner.cpp --- Package manifest version scanner.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 21:04:45
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file ManifestScanner.cpp
+ * @author Paul Ward
+ * @brief Package manifest version scanner.
+ */
+
+#include "ManifestScanner.hpp"
+
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+static inline
+bool
+is_space(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static inline
+bool
+is_blank(char c)
+{
+  return c == ' ' || c == '\t';
+}
+
+static inline
+bool
+is_bare(char c)
+{
+  return c == '_' || c == '-' ||
+         (c >= '0' && c <= '9') ||
+         (c >= 'A' && c <= 'Z') ||
+         (c >= 'a' && c <= 'z');
+}
+
+static inline
+const char *
+skip_blanks(const char *p, const char *end)
+{
+  while (p < end && is_blank(*p)) {
+    p++;
+  }
+
+  return p;
+}
+
+static inline
+const char *
+line_end(const char *p, const char *end)
+{
+  const char *nl = static_cast<const char *>(memchr(p, '\n', end - p));
+
+  return (nl == nullptr) ? end : nl;
+}
+
+static inline
+bool
+starts_with(const char *p, const char *end, const char *prefix)
+{
+  size_t len = strlen(prefix);
+
+  return static_cast<size_t>(end - p) >= len && memcmp(p, prefix, len) == 0;
+}
+
+/*
+ * Find `seq' at or after `p'; returns the byte after it, or `end'.
+ */
+static
+const char *
+skip_past(const char *p, const char *end, const char *seq)
+{
+  size_t len = strlen(seq);
+
+  while (p < end) {
+    p = static_cast<const char *>(memchr(p, seq[0], end - p));
+
+    if (p == nullptr) {
+      return end;
+    }
+
+    if (starts_with(p, end, seq)) {
+      return p + len;
+    }
+
+    p++;
+  }
+
+  return end;
+}
+
+// {{{ JSON:
+
+/*
+ * Find the closing quote of a JSON string whose body starts at
+ * `start'.  A quote is escaped when an odd number of backslashes
+ * precede it.
+ */
+static
+const char *
+json_string_end(const char *start, const char *end)
+{
+  const char *p = start;
+
+  while (p < end) {
+    const char *quote = static_cast<const char *>(memchr(p, '"', end - p));
+    const char *back;
+
+    if (quote == nullptr) {
+      return end;
+    }
+
+    for (back = quote; back > start && back[-1] == '\\'; back--) {
+      continue;
+    }
+
+    if ((quote - back) % 2 == 0) {
+      return quote;
+    }
+
+    p = quote + 1;
+  }
+
+  return end;
+}
+
+static
+bool
+find_json(const char *data, const char *end, ManifestValue &value)
+{
+  const char *p          = data;
+  int         depth      = 0;
+  bool        expect_key = false;
+  bool        want       = false;
+
+  if (starts_with(p, end, "\xEF\xBB\xBF")) {
+    p += 3;
+  }
+
+  for (; p < end; p++) {
+    switch (*p) {
+      case '"': {
+        const char *start = p + 1;
+
+        p = json_string_end(start, end);
+        if (p == end) {
+          return false;
+        }
+
+        if (depth != 1) {
+          break;
+        }
+
+        if (expect_key) {
+          want       = (p - start == 7 && memcmp(start, "version", 7) == 0);
+          expect_key = false;
+        } else if (want) {
+          value.offset = start - data;
+          value.length = p - start;
+          return true;
+        }
+        break;
+      }
+
+      case '{':
+      case '[':
+        if (depth == 0 && *p != '{') {
+          return false;
+        }
+
+        expect_key = (++depth == 1);
+        want       = false;
+        break;
+
+      case '}':
+      case ']':
+        if (--depth <= 0) {
+          return false;
+        }
+        break;
+
+      case ',':
+        if (depth == 1) {
+          expect_key = true;
+          want       = false;
+        }
+        break;
+
+      default:
+        if (depth == 0 && !is_space(*p)) {
+          return false;
+        }
+        break;
+    }
+  }
+
+  return false;
+}
+
+// }}}
+// {{{ TOML:
+
+/*
+ * Skip a string starting at the quote `p', single or multi-line,
+ * basic or literal.  Returns the byte after the closing quote.
+ */
+static
+const char *
+toml_string_end(const char *p, const char *end)
+{
+  char quote = *p;
+  bool multi = starts_with(p, end, (quote == '"') ? "\"\"\"" : "'''");
+
+  p += multi ? 3 : 1;
+
+  while (p < end) {
+    if (*p == '\\' && quote == '"') {
+      p += (p + 1 < end) ? 2 : 1;
+      continue;
+    }
+
+    if (*p == '\n' && !multi) {
+      return p;
+    }
+
+    if (*p == quote) {
+      if (!multi) {
+        return p + 1;
+      }
+
+      if (starts_with(p, end, (quote == '"') ? "\"\"\"" : "'''")) {
+        return p + 3;
+      }
+    }
+
+    p++;
+  }
+
+  return end;
+}
+
+/*
+ * Read a bare, quoted or dotted key.  The parts are joined with `.'
+ * and whitespace around the dots is dropped.
+ */
+static
+bool
+read_toml_key(const char *&p, const char *end, string &key)
+{
+  key.clear();
+
+  for (;;) {
+    const char *start;
+
+    p = skip_blanks(p, end);
+
+    if (p < end && (*p == '"' || *p == '\'')) {
+      start = p + 1;
+      p     = toml_string_end(p, end);
+
+      if (p[-1] != *(start - 1) || p - start < 1) {
+        return false;
+      }
+
+      key.append(start, p - 1 - start);
+    } else if (p < end && is_bare(*p)) {
+      for (start = p; p < end && is_bare(*p); p++) {
+        continue;
+      }
+
+      key.append(start, p - start);
+    } else {
+      return false;
+    }
+
+    p = skip_blanks(p, end);
+
+    if (p == end || *p != '.') {
+      return true;
+    }
+
+    key += '.';
+    p++;
+  }
+}
+
+/*
+ * Skip a value, which may run over several lines inside an array or
+ * inline table.  Returns the end of its last line.
+ */
+static
+const char *
+skip_toml_value(const char *p, const char *end)
+{
+  int depth = 0;
+
+  while (p < end) {
+    switch (*p) {
+      case '"':
+      case '\'':
+        p = toml_string_end(p, end);
+        continue;
+
+      case '#':
+        p = line_end(p, end);
+        continue;
+
+      case '[':
+      case '{':
+        depth++;
+        break;
+
+      case ']':
+      case '}':
+        depth--;
+        break;
+
+      case '\n':
+        if (depth <= 0) {
+          return p;
+        }
+        break;
+    }
+
+    p++;
+  }
+
+  return end;
+}
+
+static
+bool
+find_toml(const char    *data,
+          const char    *end,
+          const char   **targets,
+          ManifestValue &value)
+{
+  const char *p        = data;
+  bool        in_array = false;
+  string      table;
+  string      key;
+
+  while (p < end) {
+    string full;
+
+    if (is_space(*p)) {
+      p++;
+      continue;
+    }
+
+    if (*p == '#') {
+      p = line_end(p, end);
+      continue;
+    }
+
+    if (*p == '[') {
+      in_array  = starts_with(p, end, "[[");
+      p        += in_array ? 2 : 1;
+
+      if (!read_toml_key(p, end, table)) {
+        return false;
+      }
+
+      p = line_end(p, end);
+      continue;
+    }
+
+    if (!read_toml_key(p, end, key)) {
+      return false;
+    }
+
+    p = skip_blanks(p, end);
+    if (p == end || *p != '=') {
+      return false;
+    }
+
+    p    = skip_blanks(p + 1, end);
+    full = table.empty() ? key : table + "." + key;
+
+    for (const char **t = targets; *t != nullptr && !in_array; t++) {
+      const char *close;
+
+      if (full != *t) {
+        continue;
+      }
+
+      // Only a plain one-line string is a version we can edit.
+      if (p == end || (*p != '"' && *p != '\'') ||
+          starts_with(p, end, "\"\"\"") || starts_with(p, end, "'''")) {
+        return false;
+      }
+
+      close = toml_string_end(p, end);
+      if (close[-1] != *p || close - p < 2) {
+        return false;
+      }
+
+      value.offset = p + 1 - data;
+      value.length = close - p - 2;
+      return true;
+    }
+
+    p = skip_toml_value(p, end);
+  }
+
+  return false;
+}
+
+// }}}
+// {{{ XML:
+
+static
+bool
+find_xml(const char *data, const char *end, ManifestValue &value)
+{
+  const char *p     = data;
+  int         depth = 0;
+
+  while ((p = static_cast<const char *>(memchr(p, '<', end - p))) != nullptr) {
+    const char *name;
+    const char *colon;
+    bool        is_version;
+    char        quote = 0;
+
+    if (starts_with(p, end, "<!--")) {
+      p = skip_past(p + 4, end, "-->");
+      continue;
+    }
+
+    if (starts_with(p, end, "<![CDATA[")) {
+      p = skip_past(p + 9, end, "]]>");
+      continue;
+    }
+
+    if (starts_with(p, end, "<?")) {
+      p = skip_past(p + 2, end, "?>");
+      continue;
+    }
+
+    if (starts_with(p, end, "<!")) {
+      p = skip_past(p + 2, end, ">");
+      continue;
+    }
+
+    if (starts_with(p, end, "</")) {
+      p = skip_past(p + 2, end, ">");
+
+      if (--depth <= 0) {
+        return false;
+      }
+      continue;
+    }
+
+    for (name = ++p; p < end && !is_space(*p) && *p != '>' && *p != '/'; p++) {
+      continue;
+    }
+
+    // Compare local names, so a namespace prefix does not matter.
+    colon = static_cast<const char *>(memchr(name, ':', p - name));
+    if (colon != nullptr) {
+      name = colon + 1;
+    }
+
+    is_version = (p - name == 7 && memcmp(name, "version", 7) == 0);
+
+    while (p < end && (quote != 0 || *p != '>')) {
+      if (quote != 0) {
+        quote = (*p == quote) ? 0 : quote;
+      } else if (*p == '"' || *p == '\'') {
+        quote = *p;
+      }
+
+      p++;
+    }
+
+    if (p == end) {
+      return false;
+    }
+
+    if (p[-1] == '/') {
+      p++;
+      continue;
+    }
+
+    p++;
+
+    if (++depth == 2 && is_version) {
+      const char *stop = static_cast<const char *>(memchr(p, '<', end - p));
+
+      if (stop == nullptr) {
+        return false;
+      }
+
+      while (p < stop && is_space(*p)) {
+        p++;
+      }
+
+      while (stop > p && is_space(stop[-1])) {
+        stop--;
+      }
+
+      value.offset = p - data;
+      value.length = stop - p;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// }}}
+
+/**
+ * @brief Find the top-level version of a manifest.
+ * @param format Which kind of manifest @c data holds.
+ * @param data The manifest text.
+ * @param len Length of @c data.
+ * @param value Receives the position of the version value.
+ * @returns false if there is no top-level version string.
+ */
+bool
+find_manifest_version(ManifestFormat format,
+                      const char    *data,
+                      size_t         len,
+                      ManifestValue &value)
+{
+  static const char *cargo[]     = { "package.version", nullptr };
+  static const char *pyproject[] = {
+    "project.version",
+    "tool.poetry.version",
+    nullptr
+  };
+
+  switch (format) {
+    case ManifestFormat::Npm:
+      return find_json(data, data + len, value);
+
+    case ManifestFormat::Cargo:
+      return find_toml(data, data + len, cargo, value);
+
+    case ManifestFormat::PyProject:
+      return find_toml(data, data + len, pyproject, value);
+
+    case ManifestFormat::Maven:
+      return find_xml(data, data + len, value);
+  }
+
+  return false;
+}
+
+// ManifestScanner.cpp ends here.
@@ -0,0 +1,76 @@
+//
+// ManifestScanner.hpp --- Package manifest version scanner.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 20:52:18
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file ManifestScanner.hpp
+ * @author Paul Ward
+ * @brief Package manifest version scanner.
+ *
+ * Finds the top-level version value of a package manifest:
+ *
+ *   package.json    -- the `version' member of the root object.
+ *   Cargo.toml      -- `version' in the [package] table.
+ *   pyproject.toml  -- `version' in [project] or [tool.poetry].
+ *   pom.xml         -- the <version> child of the root element.
+ *
+ * Each scanner is a single forward pass that only tokenises: strings,
+ * comments and nested values are skipped, nothing is built, and the
+ * scan stops at the first match.  Only the position of the value is
+ * reported, so the rest of the file can be left as it is.
+ */
+
+#pragma once
+#ifndef _ManifestScanner_hpp_
+#define _ManifestScanner_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+
+enum class ManifestFormat : unsigned char {
+  Npm,
+  Cargo,
+  PyProject,
+  Maven
+};
+
+struct ManifestValue
+{
+  std::size_t offset;           // First byte of the value, inside quotes.
+  std::size_t length;           // Length of the value.
+};
+
+bool find_manifest_version(ManifestFormat,
+                           const char *,
+                           std::size_t,
+                           ManifestValue &);
+
+#endif // !_ManifestScanner_hpp_
+
+// ManifestScanner.hpp ends here.
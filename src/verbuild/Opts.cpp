@@ -42,6 +42,11 @@
 #include "IncrTypeParser.hpp"
 #include "TransformParser.hpp"
 #include "GroupsParser.hpp"
+#include "LuaCache.hpp"
+#include "InputDigest.hpp"
+#include "Command.hpp"
+#include "Transform_Lua.hpp"
+#include "Transform_Template.hpp"
 #include "version.hpp"
 
 #include <boost/date_time/gregorian/gregorian.hpp>
@@ -53,7 +58,11 @@
 #include <sstream>
 #include <ostream>
 #include <cstdlib>
+#include <cctype>
 #include <utility>
+#include <set>
+#include <filesystem>
+#include <system_error>
 
 #include "../resources/help.h"
 #include "../resources/cli/banner.h"
@@ -62,6 +71,7 @@ using namespace std;
 
 namespace po   = boost::program_options;
 namespace date = boost::gregorian;
+namespace fs   = std::filesystem;
 
 static const char *program_name;
 
@@ -71,6 +81,12 @@ set_program_name(const char *name)
   program_name = name;
 }
 
+const char *
+get_program_name()
+{
+  return program_name;
+}
+
 static
 void
 generate_info(po::options_description &desc)
@@ -96,7 +112,35 @@ generate_transform(po::options_description &desc)
        ->default_value("")
        ->implicit_value("")
        ->value_name("prefix"),
-     (const char *)res_help_prefix);
+     (const char *)res_help_prefix)
+    ("scan-limit",
+     po::value<uint64_t>()
+       ->default_value(4096)
+       ->value_name("KiB"),
+     (const char *)res_help_scan_limit)
+    ("template",
+     po::value<string>()
+       ->value_name("file"),
+     (const char *)res_help_template)
+    ("script,s",
+     po::value<string>()
+       ->value_name("file"),
+     (const char *)res_help_script)
+    ("script-cache",
+     po::value<string>()
+       ->default_value(LuaCache::default_directory())
+       ->value_name("dir"),
+     (const char *)res_help_script_cache)
+    ("lua-memory",
+     po::value<size_t>()
+       ->default_value(64)
+       ->value_name("MiB"),
+     (const char *)res_help_lua_memory)
+    ("lua-instructions",
+     po::value<uint64_t>()
+       ->default_value(100000000)
+       ->value_name("count"),
+     (const char *)res_help_lua_instructions);
 }
 
 static
@@ -116,6 +160,19 @@ generate_increment(po::options_description &desc)
        ->default_value(IncrTypeParser("simple"))
        ->value_name("type"),
      (const char *)res_help_increment)
+    ("policy",
+     po::value<string>()
+       ->value_name("file"),
+     (const char *)res_help_policy)
+    ("if-changed",
+     po::value<vector<string>>()
+       ->composing()
+       ->value_name("path"),
+     (const char *)res_help_if_changed)
+    ("digest-file",
+     po::value<string>()
+       ->value_name("file"),
+     (const char *)res_help_digest_file)
     ("year,y",
      po::value<int>()
        ->default_value(today.year())
@@ -123,6 +180,76 @@ generate_increment(po::options_description &desc)
      (const char *)res_help_year);
 }
 
+/**
+ * @brief Split `transform:file'.
+ * @param arg The `--output' argument.
+ * @param fallback The transform to use when @c arg names none.
+ *
+ * The part before the colon only counts as a transform if one of that
+ * name exists, so other paths with colons are left alone.  A single
+ * letter is taken for a Windows drive when it is upper case or the
+ * colon is followed by a separator, so `C:sub/v.h' and `c:/v.h' are
+ * paths but `c:v.h' uses the `c' transform.
+ */
+OutputSpec
+parse_output(const string &arg, const string &fallback)
+{
+  size_t colon = arg.find(':');
+
+  if (colon == 1 &&
+      (isupper(static_cast<unsigned char>(arg[0])) ||
+       (arg.size() > 2 && (arg[2] == '\\' || arg[2] == '/')))) {
+    return OutputSpec { fallback, arg };
+  }
+
+  if (colon != string::npos) {
+    string key(arg.substr(0, colon));
+
+    downcase(key);
+    if (FIND_TRANSFORM_BUILDER(key) != TRANSFORM_BUILDER_END()) {
+      return OutputSpec { key, arg.substr(colon + 1) };
+    }
+  }
+
+  return OutputSpec { fallback, arg };
+}
+
+/*
+ * The path an output ends up at, so that `v.h' and `./v.h' compare
+ * equal.  Standard output is the empty string.
+ */
+static
+string
+output_path(const string &filename)
+{
+  error_code ec;
+  fs::path   path;
+
+  if (filename.empty()) {
+    return filename;
+  }
+
+  path = fs::weakly_canonical(fs::absolute(filename, ec), ec);
+  if (ec) {
+    return filename;
+  }
+
+  return path.string();
+}
+
+static
+bool
+uses_transform(const Config &conf, const char *key)
+{
+  for (auto &it : conf.outputs) {
+    if (it.transform == key) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 static
 void
 generate_output(po::options_description &desc)
@@ -130,15 +257,52 @@ generate_output(po::options_description &desc)
   desc.add_options()
     ("create,c",
      (const char *)res_help_create)
+    ("update,u",
+     (const char *)res_help_update)
     ("groups,g",
      po::value<GroupsParser>()
        ->default_value(GroupsParser("basic"))
        ->value_name("groups"),
      (const char *)res_help_groups)
     ("output,o",
+     po::value<vector<string>>()
+       ->composing()
+       ->value_name("[transform:]file"),
+     (const char *)res_help_output);
+}
+
+static
+void
+generate_watch(po::options_description &desc)
+{
+  desc.add_options()
+    ("watch,w",
+     (const char *)res_help_watch)
+    ("watch-input",
+     po::value<vector<string>>()
+       ->composing()
+       ->value_name("path"),
+     (const char *)res_help_watch_input)
+    ("debounce",
+     po::value<unsigned>()
+       ->default_value(250)
+       ->value_name("ms"),
+     (const char *)res_help_debounce);
+}
+
+static
+void
+generate_history(po::options_description &desc)
+{
+  desc.add_options()
+    ("history",
      po::value<string>()
        ->value_name("file"),
-     (const char *)res_help_output);
+     (const char *)res_help_history)
+    ("component",
+     po::value<string>()
+       ->value_name("name"),
+     (const char *)res_help_component);
 }
 
 static
@@ -170,6 +334,8 @@ Opts::Opts()
   po::options_description general("General options");
   po::options_description debug("Debug options");
   po::options_description output("Output options");
+  po::options_description watch("Watch options");
+  po::options_description history("History options");
   po::options_description increment("Increment options");
   po::options_description transform("Transform options");
   po::options_description info("Information options");
@@ -177,6 +343,8 @@ Opts::Opts()
   generate_misc(general);
   generate_debug(debug);
   generate_output(output);
+  generate_watch(watch);
+  generate_history(history);
   generate_increment(increment);
   generate_transform(transform);
   generate_info(info);
@@ -185,6 +353,8 @@ Opts::Opts()
   desc_.add(increment);
   desc_.add(transform);
   desc_.add(output);
+  desc_.add(watch);
+  desc_.add(history);
   desc_.add(info);
   desc_.add(debug);
 }
@@ -259,6 +429,14 @@ Opts::parse(Config &conf, int argc, char **argv)
     exit(EXIT_FAILURE);
   }
 
+  if (vmap_.count("policy")) {
+    conf.policy.assign(vmap_["policy"].as<string>());
+    LSAY("Increment policy set to:", conf.policy);
+  } else if (conf.incr_type == IncrementType::Script) {
+    FATAL("The `script' increment type requires a policy.");
+    exit(EXIT_FAILURE);
+  }
+
   if (vmap_.count("year")) {
     int year = vmap_["year"].as<int>();
 
@@ -274,11 +452,43 @@ Opts::parse(Config &conf, int argc, char **argv)
     TransformParser transform = vmap_["transform"].as<TransformParser>();
     LSAY("Transform set to:", transform);
     conf.transform = transform.to_string();
+  }
+
+  if (vmap_.count("output")) {
+    for (auto &it : vmap_["output"].as<vector<string>>()) {
+      conf.outputs.push_back(parse_output(it, conf.transform));
+    }
   } else {
-    FATAL("No transform was specified.");
-    exit(EXIT_FAILURE);
+    conf.outputs.push_back(OutputSpec { conf.transform, "" });
   }
 
+  {
+    set<string> seen;
+
+    for (auto &it : conf.outputs) {
+      if (it.transform.empty()) {
+        FATAL("No transform was specified.");
+        exit(EXIT_FAILURE);
+      }
+
+      // Outputs are written concurrently, two to one file would race.
+      if (!seen.insert(output_path(it.filename)).second) {
+        FATAL("Output",
+              (it.filename.empty() ? "to standard output" : it.filename),
+              "is given more than once.");
+        exit(EXIT_FAILURE);
+      }
+
+      LSAY("Output:",
+           it.transform,
+           (it.filename.empty() ? "to standard output" : it.filename));
+    }
+  }
+
+  // The first output is the one read back, so it drives everything.
+  conf.transform.assign(conf.outputs.front().transform);
+  conf.filename.assign(conf.outputs.front().filename);
+
   if (vmap_.count("prefix")) {
     string tmp = vmap_["prefix"].as<string>();
 
@@ -289,6 +499,86 @@ Opts::parse(Config &conf, int argc, char **argv)
     }
   }
 
+  if (vmap_.count("if-changed")) {
+    conf.if_changed = vmap_["if-changed"].as<vector<string>>();
+
+    if (vmap_.count("digest-file")) {
+      conf.digest_file.assign(vmap_["digest-file"].as<string>());
+    } else if (!conf.filename.empty()) {
+      conf.digest_file.assign(conf.filename + DIGEST_SUFFIX);
+    } else {
+      FATAL("`--if-changed' needs `--digest-file' when writing to stdout.");
+      exit(EXIT_FAILURE);
+    }
+
+    LSAY("Digest file set to:", conf.digest_file);
+  }
+
+  if (vmap_.count("history")) {
+    conf.history.assign(vmap_["history"].as<string>());
+
+    if (vmap_.count("component")) {
+      conf.component.assign(vmap_["component"].as<string>());
+    } else if (!conf.filename.empty()) {
+      conf.component.assign(conf.filename);
+    } else {
+      FATAL("`--history' needs `--component' when writing to stdout.");
+      exit(EXIT_FAILURE);
+    }
+
+    LSAY("History set to:", conf.history, "for", conf.component);
+  }
+
+  if (vmap_.count("watch")) {
+    conf.watch          = true;
+    conf.watch_debounce = vmap_["debounce"].as<unsigned>();
+    LSAY("Watching for changes, debounce", conf.watch_debounce, "ms");
+
+    if (vmap_.count("watch-input")) {
+      conf.watch_inputs = vmap_["watch-input"].as<vector<string>>();
+    }
+  }
+
+  if (vmap_.count("scan-limit")) {
+    conf.scan_limit = vmap_["scan-limit"].as<uint64_t>() * 1024;
+    LSAY("Scan limit set to:", conf.scan_limit);
+  }
+
+  if (vmap_.count("template")) {
+    conf.template_file.assign(vmap_["template"].as<string>());
+    LSAY("Template set to:", conf.template_file);
+  } else if (uses_transform(conf, TEMPLATE_KEY)) {
+    FATAL("The `template' transform requires a template.");
+    exit(EXIT_FAILURE);
+  }
+
+  if (vmap_.count("script")) {
+    conf.script.assign(vmap_["script"].as<string>());
+    LSAY("Script set to:", conf.script);
+  } else if (uses_transform(conf, LUA_KEY)) {
+    FATAL("The `lua' transform requires a script.");
+    exit(EXIT_FAILURE);
+  }
+
+  if (vmap_.count("script-cache")) {
+    string tmp = vmap_["script-cache"].as<string>();
+
+    if (tmp != "none") {
+      conf.script_cache.assign(tmp);
+      LSAY("Script cache set to:", conf.script_cache);
+    }
+  }
+
+  if (vmap_.count("lua-memory")) {
+    conf.lua_memory_limit = vmap_["lua-memory"].as<size_t>() * 1024 * 1024;
+    LSAY("Lua memory limit set to:", conf.lua_memory_limit);
+  }
+
+  if (vmap_.count("lua-instructions")) {
+    conf.lua_instruction_limit = vmap_["lua-instructions"].as<uint64_t>();
+    LSAY("Lua instruction limit set to:", conf.lua_instruction_limit);
+  }
+
   if (vmap_.count("create")) {
     LSAY("Will create file if it does not exist.");
     conf.create = true;
@@ -297,13 +587,9 @@ Opts::parse(Config &conf, int argc, char **argv)
     conf.create = false;
   }
 
-  if (vmap_.count("output")) {
-    string tmp = vmap_["output"].as<string>();
-
-    if (tmp.length() > 0) {
-      conf.filename.assign(tmp);
-      LSAY("Output file set to:", conf.filename);
-    }
+  if (vmap_.count("update")) {
+    LSAY("Will update existing files in place.");
+    conf.update = true;
   }
 
   if (vmap_.count("groups")) {
@@ -313,17 +599,30 @@ Opts::parse(Config &conf, int argc, char **argv)
   }
 }
 
-__noreturn
+NORETURN
 Opts::show_help() const
 {
+  ListPairVector lpv;
+
   cout << "Usage: " << program_name << " [OPTION]...\n"
+       << "       " << program_name << " COMMAND [OPTION]...\n"
        << "Version number incrementing and build number tool.\n"
        << desc_ << endl;
 
+  for (auto it = COMMAND_BEGIN(); it != COMMAND_END(); it++) {
+    lpv.push_back(ListPair(it->first, it->second.summary));
+  }
+
+  if (!lpv.empty()) {
+    cout << "Commands:" << endl;
+    Console(&std::cout).write_pairs(lpv, 2);
+    cout << endl;
+  }
+
   exit(EXIT_FAILURE);
 }
 
-__noreturn
+NORETURN
 Opts::show_version() const
 {
   cout << "Verbuilld " << VERSION_STRING << endl
@@ -332,7 +631,7 @@ Opts::show_version() const
   exit(EXIT_SUCCESS);
 }
 
-__noreturn
+NORETURN
 Opts::show_list_transforms() const
 {
   ListPairVector lpv;
@@ -347,7 +646,7 @@ Opts::show_list_transforms() const
   exit(EXIT_SUCCESS);
 }
 
-__noreturn
+NORETURN
 Opts::show_list_increments() const
 {
   IncrTypeParser parser;
@@ -361,7 +660,7 @@ Opts::show_list_increments() const
   exit(EXIT_SUCCESS);
 }
 
-__noreturn
+NORETURN
 Opts::show_list_groups() const
 {
   GroupsParser parser;
@@ -0,0 +1,448 @@
+//
+// SemVer.cpp --- Semantic versions.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 09:27:13
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file SemVer.cpp
+ * @author Paul Ward
+ * @brief Semantic versions.
+ */
+
+#include "SemVer.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+using namespace std;
+
+static_assert(is_trivially_copyable<SemVer>::value,
+              "SemVer must be trivially copyable");
+
+static inline
+bool
+is_digit(char c)
+{
+  return static_cast<unsigned char>(c - '0') < 10;
+}
+
+static inline
+bool
+is_ident(char c)
+{
+  return is_digit(c) ||
+         static_cast<unsigned char>((c | 0x20) - 'a') < 26 ||
+         c == '-';
+}
+
+/*
+ * A numeric part: digits without a leading zero, fitting in 64 bits.
+ */
+static
+bool
+parse_number(const char *&p, const char *end, uint64_t &value)
+{
+  const char       *start = p;
+  from_chars_result res;
+
+  while (p < end && is_digit(*p)) {
+    p++;
+  }
+
+  if (p == start || (*start == '0' && p - start > 1)) {
+    return false;
+  }
+
+  res = from_chars(start, p, value);
+
+  return res.ec == errc();
+}
+
+/*
+ * Dotted identifiers up to `stop' or the end.  Prerelease identifiers
+ * that are all digits may not have leading zeros; build identifiers
+ * may.
+ */
+static
+bool
+parse_idents(const char *&p, const char *end, char stop, bool numeric_rule)
+{
+  for (;;) {
+    const char *start  = p;
+    bool        digits = true;
+
+    while (p < end && is_ident(*p)) {
+      digits = digits && is_digit(*p);
+      p++;
+    }
+
+    if (p == start) {
+      return false;
+    }
+
+    if (numeric_rule && digits && *start == '0' && p - start > 1) {
+      return false;
+    }
+
+    if (p == end || *p == stop) {
+      return true;
+    }
+
+    if (*p != '.') {
+      return false;
+    }
+
+    p++;
+  }
+}
+
+SemVerArena::SemVerArena()
+  : blocks_(),
+    cursor_(nullptr),
+    left_(0),
+    used_(0)
+{}
+
+SemVerArena::~SemVerArena()
+{}
+
+/**
+ * @brief Copy bytes into the arena.
+ * @returns A pointer that stays valid until @c clear or destruction.
+ */
+const char *
+SemVerArena::store(const char *data, size_t len)
+{
+  char *ptr;
+
+  if (len > left_) {
+    size_t size = max<size_t>(len, SEMVER_ARENA_BLOCK);
+
+    blocks_.emplace_back(new char[size]);
+    cursor_ = blocks_.back().get();
+    left_   = size;
+  }
+
+  ptr      = cursor_;
+  cursor_ += len;
+  left_   -= len;
+  used_   += len;
+
+  ::memcpy(ptr, data, len);
+
+  return ptr;
+}
+
+void
+SemVerArena::clear()
+{
+  blocks_.clear();
+  cursor_ = nullptr;
+  left_   = 0;
+  used_   = 0;
+}
+
+size_t
+SemVerArena::get_used() const
+{
+  return used_;
+}
+
+bool
+SemVer::is_prerelease() const
+{
+  return pre_len > 0;
+}
+
+string_view
+SemVer::get_prerelease() const
+{
+  return string_view(pre, pre_len);
+}
+
+string_view
+SemVer::get_build() const
+{
+  return string_view(build, build_len);
+}
+
+string
+SemVer::to_string() const
+{
+  string out;
+
+  out = std::to_string(major) + '.' +
+        std::to_string(minor) + '.' +
+        std::to_string(patch);
+
+  if (pre_len > 0) {
+    out += '-';
+    out.append(pre, pre_len);
+  }
+
+  if (build_len > 0) {
+    out += '+';
+    out.append(build, build_len);
+  }
+
+  return out;
+}
+
+/**
+ * @brief Parse a version, pointing into the text.
+ * @param text The version; it must outlive @c out.
+ * @param out Receives the version.
+ * @returns false if @c text is not a valid semantic version.
+ */
+bool
+SemVer::parse(string_view text, SemVer &out)
+{
+  const char *p   = text.data();
+  const char *end = p + text.size();
+  const char *mark;
+  SemVer      v   = { 0, 0, 0, nullptr, 0, 0, nullptr };
+
+  if (!parse_number(p, end, v.major) || p == end || *p++ != '.' ||
+      !parse_number(p, end, v.minor) || p == end || *p++ != '.' ||
+      !parse_number(p, end, v.patch)) {
+    return false;
+  }
+
+  if (p < end && *p == '-') {
+    mark = ++p;
+
+    if (!parse_idents(p, end, '+', true)) {
+      return false;
+    }
+
+    v.pre     = mark;
+    v.pre_len = static_cast<uint32_t>(p - mark);
+  }
+
+  if (p < end && *p == '+') {
+    mark = ++p;
+
+    if (!parse_idents(p, end, '\0', false)) {
+      return false;
+    }
+
+    v.build     = mark;
+    v.build_len = static_cast<uint32_t>(p - mark);
+  }
+
+  if (p != end) {
+    return false;
+  }
+
+  out = v;
+
+  return true;
+}
+
+/**
+ * @brief Parse a version, copying its identifiers into an arena.
+ */
+bool
+SemVer::parse(string_view text, SemVerArena &arena, SemVer &out)
+{
+  if (!parse(text, out)) {
+    return false;
+  }
+
+  if (out.pre_len > 0) {
+    out.pre = arena.store(out.pre, out.pre_len);
+  }
+
+  if (out.build_len > 0) {
+    out.build = arena.store(out.build, out.build_len);
+  }
+
+  return true;
+}
+
+static inline
+int
+compare_number(uint64_t a, uint64_t b)
+{
+  return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+/*
+ * Precedence of two prerelease strings, identifier by identifier.
+ * Numeric identifiers have no leading zeros, so the longer is the
+ * larger and equal lengths compare as text.
+ */
+static
+int
+compare_prerelease(const char *a, size_t alen, const char *b, size_t blen)
+{
+  const char *aend = a + alen;
+  const char *bend = b + blen;
+
+  for (;;) {
+    const char *as;
+    const char *bs;
+    bool        anum = true;
+    bool        bnum = true;
+    int         cmp;
+
+    if (a == aend || b == bend) {
+      return (a == aend) ? ((b == bend) ? 0 : -1) : 1;
+    }
+
+    for (as = a; a < aend && *a != '.'; a++) {
+      anum = anum && is_digit(*a);
+    }
+
+    for (bs = b; b < bend && *b != '.'; b++) {
+      bnum = bnum && is_digit(*b);
+    }
+
+    if (anum != bnum) {
+      return anum ? -1 : 1;
+    }
+
+    if (anum && (a - as) != (b - bs)) {
+      return ((a - as) < (b - bs)) ? -1 : 1;
+    }
+
+    cmp = ::memcmp(as, bs, static_cast<size_t>(min(a - as, b - bs)));
+
+    if (cmp == 0 && (a - as) != (b - bs)) {
+      cmp = ((a - as) < (b - bs)) ? -1 : 1;
+    }
+
+    if (cmp != 0) {
+      return (cmp < 0) ? -1 : 1;
+    }
+
+    // Step over the dots.
+    a += (a < aend);
+    b += (b < bend);
+  }
+}
+
+/**
+ * @brief Compare precedence.
+ * @returns Less than, equal to or greater than zero.
+ *
+ * Build metadata does not count, and a prerelease comes before the
+ * release it leads to.
+ */
+int
+compare_semver(const SemVer &a, const SemVer &b)
+{
+  int cmp;
+
+  if ((cmp = compare_number(a.major, b.major)) != 0 ||
+      (cmp = compare_number(a.minor, b.minor)) != 0 ||
+      (cmp = compare_number(a.patch, b.patch)) != 0) {
+    return cmp;
+  }
+
+  if (a.pre_len == 0 || b.pre_len == 0) {
+    return (a.pre_len == 0) ? ((b.pre_len == 0) ? 0 : 1) : -1;
+  }
+
+  return compare_prerelease(a.pre, a.pre_len, b.pre, b.pre_len);
+}
+
+/**
+ * @brief Order by precedence.
+ */
+bool
+operator<(const SemVer &a, const SemVer &b)
+{
+  return compare_semver(a, b) < 0;
+}
+
+/**
+ * @brief Identical versions, build metadata included.
+ */
+bool
+operator==(const SemVer &a, const SemVer &b)
+{
+  return compare_semver(a, b) == 0 &&
+         a.get_build() == b.get_build();
+}
+
+bool
+operator!=(const SemVer &a, const SemVer &b)
+{
+  return !(a == b);
+}
+
+std::ostream &
+operator<<(std::ostream &os, const SemVer &v)
+{
+  os << v.to_string();
+
+  return os;
+}
+
+/**
+ * @brief Parse many versions into one arena.
+ * @param texts The versions.
+ * @param arena Receives their identifiers.
+ * @param out Has each valid version appended.
+ * @returns The number of texts that were not valid.
+ */
+size_t
+parse_semvers(const vector<string_view> &texts,
+              SemVerArena               &arena,
+              SemVerVector              &out)
+{
+  size_t failed = 0;
+  SemVer v;
+
+  out.reserve(out.size() + texts.size());
+
+  for (auto &it : texts) {
+    if (SemVer::parse(it, arena, v)) {
+      out.push_back(v);
+    } else {
+      failed++;
+    }
+  }
+
+  return failed;
+}
+
+/**
+ * @brief Sort by precedence; versions of equal precedence keep their
+ *        order.
+ */
+void
+sort_semvers(SemVer *versions, size_t count)
+{
+  stable_sort(versions, versions + count);
+}
+
+// SemVer.cpp ends here.
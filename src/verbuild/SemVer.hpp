@@ -0,0 +1,120 @@
+//
+// SemVer.hpp --- Semantic versions.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 09:18:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file SemVer.hpp
+ * @author Paul Ward
+ * @brief Semantic versions.
+ *
+ * Parses and orders versions as Semantic Versioning 2.0.0 defines
+ * them: `MAJOR.MINOR.PATCH', an optional `-' and dotted prerelease
+ * identifiers, and optional `+' and dotted build metadata.
+ *
+ * A parsed version holds its identifiers as pointers and lengths.
+ * They point either into the parsed text, or into a @c SemVerArena
+ * that copies them into large shared blocks, so parsing a batch does
+ * not allocate per version.  Either way the storage must outlive the
+ * versions.
+ */
+
+#pragma once
+#ifndef _SemVer_hpp_
+#define _SemVer_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @def SEMVER_ARENA_BLOCK
+ * @brief Size of each block a @c SemVerArena copies identifiers into.
+ */
+#define SEMVER_ARENA_BLOCK (64 * 1024)
+
+class SemVerArena
+{
+private:
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char                                *cursor_;
+  std::size_t                          left_;
+  std::size_t                          used_;
+
+public:
+  SemVerArena();
+  SemVerArena(const SemVerArena &) = delete;
+  ~SemVerArena();
+
+  const char *store(const char *, std::size_t);
+  void        clear();
+  std::size_t get_used() const;
+};
+
+struct SemVer
+{
+  std::uint64_t major;
+  std::uint64_t minor;
+  std::uint64_t patch;
+  const char   *pre;            // Prerelease, without the `-'.
+  std::uint32_t pre_len;
+  std::uint32_t build_len;
+  const char   *build;          // Build metadata, without the `+'.
+
+  bool             is_prerelease() const;
+  std::string_view get_prerelease() const;
+  std::string_view get_build() const;
+  std::string      to_string() const;
+
+  static bool parse(std::string_view, SemVer &);
+  static bool parse(std::string_view, SemVerArena &, SemVer &);
+};
+
+typedef std::vector<SemVer> SemVerVector;
+
+int  compare_semver(const SemVer &, const SemVer &);
+bool operator<(const SemVer &, const SemVer &);
+bool operator==(const SemVer &, const SemVer &);
+bool operator!=(const SemVer &, const SemVer &);
+
+std::ostream &operator<<(std::ostream &, const SemVer &);
+
+std::size_t parse_semvers(const std::vector<std::string_view> &,
+                          SemVerArena &,
+                          SemVerVector &);
+void        sort_semvers(SemVer *, std::size_t);
+
+#endif // !_SemVer_hpp_
+
+// SemVer.hpp ends here.
@@ -0,0 +1,570 @@
+//
+// Template.cpp --- Compiled output templates.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 15:57:31
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Template.cpp
+ * @author Paul Ward
+ * @brief Compiled output templates.
+ */
+
+#include "Template.hpp"
+#include "Utils.hpp"
+#include "version.hpp"
+
+#include <charconv>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+using namespace std;
+
+#define FIELD_COUNT static_cast<size_t>(TemplateField::Count)
+
+static const char *field_names[FIELD_COUNT] = {
+  "major",
+  "minor",
+  "build",
+  "patch",
+  "base_year",
+  "version",
+  "prefix",
+  "PREFIX",
+  "filename",
+  "date",
+  "time",
+  "verbuild_version"
+};
+
+static inline
+bool
+is_numeric(TemplateField field)
+{
+  return field <= TemplateField::BaseYear;
+}
+
+static
+void
+compile_error(const string &source, size_t offset, const string &what)
+{
+  stringstream ss;
+  size_t       line = 1;
+
+  for (size_t i = 0; i < offset && i < source.size(); i++) {
+    line += (source[i] == '\n');
+  }
+
+  ss << "Template line " << line << ": " << what;
+  throw runtime_error(ss.str());
+}
+
+static
+unsigned char
+lookup_group(const string &source, size_t offset, const string &name)
+{
+  if (name == "basic") {
+    return static_cast<unsigned char>(OutputGroups::Basic);
+  }
+
+  if (name == "struct") {
+    return static_cast<unsigned char>(OutputGroups::Struct);
+  }
+
+  if (name == "doxygen") {
+    return static_cast<unsigned char>(OutputGroups::Doxygen);
+  }
+
+  if (name == "cxx17") {
+    return static_cast<unsigned char>(OutputGroups::Cxx17);
+  }
+
+  compile_error(source, offset, "unknown group `" + name + "'");
+  return 0;
+}
+
+static
+unsigned char
+lookup_field(const string &source, size_t offset, const string &name)
+{
+  TemplateField field;
+
+  if (find_template_field(name, field)) {
+    return static_cast<unsigned char>(field);
+  }
+
+  compile_error(source, offset, "unknown field `" + name + "'");
+  return 0;
+}
+
+static
+string
+format_date(const VersionInfo &vi)
+{
+  stringstream ss;
+
+  ss << vi.to_date();
+
+  return ss.str();
+}
+
+static
+void
+format_clock(time_t now, char *clock, size_t len)
+{
+  struct tm tm;
+
+  // Outputs may render concurrently, so use the reentrant localtime.
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  localtime_s(&tm, &now);
+#else
+  localtime_r(&now, &tm);
+#endif
+  strftime(clock, len, "%H:%M:%S", &tm);
+}
+
+/*
+ * Walk the ops that apply to the given groups, calling `fn' for each
+ * literal and field.  Both render passes and `match' share this, so
+ * they always agree on which ops are live.
+ */
+template <typename Fn>
+static inline
+void
+walk(const vector<TemplateOp> &ops, OutputGroups groups, Fn fn)
+{
+  unsigned char bits = static_cast<unsigned char>(groups);
+  size_t        i    = 0;
+
+  while (i < ops.size()) {
+    const TemplateOp &op = ops[i];
+
+    switch (op.kind) {
+      case TemplateOp::SkipUnless:
+        i = ((bits & op.arg) == op.arg) ? i + 1 : op.offset;
+        break;
+
+      case TemplateOp::SkipIf:
+        i = ((bits & op.arg) == op.arg) ? op.offset : i + 1;
+        break;
+
+      default:
+        fn(op);
+        i++;
+        break;
+    }
+  }
+}
+
+Template::Template()
+{}
+
+Template::Template(const string &source)
+{
+  compile(source);
+}
+
+Template::~Template()
+{}
+
+/**
+ * @brief Compile template source into the op list.
+ * @throws runtime_error on a malformed template.
+ */
+void
+Template::compile(const string &source)
+{
+  vector<pair<size_t, string>> open;
+  string                       pending;
+  size_t                       pos = 0;
+
+  literals_.clear();
+  ops_.clear();
+
+  auto flush = [&]() {
+    if (!pending.empty()) {
+      TemplateOp op = { TemplateOp::Literal,
+                        0,
+                        static_cast<uint32_t>(literals_.size()),
+                        static_cast<uint32_t>(pending.size()) };
+
+      literals_.append(pending);
+      ops_.push_back(op);
+      pending.clear();
+    }
+  };
+
+  while (pos < source.size()) {
+    size_t tag = source.find("{{", pos);
+    size_t close;
+    size_t next;
+    string name;
+    char   sigil;
+
+    if (tag == string::npos) {
+      pending.append(source, pos, string::npos);
+      break;
+    }
+
+    close = source.find("}}", tag + 2);
+    if (close == string::npos) {
+      compile_error(source, tag, "unterminated tag");
+    }
+
+    name  = trim_copy(source.substr(tag + 2, close - tag - 2));
+    next  = close + 2;
+    sigil = name.empty() ? '\0' : name[0];
+
+    if (sigil == '#' || sigil == '^' || sigil == '/' || sigil == '!') {
+      size_t bol = source.rfind('\n', tag == 0 ? 0 : tag - 1);
+      size_t eol = source.find('\n', next);
+
+      bol = (bol == string::npos || tag == 0) ? 0 : bol + 1;
+      if (eol == string::npos) {
+        eol = source.size();
+      }
+
+      // A tag alone on its line takes the line with it.
+      if (bol >= pos &&
+          source.find_first_not_of(" \t", bol) == tag &&
+          (next == eol || source.find_first_not_of(" \t\r", next) >= eol)) {
+        pending.append(source, pos, bol - pos);
+        next = (eol < source.size()) ? eol + 1 : eol;
+      } else {
+        pending.append(source, pos, tag - pos);
+      }
+
+      name = trim_copy(name.substr(1));
+    } else {
+      pending.append(source, pos, tag - pos);
+    }
+
+    pos = next;
+
+    switch (sigil) {
+      case '!':
+        break;
+
+      case '#':
+      case '^': {
+        TemplateOp op = { (sigil == '#')
+                            ? TemplateOp::SkipUnless
+                            : TemplateOp::SkipIf,
+                          lookup_group(source, tag, name),
+                          0,
+                          0 };
+
+        flush();
+        open.push_back(make_pair(ops_.size(), name));
+        ops_.push_back(op);
+        break;
+      }
+
+      case '/':
+        if (open.empty() || open.back().second != name) {
+          compile_error(source, tag, "unexpected close of `" + name + "'");
+        }
+
+        flush();
+        ops_[open.back().first].offset = static_cast<uint32_t>(ops_.size());
+        open.pop_back();
+        break;
+
+      default: {
+        TemplateOp op = { TemplateOp::Field,
+                          lookup_field(source, tag, name),
+                          0,
+                          0 };
+
+        flush();
+        ops_.push_back(op);
+        break;
+      }
+    }
+  }
+
+  if (!open.empty()) {
+    compile_error(source,
+                  source.size(),
+                  "section `" + open.back().second + "' is not closed");
+  }
+
+  flush();
+}
+
+const vector<TemplateOp> &
+Template::get_ops() const
+{
+  return ops_;
+}
+
+string
+Template::render(const VersionInfo &vi, const Config &conf) const
+{
+  return render(vi, conf, time(nullptr));
+}
+
+/**
+ * @brief Render the template.
+ * @param vi Version to render.
+ * @param conf Supplies the groups, prefix and file name.
+ * @param now Time used for the `time' field.
+ *
+ * Field values are formatted once up front.  A first pass over the op
+ * list sums their sizes, and a second pass copies into a buffer of
+ * exactly that size.
+ */
+string
+Template::render(const VersionInfo &vi, const Config &conf, time_t now) const
+{
+  string_view  values[FIELD_COUNT];
+  char         numbers[5][12];
+  char         clock[16] = { 0 };
+  string       upper(conf.prefix);
+  string       version(vi.to_string());
+  string       date;
+  size_t       size = 0;
+  string       out;
+  char        *dst;
+
+  const uint32_t nums[5] = {
+    vi.get_major(),
+    vi.get_minor(),
+    vi.get_build(),
+    vi.get_patch(),
+    vi.get_base_year()
+  };
+
+  for (size_t i = 0; i < 5; i++) {
+    char *end = to_chars(numbers[i], numbers[i] + sizeof(numbers[i]),
+                         nums[i]).ptr;
+
+    values[i] = string_view(numbers[i], end - numbers[i]);
+  }
+
+  date = format_date(vi);
+  format_clock(now, clock, sizeof(clock));
+  upcase(upper);
+
+  values[static_cast<size_t>(TemplateField::Version)]         = version;
+  values[static_cast<size_t>(TemplateField::Prefix)]          = conf.prefix;
+  values[static_cast<size_t>(TemplateField::PrefixUpper)]     = upper;
+  values[static_cast<size_t>(TemplateField::Filename)]        = conf.filename;
+  values[static_cast<size_t>(TemplateField::Date)]            = date;
+  values[static_cast<size_t>(TemplateField::Time)]            = clock;
+  values[static_cast<size_t>(TemplateField::VerbuildVersion)] = VERSION_STRING;
+
+  walk(ops_, conf.groups, [&](const TemplateOp &op) {
+    size += (op.kind == TemplateOp::Literal) ? op.length
+                                             : values[op.arg].size();
+  });
+
+  out.resize(size);
+  dst = &out[0];
+
+  walk(ops_, conf.groups, [&](const TemplateOp &op) {
+    if (op.kind == TemplateOp::Literal) {
+      memcpy(dst, literals_.data() + op.offset, op.length);
+      dst += op.length;
+    } else {
+      memcpy(dst, values[op.arg].data(), values[op.arg].size());
+      dst += values[op.arg].size();
+    }
+  });
+
+  return out;
+}
+
+/**
+ * @brief Recover a version from text previously rendered by this template.
+ * @returns true if the text matched; on false @c vi is left untouched.
+ *
+ * Literals must match exactly.  Numeric fields are parsed; other
+ * fields are skipped up to the next literal.
+ */
+bool
+Template::match(const string &text, const Config &conf, VersionInfo &vi) const
+{
+  vector<const TemplateOp *> live;
+  uint32_t                   nums[5] = { 0 };
+  bool                       seen[5] = { false };
+  size_t                     pos     = 0;
+
+  trace(conf.groups, live);
+
+  for (size_t i = 0; i < live.size(); i++) {
+    const TemplateOp *op = live[i];
+
+    if (op->kind == TemplateOp::Literal) {
+      if (text.compare(pos, op->length, literals_, op->offset, op->length)) {
+        return false;
+      }
+
+      pos += op->length;
+    } else if (is_numeric(static_cast<TemplateField>(op->arg))) {
+      const char *end = text.data() + text.size();
+      auto        res = from_chars(text.data() + pos, end, nums[op->arg]);
+
+      if (res.ec != errc()) {
+        return false;
+      }
+
+      seen[op->arg] = true;
+      pos           = res.ptr - text.data();
+    } else {
+      size_t next = text.size();
+
+      for (size_t j = i + 1; j < live.size(); j++) {
+        if (live[j]->kind == TemplateOp::Literal) {
+          next = text.find(literals_.data() + live[j]->offset,
+                           pos,
+                           live[j]->length);
+          break;
+        }
+      }
+
+      if (next == string::npos) {
+        return false;
+      }
+
+      pos = next;
+    }
+  }
+
+  if (seen[0]) {
+    vi.set_major(nums[0]);
+  }
+
+  if (seen[1]) {
+    vi.set_minor(nums[1]);
+  }
+
+  if (seen[2]) {
+    vi.set_build(nums[2]);
+  }
+
+  if (seen[3]) {
+    vi.set_patch(nums[3]);
+  }
+
+  if (seen[4]) {
+    vi.set_base_year(nums[4]);
+  }
+
+  return true;
+}
+
+void
+Template::trace(OutputGroups groups, vector<const TemplateOp *> &live) const
+{
+  walk(ops_, groups, [&](const TemplateOp &op) {
+    live.push_back(&op);
+  });
+}
+
+/**
+ * @brief Look up a field by the name used in templates.
+ * @returns false if there is no such field.
+ */
+bool
+find_template_field(const string &name, TemplateField &field)
+{
+  for (size_t i = 0; i < FIELD_COUNT; i++) {
+    if (name == field_names[i]) {
+      field = static_cast<TemplateField>(i);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Format a single field as @c render would.
+ *
+ * Lets a transform that edits a file in place produce the same text
+ * as a full render.
+ */
+string
+format_field(TemplateField      field,
+             const VersionInfo &vi,
+             const Config      &conf,
+             time_t             now)
+{
+  char clock[16] = { 0 };
+
+  switch (field) {
+    case TemplateField::Major:
+      return to_string(vi.get_major());
+
+    case TemplateField::Minor:
+      return to_string(vi.get_minor());
+
+    case TemplateField::Build:
+      return to_string(vi.get_build());
+
+    case TemplateField::Patch:
+      return to_string(vi.get_patch());
+
+    case TemplateField::BaseYear:
+      return to_string(vi.get_base_year());
+
+    case TemplateField::Version:
+      return vi.to_string();
+
+    case TemplateField::Prefix:
+      return conf.prefix;
+
+    case TemplateField::PrefixUpper: {
+      string upper(conf.prefix);
+
+      upcase(upper);
+      return upper;
+    }
+
+    case TemplateField::Filename:
+      return conf.filename;
+
+    case TemplateField::Date:
+      return format_date(vi);
+
+    case TemplateField::Time:
+      format_clock(now, clock, sizeof(clock));
+      return clock;
+
+    case TemplateField::VerbuildVersion:
+      return VERSION_STRING;
+
+    default:
+      break;
+  }
+
+  return "";
+}
+
+// Template.cpp ends here.
@@ -0,0 +1,129 @@
+//
+// Template.hpp --- Compiled output templates.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 15:48:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Template.hpp
+ * @author Paul Ward
+ * @brief Compiled output templates.
+ *
+ * Template syntax:
+ *
+ *   {{name}}                  -- a field, see below.
+ *   {{#group}} ... {{/group}} -- kept only when @c group is selected.
+ *   {{^group}} ... {{/group}} -- kept only when @c group is not selected.
+ *   {{! text }}               -- a comment.
+ *
+ * Fields are major, minor, build, patch, base_year, version, prefix,
+ * PREFIX (the prefix in upper case), filename, date, time and
+ * verbuild_version.  Groups are basic, struct, doxygen and cxx17.  A
+ * section or comment tag alone on its line removes the whole line.
+ *
+ * A template is compiled once into a flat list of operations.
+ * Sections become forward jumps, so rendering needs neither recursion
+ * nor a tree.
+ */
+
+#pragma once
+#ifndef _Template_hpp_
+#define _Template_hpp_
+
+#include "Support.hpp"
+#include "Enums.hpp"
+#include "Config.hpp"
+#include "VersionInfo.hpp"
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+enum class TemplateField : unsigned char {
+  Major = 0,
+  Minor,
+  Build,
+  Patch,
+  BaseYear,
+  Version,
+  Prefix,
+  PrefixUpper,
+  Filename,
+  Date,
+  Time,
+  VerbuildVersion,
+  Count
+};
+
+struct TemplateOp
+{
+  enum Kind : unsigned char {
+    Literal,                    // Copy literal text.
+    Field,                      // Copy a field value.
+    SkipUnless,                 // Jump unless the groups are selected.
+    SkipIf                      // Jump if the groups are selected.
+  };
+
+  Kind          kind;
+  unsigned char arg;            // Field or group bits.
+  std::uint32_t offset;         // Literal offset or jump target.
+  std::uint32_t length;         // Literal length.
+};
+
+class Template
+{
+private:
+  std::string             literals_;
+  std::vector<TemplateOp> ops_;
+
+public:
+  Template();
+  Template(const std::string &);
+  ~Template();
+
+  void compile(const std::string &);
+
+  const std::vector<TemplateOp> &get_ops() const;
+
+  std::string render(const VersionInfo &, const Config &) const;
+  std::string render(const VersionInfo &, const Config &, std::time_t) const;
+
+  bool match(const std::string &, const Config &, VersionInfo &) const;
+
+private:
+  void trace(OutputGroups, std::vector<const TemplateOp *> &) const;
+};
+
+bool        find_template_field(const std::string &, TemplateField &);
+std::string format_field(TemplateField,
+                         const VersionInfo &,
+                         const Config &,
+                         std::time_t);
+
+#endif // !_Template_hpp_
+
+// Template.hpp ends here.
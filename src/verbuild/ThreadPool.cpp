@@ -0,0 +1,216 @@
+//
+// ThreadPool.cpp --- Work-stealing thread pool.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 03:31:55
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file ThreadPool.cpp
+ * @author Paul Ward
+ * @brief Work-stealing thread pool.
+ */
+
+#include "ThreadPool.hpp"
+#include "Console.hpp"
+
+#include <algorithm>
+#include <exception>
+
+using namespace std;
+
+// The pool and queue of the worker running on this thread, if any.
+static thread_local ThreadPool *current_pool  = nullptr;
+static thread_local size_t      current_queue = 0;
+
+/**
+ * @brief Start the workers.
+ * @param threads Number of workers; 0 for one per hardware thread.
+ */
+ThreadPool::ThreadPool(unsigned threads)
+  : queues_(),
+    threads_(),
+    queued_(0),
+    pending_(0),
+    next_(0),
+    stop_(false),
+    steals_(0)
+{
+  if (threads == 0) {
+    threads = max(1u, thread::hardware_concurrency());
+  }
+
+  for (unsigned i = 0; i < threads; i++) {
+    queues_.emplace_back(new Queue());
+  }
+
+  for (unsigned i = 0; i < threads; i++) {
+    threads_.emplace_back(&ThreadPool::run, this, i);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    lock_guard<mutex> guard(lock_);
+
+    stop_ = true;
+  }
+
+  work_.notify_all();
+
+  for (auto &it : threads_) {
+    it.join();
+  }
+}
+
+unsigned
+ThreadPool::get_thread_count() const
+{
+  return static_cast<unsigned>(threads_.size());
+}
+
+size_t
+ThreadPool::get_steal_count() const
+{
+  return steals_.load();
+}
+
+/**
+ * @brief Queue a task.
+ *
+ * From one of the pool's own tasks, the task goes on the calling
+ * worker's queue; otherwise the queues are used in turn.
+ */
+void
+ThreadPool::submit(Task task)
+{
+  size_t queue;
+
+  // Counted first, so a worker can never take it before it is counted.
+  {
+    lock_guard<mutex> guard(lock_);
+
+    pending_++;
+    queued_++;
+    queue = (current_pool == this) ? current_queue
+                                   : next_++ % queues_.size();
+  }
+
+  {
+    lock_guard<mutex> guard(queues_[queue]->lock);
+
+    queues_[queue]->tasks.push_back(move(task));
+  }
+
+  work_.notify_one();
+}
+
+/**
+ * @brief Block until every submitted task, and every task they
+ *        submitted, has finished.  Not to be called from a task.
+ */
+void
+ThreadPool::wait()
+{
+  unique_lock<mutex> guard(lock_);
+
+  idle_.wait(guard, [this]() { return pending_ == 0; });
+}
+
+/*
+ * Newest task from our own queue, else the oldest from another's.
+ */
+bool
+ThreadPool::take(size_t self, Task &task)
+{
+  size_t count = queues_.size();
+
+  for (size_t i = 0; i < count; i++) {
+    Queue            &queue = *queues_[(self + i) % count];
+    lock_guard<mutex> guard(queue.lock);
+
+    if (queue.tasks.empty()) {
+      continue;
+    }
+
+    if (i == 0) {
+      task = move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = move(queue.tasks.front());
+      queue.tasks.pop_front();
+      steals_++;
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+void
+ThreadPool::run(size_t self)
+{
+  current_pool  = this;
+  current_queue = self;
+
+  for (;;) {
+    Task task;
+
+    if (take(self, task)) {
+      {
+        lock_guard<mutex> guard(lock_);
+
+        queued_--;
+      }
+
+      try {
+        task();
+      }
+      catch (exception &e) {
+        ESAY("Task failed:", e.what());
+      }
+
+      lock_guard<mutex> guard(lock_);
+
+      if (--pending_ == 0) {
+        idle_.notify_all();
+      }
+
+      continue;
+    }
+
+    unique_lock<mutex> guard(lock_);
+
+    work_.wait(guard, [this]() { return stop_ || queued_ > 0; });
+
+    if (stop_ && queued_ == 0) {
+      return;
+    }
+  }
+}
+
+// ThreadPool.cpp ends here.
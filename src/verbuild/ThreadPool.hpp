@@ -0,0 +1,99 @@
+//
+// ThreadPool.hpp --- Work-stealing thread pool.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 03:24:18
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file ThreadPool.hpp
+ * @author Paul Ward
+ * @brief Work-stealing thread pool.
+ *
+ * Each worker owns a deque of tasks.  A task submitted from a worker
+ * goes on that worker's own deque, which it drains from the back, so
+ * work spawned by a task (such as the subdirectories of a directory)
+ * stays on the thread whose caches already hold its parent.  A worker
+ * whose deque is empty steals the oldest task from the front of
+ * another's, which for tree-shaped work tends to be the largest.
+ */
+
+#pragma once
+#ifndef _ThreadPool_hpp_
+#define _ThreadPool_hpp_
+
+#include "Support.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+  typedef std::function<void()> Task;
+
+private:
+  struct Queue {
+    std::mutex       lock;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread>            threads_;
+  std::mutex                          lock_;
+  std::condition_variable             work_;
+  std::condition_variable             idle_;
+  std::size_t                         queued_;
+  std::size_t                         pending_;
+  std::size_t                         next_;
+  bool                                stop_;
+  std::atomic<std::size_t>            steals_;
+
+public:
+  ThreadPool(unsigned = 0);
+  ThreadPool(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  void submit(Task);
+  void wait();
+
+  unsigned    get_thread_count() const;
+  std::size_t get_steal_count() const;
+
+private:
+  void run(std::size_t);
+  bool take(std::size_t, Task &);
+};
+
+#endif // !_ThreadPool_hpp_
+
+// ThreadPool.hpp ends here.
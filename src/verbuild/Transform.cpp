@@ -34,12 +34,17 @@
  */
 
 #include "Transform.hpp"
+#include "Utils.hpp"
 
+#include <filesystem>
+#include <system_error>
 #include <utility>
 
 using namespace std;
+namespace       fs = std::filesystem;
 
 Transform::Transform()
+  : binary_(false)
 {}
 
 Transform::~Transform()
@@ -63,6 +68,20 @@ Transform::set_config(Config &config)
   conf_ = config;
 }
 
+/**
+ * @brief Point this transform at one of several outputs.
+ */
+void
+Transform::set_filename(const string &filename)
+{
+  conf_.filename = filename;
+}
+
+/**
+ * @brief Read the version from the output file.
+ * @returns false if the file cannot be opened or does not hold a
+ *          version; see @c exists to tell the two apart.
+ */
 bool
 Transform::read(VersionInfo &vi)
 {
@@ -70,7 +89,7 @@ Transform::read(VersionInfo &vi)
     return false;
   }
 
-  ifstream strm(conf_.filename);
+  ifstream strm(conf_.filename, binary_ ? ios::in | ios::binary : ios::in);
 
   // If "STDOUT!" is ever printed, we dun gun gufed.
   DSAY(DEBUG_MEDIUM,
@@ -78,33 +97,73 @@ Transform::read(VersionInfo &vi)
        (conf_.filename.empty() ? "STDOUT!" : conf_.filename));
 
   if (strm.good()) {
-    string buffer;
-
     DSAY(DEBUG_HIGH, "File exists.");
 
-    strm.seekg(0, ios::end);
-    buffer.reserve(strm.tellg());
-    strm.seekg(0, ios::beg);
+    return read_stream(vi, strm);
+  }
 
-    buffer.assign((istreambuf_iterator<char>(strm)),
-                   istreambuf_iterator<char>());
-    strm.close();
+  return false;
+}
 
-    read_impl(vi, buffer);
+/**
+ * @brief Whether the output file exists and is not empty.
+ *
+ * An empty file is treated like a missing one, so that `-c' can fill
+ * in a file created by touch or by the build system.
+ */
+bool
+Transform::exists() const
+{
+  error_code ec;
 
-    return true;
-  }
+  return !conf_.filename.empty() &&
+         fs::file_size(conf_.filename, ec) > 0 &&
+         !ec;
+}
 
-  return false;
+/**
+ * @brief Read the whole file and hand it to @c read_impl.
+ *
+ * Transforms that can stop early override this instead.
+ */
+bool
+Transform::read_stream(VersionInfo &vi, istream &strm)
+{
+  string buffer;
+
+  strm.seekg(0, ios::end);
+  buffer.reserve(strm.tellg());
+  strm.seekg(0, ios::beg);
+
+  buffer.assign((istreambuf_iterator<char>(strm)),
+                 istreambuf_iterator<char>());
+
+  return read_impl(vi, buffer);
 }
 
 bool
 Transform::write(VersionInfo &vi)
 {
-  ofstream strm;
-  
+  ofstream     strm;
+  stringstream buffer;
+
+  if (conf_.update && !conf_.filename.empty()) {
+    DSAY(DEBUG_MEDIUM, "Attempting in-place update of", conf_.filename);
+
+    if (update_impl(vi)) {
+      return true;
+    }
+
+    DSAY(DEBUG_MEDIUM, "Falling back to a full write.");
+  }
+
+  // Render before opening, so a failing transform leaves the file alone.
+  if (!write_impl(vi, buffer)) {
+    return false;
+  }
+
   if (conf_.filename.length() > 0) {
-    strm.open(conf_.filename);
+    strm.open(conf_.filename, binary_ ? ios::out | ios::binary : ios::out);
   } else {
     strm.basic_ios<char>::rdbuf(cout.rdbuf());
   }
@@ -115,9 +174,6 @@ Transform::write(VersionInfo &vi)
        (conf_.filename.empty() ? "STDOUT" : conf_.filename));
 
   if (strm.good()) {
-    stringstream buffer;
-    write_impl(vi, buffer);
-
     strm << buffer.rdbuf();
     strm.close();
 
@@ -139,6 +195,112 @@ Transform::write_impl(VersionInfo &, stringstream &)
   throw runtime_error("Not implemented");
 }
 
+/**
+ * @brief Rewrite only the version values of an existing file.
+ * @returns false if the file cannot be updated in place, in which case
+ *          it is written in full.
+ */
+bool
+Transform::update_impl(VersionInfo &)
+{
+  return false;
+}
+
+/**
+ * @brief Read the whole of the existing output file.
+ * @returns false, after reporting why, if there is no such file.
+ */
+bool
+Transform::load_existing(string &buffer) const
+{
+  ifstream file;
+
+  if (conf_.filename.empty()) {
+    ESAY("This transform edits an existing file, but none was given.");
+    return false;
+  }
+
+  file.open(conf_.filename, ios::binary);
+  if (!file.good()) {
+    ESAY("Cannot read", conf_.filename);
+    return false;
+  }
+
+  file.seekg(0, ios::end);
+  buffer.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0, ios::beg);
+  file.read(&buffer[0], buffer.size());
+
+  return true;
+}
+
+/**
+ * @brief Write the existing file with the edits from @c collect_edits.
+ *
+ * For transforms that change a few values in a file they do not own.
+ */
+bool
+Transform::write_edits(VersionInfo &vi, stringstream &strm)
+{
+  FileEditVector edits;
+  string         buffer;
+
+  if (!load_existing(buffer) || !collect_edits(vi, buffer, edits)) {
+    return false;
+  }
+
+  buffer = splice_edits(buffer, edits);
+  strm.write(buffer.data(), buffer.size());
+
+  return true;
+}
+
+/**
+ * @brief Apply the edits from @c collect_edits to the file in place.
+ */
+bool
+Transform::update_edits(VersionInfo &vi)
+{
+  FileEditor     editor;
+  FileEditVector edits;
+  string         buffer;
+  char           chunk[FILE_EDIT_CHUNK];
+  size_t         got;
+
+  if (!editor.open(conf_.filename)) {
+    return false;
+  }
+
+  buffer.reserve(editor.get_size());
+
+  while ((got = editor.read(chunk, sizeof(chunk))) > 0) {
+    buffer.append(chunk, got);
+  }
+
+  if (!collect_edits(vi, buffer, edits) || !editor.apply(edits)) {
+    return false;
+  }
+
+  DSAY(DEBUG_MEDIUM,
+       "Made",
+       edits.size(),
+       "edits with",
+       editor.get_written(),
+       "bytes written");
+
+  return true;
+}
+
+/**
+ * @brief Work out the edits that put @c vi into the existing file.
+ * @returns false if the file does not hold what the transform expects.
+ */
+bool
+Transform::collect_edits(VersionInfo &, const string &, FileEditVector &)
+{
+  throw runtime_error("Not implemented");
+}
+
 bool
 TransformFactory::register_transform(const std::string &key,
                                      const std::string &pretty,
@@ -230,4 +392,35 @@ get_transform_factory()
   return factory;
 }
 
+/**
+ * @brief Set a version field from a name/value pair found by a reader.
+ * @param vi Version to update.
+ * @param name Field name, e.g. `MAJOR' or `base_year'.
+ * @param value Decimal value.
+ * @returns false if the name is not a version field.
+ */
+bool
+set_version_field(VersionInfo &vi, string name, const string &value)
+{
+  upcase(name);
+
+  if (name == "MAJOR") {
+    vi.set_major(safe_stoi(value));
+  } else if (name == "MINOR") {
+    vi.set_minor(safe_stoi(value));
+  } else if (name == "BUILD") {
+    vi.set_build(safe_stoi(value));
+  } else if (name == "PATCH") {
+    vi.set_patch(safe_stoi(value));
+  } else if (name == "BASE_YEAR") {
+    vi.set_base_year(safe_stoi(value));
+  } else {
+    return false;
+  }
+
+  DSAY(DEBUG_HIGH, "Reading", name + ":", value);
+
+  return true;
+}
+
 // Transform.cpp ends here.
@@ -40,6 +40,7 @@
 #include "Enums.hpp"
 #include "VersionInfo.hpp"
 #include "Config.hpp"
+#include "FileEditor.hpp"
 
 #include <fstream>
 #include <sstream>
@@ -54,6 +55,7 @@ protected:
   std::string name_;
   std::string option_;
   Config      conf_;
+  bool        binary_;              // Output is not text.
 
 public:
   Transform();
@@ -63,13 +65,25 @@ public:
 
   const Config &get_config() const;
   void          set_config(Config &);
+  void          set_filename(const std::string &);
 
   bool read(VersionInfo &);
   bool write(VersionInfo &);
+  bool exists() const;
+
+protected:
+  bool load_existing(std::string &) const;
+  bool write_edits(VersionInfo &, std::stringstream &);
+  bool update_edits(VersionInfo &);
 
 private:
+  virtual bool read_stream(VersionInfo &, std::istream &);
   virtual bool read_impl(VersionInfo &, std::string &);
   virtual bool write_impl(VersionInfo &, std::stringstream &);
+  virtual bool update_impl(VersionInfo &);
+  virtual bool collect_edits(VersionInfo &,
+                             const std::string &,
+                             FileEditVector &);
 };
 
 class TransformFactory
@@ -108,6 +122,8 @@ Transform *create_transform() { return new DerivedT(); }
 
 TransformFactory &get_transform_factory();
 
+bool set_version_field(VersionInfo &, std::string, const std::string &);
+
 #define GET_TRANSFORM_CREATE(__k) get_transform_factory().build(__k)
 #define GET_TRANSFORM_PRETTY(__k) get_transform_factory().get_pretty(__k)
 
@@ -36,320 +36,383 @@
 #include "Transform_C.hpp"
 #include "Console.hpp"
 #include "Utils.hpp"
-#include "version.hpp"
+#include "Template.hpp"
+#include "CHeaderScanner.hpp"
+#include "FileEditor.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
-#include <regex>
-#include <cstdlib>
-#include <cstdio>
+#include <cstdint>
 #include <ctime>
 
-#include <boost/regex.hpp>
-
 using namespace std;
 
-#define VERSION_RE                              \
-  "(?:VERSION[_])(\\w+)(?:\\s+)(\\d+)"
-
-#define STRUCT_RE                                       \
-  "(?:[{]\\s*)(\\d+)(?:[,]\\s+)(\\d+)(?:[,]\\s+)(\\d+)" \
-  "(?:[,]\\s+)(\\d+)(?:[,]\\s+)(\\d+)(?:\\s*[}])"
+/*
+ * The header layout.  Compiled once, on first write.
+ *
+ * The cxx17 group builds its string from the numbers at compile time,
+ * so an in-place update only has to rewrite the initialiser.
+ */
+static const char c_template[] =
+  "/*\n"
+  " * ----------------------------------------------------\n"
+  " * Automatically generated by VerBuild {{verbuild_version}}.\n"
+  " * Do not edit by hand.\n"
+  " * ----------------------------------------------------\n"
+  " */\n\n"
+  "#pragma once\n\n"
+  "#ifndef __VersionInfo_Header__\n"
+  "#define __VersionInfo_Header__\n\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @file {{filename}}\n"
+  " * @author Verbuild {{verbuild_version}}\n"
+  " * @brief Provides version information.\n"
+  " */\n\n"
+  "{{/doxygen}}\n"
+  "{{#basic}}\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @def {{PREFIX}}VERSION_MAJOR\n"
+  " * @brief Major version number.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_MINOR\n"
+  " * @brief Minoir version number.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_BUILD\n"
+  " * @brief Build number.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_PPATCH\n"
+  " * @brief Patch number.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_BASE_YEAR\n"
+  " * @brief The year the project was started.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_DATE\n"
+  " * @brief The date this build was compiled.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_TIME\n"
+  " * @brief The time this build was compiled.\n"
+  " *\n"
+  " * @def {{PREFIX}}VERSION_STRING\n"
+  " * @brief String representation of the version.\n"
+  " */\n"
+  "{{/doxygen}}\n"
+  "#define {{PREFIX}}VERSION_MAJOR      {{major}}\n"
+  "#define {{PREFIX}}VERSION_MINOR      {{minor}}\n"
+  "#define {{PREFIX}}VERSION_BUILD      {{build}}\n"
+  "#define {{PREFIX}}VERSION_PATCH      {{patch}}\n\n"
+  "#define {{PREFIX}}VERSION_BASE_YEAR  {{base_year}}\n"
+  "#define {{PREFIX}}VERSION_DATE       \"{{date}}\"\n"
+  "#define {{PREFIX}}VERSION_TIME       \"{{time}}\"\n"
+  "#define {{PREFIX}}VERSION_STRING     \"{{version}}\"\n\n"
+  "{{/basic}}\n"
+  "{{#struct}}\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @Brief Version number structure.\n"
+  " *\n"
+  " * @var baseYear\n"
+  " * @brief The year the project was started.\n"
+  " *\n"
+  " * @var major\n"
+  " * @brief Major version number.\n"
+  " *\n"
+  " * @var minor\n"
+  " * @brief Minor version number.\n"
+  " *\n"
+  " * @var build\n"
+  " * @brief Build number.\n"
+  " *\n"
+  " * @var patch\n"
+  " * @brief Patch number.\n"
+  " */\n"
+  "{{/doxygen}}\n"
+  "static struct {{prefix}}VersionNumber_s {\n"
+  "    int baseYear;\n"
+  "    int major;\n"
+  "    int minor;\n"
+  "    int build;\n"
+  "    int patch;\n"
+  "} {{prefix}}VersionNumber = {\n"
+  "{{#basic}}\n"
+  "    {{PREFIX}}VERSION_BASE_YEAR,\n"
+  "    {{PREFIX}}VERSION_MAJOR,\n"
+  "    {{PREFIX}}VERSION_MINOR,\n"
+  "    {{PREFIX}}VERSION_BUILD,\n"
+  "    {{PREFIX}}VERSION_PATCH\n"
+  "{{/basic}}\n"
+  "{{^basic}}\n"
+  "    {{base_year}},\n"
+  "    {{major}},\n"
+  "    {{minor}},\n"
+  "    {{build}},\n"
+  "    {{patch}}\n"
+  "{{/basic}}\n"
+  "};\n\n"
+  "{{/struct}}\n"
+  "{{#cxx17}}\n"
+  "#if (defined(__cplusplus) && __cplusplus >= 201703L) || \\\n"
+  "    (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)\n\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @brief Version number structure.\n"
+  " *\n"
+  " * @var baseYear\n"
+  " * @brief The year the project was started.\n"
+  " *\n"
+  " * @var major\n"
+  " * @brief Major version number.\n"
+  " *\n"
+  " * @var minor\n"
+  " * @brief Minor version number.\n"
+  " *\n"
+  " * @var build\n"
+  " * @brief Build number.\n"
+  " *\n"
+  " * @var patch\n"
+  " * @brief Patch number.\n"
+  " */\n"
+  "{{/doxygen}}\n"
+  "struct {{prefix}}Version_t {\n"
+  "    unsigned int baseYear;\n"
+  "    unsigned int major;\n"
+  "    unsigned int minor;\n"
+  "    unsigned int build;\n"
+  "    unsigned int patch;\n"
+  "};\n\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @brief The version, defined once for the whole program.\n"
+  " */\n"
+  "{{/doxygen}}\n"
+  "inline constexpr {{prefix}}Version_t {{prefix}}Version = {\n"
+  "{{#basic}}\n"
+  "    {{PREFIX}}VERSION_BASE_YEAR,\n"
+  "    {{PREFIX}}VERSION_MAJOR,\n"
+  "    {{PREFIX}}VERSION_MINOR,\n"
+  "    {{PREFIX}}VERSION_BUILD,\n"
+  "    {{PREFIX}}VERSION_PATCH\n"
+  "{{/basic}}\n"
+  "{{^basic}}\n"
+  "    {{base_year}},\n"
+  "    {{major}},\n"
+  "    {{minor}},\n"
+  "    {{build}},\n"
+  "    {{patch}}\n"
+  "{{/basic}}\n"
+  "};\n\n"
+  "constexpr unsigned int {{prefix}}versionBaseYear() { return {{prefix}}Version.baseYear; }\n"
+  "constexpr unsigned int {{prefix}}versionMajor()    { return {{prefix}}Version.major; }\n"
+  "constexpr unsigned int {{prefix}}versionMinor()    { return {{prefix}}Version.minor; }\n"
+  "constexpr unsigned int {{prefix}}versionBuild()    { return {{prefix}}Version.build; }\n"
+  "constexpr unsigned int {{prefix}}versionPatch()    { return {{prefix}}Version.patch; }\n\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @brief Room for \"major.minor.build.patch\" at ten digits each.\n"
+  " */\n"
+  "{{/doxygen}}\n"
+  "struct {{prefix}}VersionText_t {\n"
+  "    char text[44];\n"
+  "};\n\n"
+  "constexpr {{prefix}}VersionText_t\n"
+  "{{prefix}}versionText(const {{prefix}}Version_t &v)\n"
+  "{\n"
+  "    {{prefix}}VersionText_t out = {};\n"
+  "    unsigned int parts[4] = { v.major, v.minor, v.build, v.patch };\n"
+  "    int len = 0;\n\n"
+  "    for (int i = 0; i < 4; i++) {\n"
+  "        char digits[10] = {};\n"
+  "        int n = 0;\n\n"
+  "        do {\n"
+  "            digits[n++] = static_cast<char>('0' + parts[i] % 10);\n"
+  "            parts[i] /= 10;\n"
+  "        } while (parts[i] != 0);\n\n"
+  "        if (i > 0) {\n"
+  "            out.text[len++] = '.';\n"
+  "        }\n\n"
+  "        while (n > 0) {\n"
+  "            out.text[len++] = digits[--n];\n"
+  "        }\n"
+  "    }\n\n"
+  "    return out;\n"
+  "}\n\n"
+  "{{#doxygen}}\n"
+  "/**\n"
+  " * @brief String representation of the version, built at compile time.\n"
+  " */\n"
+  "{{/doxygen}}\n"
+  "inline constexpr {{prefix}}VersionText_t {{prefix}}VersionText =\n"
+  "    {{prefix}}versionText({{prefix}}Version);\n\n"
+  "constexpr const char *{{prefix}}versionString() { return {{prefix}}VersionText.text; }\n\n"
+  "#endif\n\n"
+  "{{/cxx17}}\n"
+  "#endif // !__VersionInfo_Header__\n";
 
 static
-void
-write_header_preamble(stringstream &strm)
+const Template &
+c_header()
 {
-  strm <<
-      "/*\n"
-      " * ----------------------------------------------------\n"
-      " * Automatically generated by VerBuild " << VERSION_STRING << ".\n"
-      " * Do not edit by hand.\n"
-      " * ----------------------------------------------------\n"
-      " */\n\n"
-      "#pragma once\n\n"
-      "#ifndef __VersionInfo_Header__\n"
-      "#define __VersionInfo_Header__\n\n";
-}
+  static const Template compiled(c_template);
 
-static
-void
-write_header_postamble(stringstream &strm)
-{
-  strm <<
-    "#endif // !__VersionInfo_Header__";
+  return compiled;
 }
 
-static
-void
-write_doxygen_preamble(Config &conf, stringstream &strm)
-{
-  strm <<
-    "/**\n"
-    " * @file " << conf.filename << "\n"
-    " * @author Verbuild " << VERSION_STRING << "\n"
-    " * @brief Provides version information.\n"
-    " */\n\n";
-}
-
-static
-void
-write_doxygen_define_comment(Config &conf, stringstream &strm)
+/**
+ * @brief Scan the header in fixed-size chunks.
+ *
+ * Stops once every version field has been seen, or after
+ * @c Config::scan_limit bytes, so memory and time do not grow with the
+ * rest of the file.
+ */
+bool
+CTransform::read_stream(VersionInfo &vi, istream &strm)
 {
-  string prefix;
-
-  prefix.assign(conf.prefix);
-  upcase(prefix);
-
-  strm <<
-    "/**\n"
-    " * @def " << prefix << "VERSION_MAJOR\n"
-    " * @brief Major version number.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_MINOR\n"
-    " * @brief Minoir version number.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_BUILD\n"
-    " * @brief Build number.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_PPATCH\n"
-    " * @brief Patch number.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_BASE_YEAR\n"
-    " * @brief The year the project was started.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_DATE\n"
-    " * @brief The date this build was compiled.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_TIME\n"
-    " * @brief The time this build was compiled.\n"
-    " *\n"
-    " * @def " << prefix << "VERSION_STRING\n"
-    " * @brief String representation of the version.\n"
-    " */\n";
-}
+  CHeaderScanner scanner;
+  char           chunk[C_READ_CHUNK];
+  uint64_t       limit = conf_.scan_limit;
 
-static
-void
-write_doxygen_struct_comment(Config &conf, stringstream &strm)
-{
-  string prefix;
-
-  prefix.assign(conf.prefix);
-  upcase(prefix);
-
-  strm <<
-    "/**\n"
-    " * @Brief Version number structure.\n"
-    " *\n"
-    " * @var baseYear\n"
-    " * @brief The year the project was started.\n"
-    " *\n"
-    " * @var major\n"
-    " * @brief Major version number.\n"
-    " *\n"
-    " * @var minor\n"
-    " * @brief Minor version number.\n"
-    " *\n"
-    " * @var build\n"
-    " * @brief Build number.\n"
-    " *\n"
-    " * @var patch\n"
-    " * @brief Patch number.\n"
-    " */\n";
-}
-      
-static
-void
-write_defines(Config &conf, VersionInfo &vi, stringstream &strm)
-{
-  string prefix;
-  time_t now = time(nullptr);
-  char   buf[100] = { 0 };
+  DSAY(DEBUG_MEDIUM, "Scanning C file");
 
-  if (strftime(buf, sizeof(buf), "%H:%M:%S", localtime(&now)) == 0) {
-    perror("strftime");
-    exit(EXIT_FAILURE);
-  }
-  
-  prefix.assign(conf.prefix);
-  upcase(prefix);  
-
-  strm <<
-    "#define " << prefix << "VERSION_MAJOR      " << vi.get_major() << "\n"
-    "#define " << prefix << "VERSION_MINOR      " << vi.get_minor() << "\n"
-    "#define " << prefix << "VERSION_BUILD      " << vi.get_build() << "\n"
-    "#define " << prefix << "VERSION_PATCH      " << vi.get_patch() << "\n\n"
-    "#define " << prefix << "VERSION_BASE_YEAR  " << vi.get_base_year() << "\n"
-    "#define " << prefix << "VERSION_DATE       \"" << vi.to_date() << "\"\n"
-    "#define " << prefix << "VERSION_TIME       \"" << buf << "\"\n"
-    "#define " << prefix << "VERSION_STRING     \"" << vi.to_string() << "\"\n\n";
-}
+  while (!scanner.done()) {
+    size_t want = sizeof(chunk);
 
-static
-void
-write_struct(Config       &conf,
-             VersionInfo  &vi,
-             stringstream &strm,
-             bool         use_preprocessor = false)
-{
-  strm <<
-    "static struct " << conf.prefix << "VersionNumber_s {\n"
-    "    int baseYear;\n"
-    "    int major;\n"
-    "    int minor;\n"
-    "    int build;\n"
-    "    int patch;\n"
-    "} " << conf.prefix << "VersionNumber = {\n";
-
-  switch (use_preprocessor) {
-    case true: {
-        string prefix;
-        prefix.assign(conf.prefix);
-        strm
-          << "    " << prefix << "VERSION_BASE_YEAR" << ",\n"
-          << "    " << prefix << "VERSION_MAJOR" << ",\n"
-          << "    " << prefix << "VERSION_MINOR" << ",\n"
-          << "    " << prefix << "VERSION_BUILD" << ",\n"
-          << "    " << prefix << "VERSION_PATCH" << "\n";
+    if (limit > 0) {
+      if (scanner.get_offset() >= limit) {
+        WSAY("Stopped scanning", conf_.filename, "after", limit, "bytes.");
+        break;
       }
-      break;
 
-    case false:
-      strm
-        << "    " << vi.get_base_year() << ",\n"
-        << "    " << vi.get_major() << ",\n"
-        << "    " << vi.get_minor() << ",\n"
-        << "    " << vi.get_build() << ",\n"
-        << "    " << vi.get_patch() << "\n";
+      want = static_cast<size_t>(min<uint64_t>(want,
+                                               limit - scanner.get_offset()));
+    }
+
+    strm.read(chunk, want);
+    if (strm.gcount() == 0) {
       break;
+    }
+
+    scanner.feed(chunk, static_cast<size_t>(strm.gcount()));
   }
-   strm << "};\n\n";
+
+  scanner.finish();
+  DSAY(DEBUG_HIGH, "Scanned", scanner.get_offset(), "bytes");
+
+  if (!scanner.found()) {
+    return false;
+  }
+
+  scanner.apply(vi);
+
+  return true;
 }
 
 bool
 CTransform::read_impl(VersionInfo &vi, std::string &buffer)
 {
+  CHeaderScanner scanner;
+
   DSAY(DEBUG_MEDIUM, "Reading C file");
 
-  if (buffer.length() > 0) {
-    boost::regex rgx;
-
-    rgx.set_expression("\\s*\n\\s*");
-    boost::regex_replace(buffer.begin(),
-      buffer.begin(),
-      buffer.end(),
-      rgx,
-      " ");
-
-    DSAY(DEBUG_MEDIUM, "Trying structure regex.");
-    {
-      boost::smatch matches;
-      rgx.set_expression(STRUCT_RE);
-      if (boost::regex_search(buffer, matches, rgx)) {
-        if (matches.size() != 6) {
-          return false;
-        }
-
-        DSAY(DEBUG_HIGH, "Reading version info.");
-        vi.set_base_year(safe_stoi(matches[1]));
-        vi.set_major(safe_stoi(matches[2]));
-        vi.set_minor(safe_stoi(matches[3]));
-        vi.set_build(safe_stoi(matches[4]));
-        vi.set_patch(safe_stoi(matches[5]));
-
-        return true;
-      }
-    }
-    
-
-    DSAY(DEBUG_MEDIUM, "Trying define regex.");
-    {
-      bool ok = false;
-
-      rgx.set_expression(VERSION_RE);
-      boost::regex_token_iterator<std::string::iterator> it{
-        buffer.begin(),
-        buffer.end(),
-        rgx,
-        {1,2}
-      };
-      boost::regex_token_iterator<std::string::iterator> end;
-
-      while (it != end) {
-        if (*it == "MAJOR") {
-          *it++;
-          DSAY(DEBUG_HIGH, "Reading major:", *it);
-          vi.set_major(safe_stoi(*it));
-          ok = true;
-        } else if (*it == "MINOR") {
-          *it++;
-          DSAY(DEBUG_HIGH, "Reading minor:", *it);
-          vi.set_minor(safe_stoi(*it));
-          ok = true;
-        } else if (*it == "BUILD") {
-          *it++;
-          DSAY(DEBUG_HIGH, "Reading build:", *it);
-          vi.set_build(safe_stoi(*it));
-          ok = true;
-        } else if (*it == "PATCH") {
-          *it++;
-          ok = true;
-          DSAY(DEBUG_HIGH, "Reading patch:", *it);
-          vi.set_patch(safe_stoi(*it));
-        } else if (*it == "BASE_YEAR") {
-          *it++;
-          DSAY(DEBUG_HIGH, "Reading base year:", *it);
-          vi.set_base_year(safe_stoi(*it));
-          ok = true;
-        } else {
-          ok = false;
-        }
-
-        *it++;
-      }
+  scanner.feed(buffer.data(), buffer.size());
+  scanner.finish();
 
-      return ok;
-    }
+  if (!scanner.found()) {
+    return false;
   }
 
-  return false;
+  scanner.apply(vi);
+
+  return true;
 }
 
-#define IS_GROUP(__p)   ((conf_.groups & __p) == __p)
 bool
 CTransform::write_impl(VersionInfo &vi, stringstream &strm)
 {
-  bool with_doxygen = IS_GROUP(OutputGroups::Doxygen);
-  bool with_basic   = IS_GROUP(OutputGroups::Basic);
-  bool with_struct  = IS_GROUP(OutputGroups::Struct);
+  strm << c_header().render(vi, conf_);
+
+  return true;
+}
 
-  write_header_preamble(strm);
-  if (with_doxygen) {
-    write_doxygen_preamble(conf_, strm);
+/**
+ * @brief Rewrite the version values of an existing header in place.
+ *
+ * The header is scanned for the spans of the VERSION_* values and the
+ * struct initialiser digits, and only those bytes are replaced, so
+ * anything edited by hand around them survives.  Falls back to a full
+ * write when no values are found.
+ */
+bool
+CTransform::update_impl(VersionInfo &vi)
+{
+  static const TemplateField fields[CHS_SPANS] = {
+    TemplateField::Major,
+    TemplateField::Minor,
+    TemplateField::Build,
+    TemplateField::Patch,
+    TemplateField::BaseYear,
+    TemplateField::Date,
+    TemplateField::Time,
+    TemplateField::Version
+  };
+
+  FileEditor        editor;
+  CHeaderScanner    scanner(true);
+  CHeaderSpanVector spans;
+  FileEditVector    edits;
+  char              chunk[C_READ_CHUNK];
+  uint64_t          limit = conf_.scan_limit;
+  time_t            now   = time(nullptr);
+
+  if (!editor.open(conf_.filename)) {
+    return false;
   }
 
-  if (with_basic) {
-    if (with_doxygen) {
-      write_doxygen_define_comment(conf_, strm);
+  while (!scanner.done() && (limit == 0 || scanner.get_offset() < limit)) {
+    size_t want = sizeof(chunk);
+    size_t got;
+
+    if (limit > 0) {
+      want = static_cast<size_t>(min<uint64_t>(want,
+                                               limit - scanner.get_offset()));
     }
-    
-    write_defines(conf_, vi, strm);
-  }
 
-  if (with_struct) {
-    if (with_doxygen) {
-      write_doxygen_struct_comment(conf_, strm);
+    got = editor.read(chunk, want);
+    if (got == 0) {
+      break;
     }
 
-    write_struct(conf_, vi, strm, with_basic);
+    scanner.feed(chunk, got);
+  }
+
+  scanner.finish();
+  scanner.get_spans(spans);
+
+  if (spans.empty()) {
+    return false;
+  }
+
+  for (auto &it : spans) {
+    edits.push_back(FileEdit {
+      it.offset,
+      it.length,
+      format_field(fields[it.field], vi, conf_, now)
+    });
+  }
+
+  if (!editor.apply(edits)) {
+    return false;
   }
 
-  write_header_postamble(strm);
-  strm << endl;
+  DSAY(DEBUG_MEDIUM,
+       "Updated",
+       spans.size(),
+       "values with",
+       editor.get_written(),
+       "bytes written");
 
   return true;
 }
-#undef IS_GROUP
 
 // Transform_C.cpp ends here.
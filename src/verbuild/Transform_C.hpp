@@ -43,6 +43,12 @@
 #define C_KEY    "c"
 #define C_PRETTY "C/C++"
 
+/**
+ * @def C_READ_CHUNK
+ * @brief Bytes read per step when scanning an existing header.
+ */
+#define C_READ_CHUNK (16 * 1024)
+
 class CTransform
   : public Transform
 {
@@ -50,8 +56,10 @@ private:
   std::string name_ = C_PRETTY;
 
 private:
+  bool read_stream(VersionInfo &, std::istream &);
   bool read_impl(VersionInfo &, std::string &);
   bool write_impl(VersionInfo &, std::stringstream &);
+  bool update_impl(VersionInfo &);
 };
 
 static const bool UNUSED_VARIABLE(registered_c_transform) =
@@ -0,0 +1,99 @@
+//
+// Transform_CMake.cpp --- CMake transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:11:36
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_CMake.cpp
+ * @author Paul Ward
+ * @brief CMake transform implementation.
+ */
+
+#include "Transform_CMake.hpp"
+#include "Console.hpp"
+#include "Template.hpp"
+
+#include <sstream>
+
+#include <boost/regex.hpp>
+
+using namespace std;
+
+#define FIELD_RE                                                        \
+  "set\\s*\\(\\s*\\w*VERSION_(MAJOR|MINOR|BUILD|PATCH|BASE_YEAR)"       \
+  "\\s+\"?(\\d+)\"?\\s*\\)"
+
+static const char cmake_template[] =
+  "# ----------------------------------------------------\n"
+  "# Automatically generated by VerBuild {{verbuild_version}}.\n"
+  "# Do not edit by hand.\n"
+  "# ----------------------------------------------------\n\n"
+  "set({{PREFIX}}VERSION_MAJOR      {{major}})\n"
+  "set({{PREFIX}}VERSION_MINOR      {{minor}})\n"
+  "set({{PREFIX}}VERSION_BUILD      {{build}})\n"
+  "set({{PREFIX}}VERSION_PATCH      {{patch}})\n\n"
+  "set({{PREFIX}}VERSION_BASE_YEAR  {{base_year}})\n"
+  "set({{PREFIX}}VERSION_DATE       \"{{date}}\")\n"
+  "set({{PREFIX}}VERSION_TIME       \"{{time}}\")\n"
+  "set({{PREFIX}}VERSION_STRING     \"{{version}}\")\n";
+
+static
+const Template &
+cmake_output()
+{
+  static const Template compiled(cmake_template);
+
+  return compiled;
+}
+
+bool
+CMakeTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  boost::regex  rgx(FIELD_RE, boost::regex::icase);
+  boost::smatch matches;
+  auto          start = buffer.cbegin();
+  bool          ok    = false;
+
+  DSAY(DEBUG_MEDIUM, "Reading CMake file");
+
+  while (boost::regex_search(start, buffer.cend(), matches, rgx)) {
+    ok    = set_version_field(vi, matches[1], matches[2]) || ok;
+    start = matches[0].second;
+  }
+
+  return ok;
+}
+
+bool
+CMakeTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  strm << cmake_output().render(vi, conf_);
+
+  return true;
+}
+
+// Transform_CMake.cpp ends here.
@@ -0,0 +1,70 @@
+//
+// Transform_CMake.hpp --- CMake transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:08:02
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_CMake.hpp
+ * @author Paul Ward
+ * @brief CMake transform interface.
+ *
+ * Writes `set()' commands for inclusion from a CMakeLists.txt.  The
+ * prefix is upper-cased as for the C transform; output groups do not
+ * apply.
+ */
+
+#pragma once
+#ifndef _Transform_CMake_hpp_
+#define _Transform_CMake_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+
+#define CMAKE_KEY    "cmake"
+#define CMAKE_PRETTY "CMake"
+
+class CMakeTransform
+  : public Transform
+{
+private:
+  std::string name_ = CMAKE_PRETTY;
+
+private:
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+};
+
+static const bool UNUSED_VARIABLE(registered_cmake_transform) =
+  get_transform_factory().register_transform(
+    CMAKE_KEY,
+    CMAKE_PRETTY,
+    create_transform<CMakeTransform>
+  );
+
+#endif // !_Transform_CMake_hpp_
+
+// Transform_CMake.hpp ends here.
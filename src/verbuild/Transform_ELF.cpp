@@ -0,0 +1,123 @@
+//
+// Transform_ELF.cpp --- ELF object transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:44:39
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file Transform_ELF.cpp
+ * @author Paul Ward
+ * @brief ELF object transform implementation.
+ */
+
+#include "Transform_ELF.hpp"
+#include "Console.hpp"
+#include "Template.hpp"
+
+#include <cstdint>
+#include <ctime>
+
+using namespace std;
+
+// Field order of <prefix>VersionNumber and of the note.
+#define ELF_VERSION_FIELDS 5
+
+ElfTransform::ElfTransform(ElfMachine machine)
+  : machine_(machine)
+{
+  binary_ = true;
+}
+
+bool
+ElfTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  string   desc;
+  uint32_t fields[ELF_VERSION_FIELDS];
+
+  DSAY(DEBUG_MEDIUM, "Reading ELF object");
+
+  if (!elf_find_note(buffer, ELF_NOTE_OWNER, ELF_NOTE_VERSION, desc) ||
+      desc.size() < sizeof(fields)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < ELF_VERSION_FIELDS; i++) {
+    fields[i] = 0;
+
+    for (size_t b = 0; b < 4; b++) {
+      fields[i] |= static_cast<uint32_t>(
+        static_cast<unsigned char>(desc[i * 4 + b])) << (8 * b);
+    }
+  }
+
+  vi.set_base_year(fields[0]);
+  vi.set_major(fields[1]);
+  vi.set_minor(fields[2]);
+  vi.set_build(fields[3]);
+  vi.set_patch(fields[4]);
+
+  return true;
+}
+
+bool
+ElfTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  const uint32_t fields[ELF_VERSION_FIELDS] = {
+    vi.get_base_year(),
+    vi.get_major(),
+    vi.get_minor(),
+    vi.get_build(),
+    vi.get_patch()
+  };
+
+  ElfObject     obj(machine_);
+  unsigned char numbers[sizeof(fields)];
+  time_t        now    = time(nullptr);
+  const string &prefix = conf_.prefix;
+  string        image;
+
+  // Both machines are little-endian.
+  for (size_t i = 0; i < sizeof(numbers); i++) {
+    numbers[i] = static_cast<unsigned char>(fields[i / 4] >> (8 * (i % 4)));
+  }
+
+  obj.add_object(prefix + "VersionNumber", numbers, sizeof(numbers), 4);
+  obj.add_string(prefix + "VersionString",
+                 format_field(TemplateField::Version, vi, conf_, now));
+  obj.add_string(prefix + "VersionDate",
+                 format_field(TemplateField::Date, vi, conf_, now));
+  obj.add_string(prefix + "VersionTime",
+                 format_field(TemplateField::Time, vi, conf_, now));
+  obj.add_note(ELF_NOTE_OWNER, ELF_NOTE_VERSION, numbers, sizeof(numbers));
+
+  image = obj.to_string();
+  strm.write(image.data(), image.size());
+
+  return true;
+}
+
+// Transform_ELF.cpp ends here.
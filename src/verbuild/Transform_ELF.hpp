@@ -0,0 +1,122 @@
+//
+// Transform_ELF.hpp --- ELF object transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 18:31:14
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file Transform_ELF.hpp
+ * @author Paul Ward
+ * @brief ELF object transform interface.
+ *
+ * Writes a relocatable ELF object that can be linked in as it is,
+ * without compiling anything.  It defines these read-only symbols:
+ *
+ *   <prefix>VersionNumber  -- five 32-bit integers: base year, major,
+ *                             minor, build and patch, as in the
+ *                             C transform's struct.
+ *   <prefix>VersionString  -- "major.minor.build.patch".
+ *   <prefix>VersionDate    -- the build date.
+ *   <prefix>VersionTime    -- the time the file was written.
+ *
+ * The same five numbers are also stored in a `verbuild' note, so that
+ * `readelf -n' shows them in the linked program and so that the file
+ * can be read back.  Output groups do not apply.
+ *
+ * `elf' targets the machine verbuild runs on; `elf-x86-64' and
+ * `elf-aarch64' name one.
+ */
+
+#pragma once
+#ifndef _Transform_ELF_hpp_
+#define _Transform_ELF_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+#include "ElfObject.hpp"
+
+#define ELF_KEY            "elf"
+#define ELF_PRETTY         "ELF object"
+#define ELF_X86_64_KEY     "elf-x86-64"
+#define ELF_X86_64_PRETTY  "ELF object (x86-64)"
+#define ELF_AARCH64_KEY    "elf-aarch64"
+#define ELF_AARCH64_PRETTY "ELF object (AArch64)"
+
+/**
+ * @def ELF_NOTE_OWNER
+ * @brief Owner name of the version note.
+ */
+#define ELF_NOTE_OWNER "verbuild"
+
+/**
+ * @def ELF_NOTE_VERSION
+ * @brief Type of the version note.
+ */
+#define ELF_NOTE_VERSION 1
+
+class ElfTransform
+  : public Transform
+{
+private:
+  std::string name_ = ELF_PRETTY;
+  ElfMachine  machine_;
+
+public:
+  ElfTransform(ElfMachine = ElfObject::host_machine());
+
+private:
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+};
+
+template <ElfMachine Machine>
+Transform *create_elf_transform() { return new ElfTransform(Machine); }
+
+static const bool UNUSED_VARIABLE(registered_elf_transform) =
+  get_transform_factory().register_transform(
+    ELF_KEY,
+    ELF_PRETTY,
+    create_transform<ElfTransform>
+  );
+
+static const bool UNUSED_VARIABLE(registered_elf_x86_64_transform) =
+  get_transform_factory().register_transform(
+    ELF_X86_64_KEY,
+    ELF_X86_64_PRETTY,
+    create_elf_transform<ElfMachine::X86_64>
+  );
+
+static const bool UNUSED_VARIABLE(registered_elf_aarch64_transform) =
+  get_transform_factory().register_transform(
+    ELF_AARCH64_KEY,
+    ELF_AARCH64_PRETTY,
+    create_elf_transform<ElfMachine::AArch64>
+  );
+
+#endif // !_Transform_ELF_hpp_
+
+// Transform_ELF.hpp ends here.
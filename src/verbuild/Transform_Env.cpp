@@ -0,0 +1,97 @@
+//
+// Transform_Env.cpp --- Shell environment transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:19:12
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_Env.cpp
+ * @author Paul Ward
+ * @brief Shell environment transform implementation.
+ */
+
+#include "Transform_Env.hpp"
+#include "Console.hpp"
+#include "Template.hpp"
+
+#include <sstream>
+
+#include <boost/regex.hpp>
+
+using namespace std;
+
+#define FIELD_RE                                                        \
+  "^[ \\t]*(?:export[ \\t]+)?"                                          \
+  "\\w*VERSION_(MAJOR|MINOR|BUILD|PATCH|BASE_YEAR)=[\"']?(\\d+)"
+
+static const char env_template[] =
+  "# Automatically generated by VerBuild {{verbuild_version}}.\n"
+  "# Do not edit by hand.\n"
+  "{{PREFIX}}VERSION_MAJOR={{major}}\n"
+  "{{PREFIX}}VERSION_MINOR={{minor}}\n"
+  "{{PREFIX}}VERSION_BUILD={{build}}\n"
+  "{{PREFIX}}VERSION_PATCH={{patch}}\n"
+  "{{PREFIX}}VERSION_BASE_YEAR={{base_year}}\n"
+  "{{PREFIX}}VERSION_DATE={{date}}\n"
+  "{{PREFIX}}VERSION_TIME={{time}}\n"
+  "{{PREFIX}}VERSION_STRING={{version}}\n";
+
+static
+const Template &
+env_output()
+{
+  static const Template compiled(env_template);
+
+  return compiled;
+}
+
+bool
+EnvTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  boost::regex  rgx(FIELD_RE, boost::regex::normal);
+  boost::smatch matches;
+  auto          start = buffer.cbegin();
+  bool          ok    = false;
+
+  DSAY(DEBUG_MEDIUM, "Reading shell environment file");
+
+  while (boost::regex_search(start, buffer.cend(), matches, rgx)) {
+    ok    = set_version_field(vi, matches[1], matches[2]) || ok;
+    start = matches[0].second;
+  }
+
+  return ok;
+}
+
+bool
+EnvTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  strm << env_output().render(vi, conf_);
+
+  return true;
+}
+
+// Transform_Env.cpp ends here.
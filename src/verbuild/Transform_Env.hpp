@@ -0,0 +1,71 @@
+//
+// Transform_Env.hpp --- Shell environment transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:15:50
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_Env.hpp
+ * @author Paul Ward
+ * @brief Shell environment transform interface.
+ *
+ * Writes NAME=value lines that can be sourced by a POSIX shell or used
+ * as an env file by Docker and systemd.  None of the values contain
+ * spaces, so nothing is quoted.  The prefix is upper-cased as for the C
+ * transform; output groups do not apply.
+ */
+
+#pragma once
+#ifndef _Transform_Env_hpp_
+#define _Transform_Env_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+
+#define ENV_KEY    "env"
+#define ENV_PRETTY "Shell environment"
+
+class EnvTransform
+  : public Transform
+{
+private:
+  std::string name_ = ENV_PRETTY;
+
+private:
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+};
+
+static const bool UNUSED_VARIABLE(registered_env_transform) =
+  get_transform_factory().register_transform(
+    ENV_KEY,
+    ENV_PRETTY,
+    create_transform<EnvTransform>
+  );
+
+#endif // !_Transform_Env_hpp_
+
+// Transform_Env.hpp ends here.
@@ -0,0 +1,97 @@
+//
+// Transform_JSON.cpp --- JSON transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 17:03:47
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_JSON.cpp
+ * @author Paul Ward
+ * @brief JSON transform implementation.
+ */
+
+#include "Transform_JSON.hpp"
+#include "Console.hpp"
+#include "Template.hpp"
+
+#include <sstream>
+
+#include <boost/regex.hpp>
+
+using namespace std;
+
+#define FIELD_RE                                                        \
+  "\"(major|minor|build|patch|base_year)\"\\s*:\\s*(\\d+)"
+
+static const char json_template[] =
+  "{\n"
+  "  \"major\": {{major}},\n"
+  "  \"minor\": {{minor}},\n"
+  "  \"build\": {{build}},\n"
+  "  \"patch\": {{patch}},\n"
+  "  \"base_year\": {{base_year}},\n"
+  "  \"version\": \"{{version}}\",\n"
+  "  \"date\": \"{{date}}\",\n"
+  "  \"time\": \"{{time}}\",\n"
+  "  \"generator\": \"VerBuild {{verbuild_version}}\"\n"
+  "}\n";
+
+static
+const Template &
+json_output()
+{
+  static const Template compiled(json_template);
+
+  return compiled;
+}
+
+bool
+JSONTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  boost::regex  rgx(FIELD_RE, boost::regex::normal);
+  boost::smatch matches;
+  auto          start = buffer.cbegin();
+  bool          ok    = false;
+
+  DSAY(DEBUG_MEDIUM, "Reading JSON file");
+
+  while (boost::regex_search(start, buffer.cend(), matches, rgx)) {
+    ok    = set_version_field(vi, matches[1], matches[2]) || ok;
+    start = matches[0].second;
+  }
+
+  return ok;
+}
+
+bool
+JSONTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  strm << json_output().render(vi, conf_);
+
+  return true;
+}
+
+// Transform_JSON.cpp ends here.
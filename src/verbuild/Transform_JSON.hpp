@@ -0,0 +1,69 @@
+//
+// Transform_JSON.hpp --- JSON transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:58:21
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_JSON.hpp
+ * @author Paul Ward
+ * @brief JSON transform interface.
+ *
+ * Writes a flat JSON object for packaging tools.  Output groups and the
+ * prefix do not apply.
+ */
+
+#pragma once
+#ifndef _Transform_JSON_hpp_
+#define _Transform_JSON_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+
+#define JSON_KEY    "json"
+#define JSON_PRETTY "JSON"
+
+class JSONTransform
+  : public Transform
+{
+private:
+  std::string name_ = JSON_PRETTY;
+
+private:
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+};
+
+static const bool UNUSED_VARIABLE(registered_json_transform) =
+  get_transform_factory().register_transform(
+    JSON_KEY,
+    JSON_PRETTY,
+    create_transform<JSONTransform>
+  );
+
+#endif // !_Transform_JSON_hpp_
+
+// Transform_JSON.hpp ends here.
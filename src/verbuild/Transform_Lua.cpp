@@ -0,0 +1,306 @@
+//
+// Transform_Lua.cpp --- Lua-scripted transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 10:11:58
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_Lua.cpp
+ * @author Paul Ward
+ * @brief Lua-scripted transform implementation.
+ */
+
+#include "Transform_Lua.hpp"
+#include "LuaPool.hpp"
+#include "Console.hpp"
+
+#include <sstream>
+
+using namespace std;
+
+static
+void
+push_config(lua_State *L, const Config &conf)
+{
+  stringstream ss;
+
+  ss << conf.groups;
+
+  lua_createtable(L, 0, 6);
+  lua_pushstring(L, conf.prefix.c_str());
+  lua_setfield(L, -2, "prefix");
+  lua_pushstring(L, conf.filename.c_str());
+  lua_setfield(L, -2, "filename");
+  lua_pushstring(L, ss.str().c_str());
+  lua_setfield(L, -2, "groups");
+  lua_pushinteger(L, static_cast<lua_Integer>(conf.groups));
+  lua_setfield(L, -2, "group_bits");
+  lua_pushinteger(L, conf.base_year);
+  lua_setfield(L, -2, "base_year");
+  lua_pushboolean(L, conf.create);
+  lua_setfield(L, -2, "create");
+}
+
+/*
+ * Borrow a pooled state for the length of one call, so that a state
+ * is only tied up while a script actually runs.  Nested calls share
+ * the outer call's state.
+ */
+class LuaBorrow
+{
+private:
+  LuaState *&state_;
+  bool       owner_;
+
+public:
+  LuaBorrow(LuaState *&state, const Config &conf)
+    : state_(state),
+      owner_(state == nullptr)
+  {
+    if (owner_) {
+      state_ = get_lua_pool().acquire(make_lua_limits(conf));
+    }
+  }
+
+  ~LuaBorrow()
+  {
+    if (owner_) {
+      get_lua_pool().release(state_);
+      state_ = nullptr;
+    }
+  }
+};
+
+LuaTransform::LuaTransform()
+{}
+
+LuaTransform::~LuaTransform()
+{
+  get_lua_pool().release(state_);
+}
+
+bool
+LuaTransform::load_module()
+{
+  lua_State *L;
+
+  if (conf_.script.empty()) {
+    ESAY("The Lua transform requires a script.");
+    return false;
+  }
+
+  L = state_->get();
+
+  if (!state_->load_module(conf_.script, conf_.script_cache)) {
+    ESAY("Lua:", state_->pop_error());
+    return false;
+  }
+
+  if (!lua_istable(L, -1)) {
+    ESAY("Lua script", conf_.script, "did not return a table.");
+    lua_pop(L, 1);
+    return false;
+  }
+
+  return true;
+}
+
+bool
+LuaTransform::push_function(const char *name)
+{
+  lua_State *L;
+
+  if (!load_module()) {
+    return false;
+  }
+
+  L = state_->get();
+  lua_getfield(L, -1, name);
+  lua_remove(L, -2);
+
+  if (!lua_isfunction(L, -1)) {
+    ESAY("Lua script", conf_.script, "does not provide", name);
+    lua_pop(L, 1);
+    return false;
+  }
+
+  return true;
+}
+
+bool
+LuaTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  LuaBorrow  borrow(state_, conf_);
+  lua_State *L;
+  bool       ok;
+
+  DSAY(DEBUG_MEDIUM, "Reading via Lua script");
+
+  if (!push_function("read")) {
+    return false;
+  }
+
+  L = state_->get();
+
+  lua_push_version_info(L, &vi);
+  lua_pushlstring(L, buffer.data(), buffer.size());
+
+  if (state_->pcall(2, 1) != LUA_OK) {
+    ESAY("Lua:", state_->pop_error());
+    return false;
+  }
+
+  ok = lua_toboolean(L, -1);
+  lua_pop(L, 1);
+
+  return ok;
+}
+
+bool
+LuaTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  LuaBorrow   borrow(state_, conf_);
+  lua_State  *L;
+  const char *out;
+  size_t      len;
+
+  DSAY(DEBUG_MEDIUM, "Writing via Lua script");
+
+  if (!push_function("write")) {
+    return false;
+  }
+
+  L = state_->get();
+
+  lua_push_version_info(L, &vi);
+  push_config(L, conf_);
+
+  if (state_->pcall(2, 1) != LUA_OK) {
+    ESAY("Lua:", state_->pop_error());
+    return false;
+  }
+
+  out = lua_tolstring(L, -1, &len);
+  if (out == nullptr) {
+    ESAY("Lua script", conf_.script, "write did not return a string.");
+    lua_pop(L, 1);
+    return false;
+  }
+
+  strm.write(out, len);
+  lua_pop(L, 1);
+
+  return true;
+}
+
+/**
+ * @brief Render many versions with as few Lua calls as possible.
+ * @param vis Versions to render.
+ * @param out Receives one rendered string per element of @c vis.
+ *
+ * Scripts that provide @c write_all get a single call with every
+ * version; others get one @c write call per version.
+ */
+bool
+LuaTransform::write_all(const vector<VersionInfo *> &vis, vector<string> &out)
+{
+  LuaBorrow  borrow(state_, conf_);
+  lua_State *L;
+  bool       bulk;
+
+  if (!load_module()) {
+    return false;
+  }
+
+  L = state_->get();
+  lua_getfield(L, -1, "write_all");
+  bulk = lua_isfunction(L, -1);
+  lua_pop(L, 2);
+
+  out.clear();
+  out.reserve(vis.size());
+
+  if (!bulk) {
+    for (VersionInfo *vi : vis) {
+      stringstream strm;
+
+      if (!write_impl(*vi, strm)) {
+        return false;
+      }
+
+      out.push_back(strm.str());
+    }
+
+    return true;
+  }
+
+  DSAY(DEBUG_MEDIUM, "Writing", vis.size(), "versions via Lua script");
+
+  if (!push_function("write_all")) {
+    return false;
+  }
+
+  lua_createtable(L, static_cast<int>(vis.size()), 0);
+  for (size_t i = 0; i < vis.size(); i++) {
+    lua_push_version_info(L, vis[i]);
+    lua_rawseti(L, -2, static_cast<lua_Integer>(i + 1));
+  }
+  push_config(L, conf_);
+
+  if (state_->pcall(2, 1) != LUA_OK) {
+    ESAY("Lua:", state_->pop_error());
+    return false;
+  }
+
+  if (!lua_istable(L, -1)) {
+    ESAY("Lua script", conf_.script, "write_all did not return a table.");
+    lua_pop(L, 1);
+    return false;
+  }
+
+  for (size_t i = 0; i < vis.size(); i++) {
+    const char *str;
+    size_t      len;
+
+    lua_rawgeti(L, -1, static_cast<lua_Integer>(i + 1));
+    str = lua_tolstring(L, -1, &len);
+    if (str == nullptr) {
+      ESAY("Lua script", conf_.script, "write_all result", i + 1,
+           "is not a string.");
+      lua_pop(L, 2);
+      return false;
+    }
+
+    out.emplace_back(str, len);
+    lua_pop(L, 1);
+  }
+
+  lua_pop(L, 1);
+
+  return true;
+}
+
+// Transform_Lua.cpp ends here.
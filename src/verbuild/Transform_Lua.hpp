@@ -0,0 +1,95 @@
+//
+// Transform_Lua.hpp --- Lua-scripted transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 10:02:36
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_Lua.hpp
+ * @author Paul Ward
+ * @brief Lua-scripted transform interface.
+ *
+ * The script named by the `script' option must return a table with
+ * two functions:
+ *
+ *   read(vi, text)  -- parse @c text into @c vi, return true on success.
+ *   write(vi, conf) -- return the file contents as a string.
+ *
+ * It may also provide
+ *
+ *   write_all(vis, conf) -- return an array of strings, one per element
+ *                           of the array @c vis.
+ *
+ * which @c write_all uses to render many versions in one call.  Each
+ * read or write borrows a state from the shared pool and returns it
+ * when the call is done.
+ */
+
+#pragma once
+#ifndef _Transform_Lua_hpp_
+#define _Transform_Lua_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+#include "LuaState.hpp"
+
+#include <string>
+#include <vector>
+
+#define LUA_KEY    "lua"
+#define LUA_PRETTY "Lua script"
+
+class LuaTransform
+  : public Transform
+{
+private:
+  std::string name_  = LUA_PRETTY;
+  LuaState   *state_ = nullptr;
+
+public:
+  LuaTransform();
+  ~LuaTransform();
+
+  bool write_all(const std::vector<VersionInfo *> &,
+                 std::vector<std::string> &);
+
+private:
+  bool load_module();
+  bool push_function(const char *);
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+};
+
+static const bool UNUSED_VARIABLE(registered_lua_transform) =
+  get_transform_factory().register_transform(
+    LUA_KEY,
+    LUA_PRETTY,
+    create_transform<LuaTransform>
+  );
+
+#endif // !_Transform_Lua_hpp_
+
+// Transform_Lua.hpp ends here.
@@ -0,0 +1,225 @@
+//
+// Transform_Manifest.cpp --- Package manifest transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 21:30:08
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_Manifest.cpp
+ * @author Paul Ward
+ * @brief Package manifest transform implementation.
+ */
+
+#include "Transform_Manifest.hpp"
+#include "Console.hpp"
+
+#include <charconv>
+#include <cstring>
+
+using namespace std;
+
+static inline
+bool
+is_semver(ManifestFormat format)
+{
+  return format == ManifestFormat::Npm || format == ManifestFormat::Cargo;
+}
+
+static inline
+bool
+is_digit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+/*
+ * Length of the leading `N.N...' release number of a value, or 0 if
+ * the value does not start with one.
+ */
+static
+size_t
+release_length(const char *p, size_t len)
+{
+  size_t n = 0;
+
+  while (n < len && (is_digit(p[n]) || p[n] == '.')) {
+    n++;
+  }
+
+  while (n > 0 && p[n - 1] == '.') {
+    n--;
+  }
+
+  return (n > 0 && is_digit(p[0])) ? n : 0;
+}
+
+/*
+ * Split a release number into up to four components.
+ */
+static
+void
+parse_release(const char *p, size_t len, uint32_t (&nums)[4])
+{
+  const char *end = p + len;
+
+  for (int i = 0; i < 4 && p < end; i++) {
+    auto res = from_chars(p, end, nums[i]);
+
+    p = res.ptr + 1;
+  }
+}
+
+ManifestTransform::ManifestTransform(ManifestFormat format)
+  : format_(format)
+{}
+
+bool
+ManifestTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  ManifestValue value;
+  uint32_t      nums[4] = { 0 };
+  const char   *text;
+  size_t        release;
+
+  DSAY(DEBUG_MEDIUM, "Reading package manifest");
+
+  if (!find_manifest_version(format_, buffer.data(), buffer.size(), value)) {
+    return false;
+  }
+
+  text    = buffer.data() + value.offset;
+  release = release_length(text, value.length);
+
+  if (release == 0) {
+    WSAY("Manifest version is not a number:",
+         string(text, value.length));
+    return false;
+  }
+
+  parse_release(text, release, nums);
+
+  if (!is_semver(format_)) {
+    vi.set_major(nums[0]);
+    vi.set_minor(nums[1]);
+    vi.set_build(nums[2]);
+    vi.set_patch(nums[3]);
+
+    return true;
+  }
+
+  vi.set_major(nums[0]);
+  vi.set_minor(nums[1]);
+  vi.set_patch(nums[2]);
+
+  {
+    const char *plus = static_cast<const char *>(memchr(text, '+',
+                                                        value.length));
+    const char *end  = text + value.length;
+    uint32_t    build;
+
+    if (plus != nullptr) {
+      auto res = from_chars(plus + 1, end, build);
+
+      if (res.ec == errc() && res.ptr == end) {
+        vi.set_build(build);
+      }
+    }
+  }
+
+  return true;
+}
+
+bool
+ManifestTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  return write_edits(vi, strm);
+}
+
+bool
+ManifestTransform::update_impl(VersionInfo &vi)
+{
+  return update_edits(vi);
+}
+
+/**
+ * @brief Replace the release number, and for SemVer the build metadata.
+ */
+bool
+ManifestTransform::collect_edits(VersionInfo    &vi,
+                                 const string   &buffer,
+                                 FileEditVector &edits)
+{
+  ManifestValue value;
+  const char   *text;
+  const char   *plus;
+  size_t        release;
+
+  if (!find_manifest_version(format_, buffer.data(), buffer.size(), value)) {
+    ESAY("No top-level version found in", conf_.filename);
+    return false;
+  }
+
+  text    = buffer.data() + value.offset;
+  release = release_length(text, value.length);
+
+  if (release == 0) {
+    ESAY("Manifest version is not a number:", string(text, value.length));
+    return false;
+  }
+
+  if (!is_semver(format_)) {
+    edits.push_back(FileEdit { value.offset, release, vi.to_string() });
+    return true;
+  }
+
+  edits.push_back(FileEdit {
+    value.offset,
+    release,
+    to_string(vi.get_major()) + "." +
+      to_string(vi.get_minor()) + "." +
+      to_string(vi.get_patch())
+  });
+
+  plus = static_cast<const char *>(memchr(text, '+', value.length));
+
+  if (plus != nullptr) {
+    edits.push_back(FileEdit {
+      static_cast<uint64_t>(plus + 1 - buffer.data()),
+      static_cast<uint64_t>(text + value.length - (plus + 1)),
+      to_string(vi.get_build())
+    });
+  } else {
+    edits.push_back(FileEdit {
+      value.offset + value.length,
+      0,
+      "+" + to_string(vi.get_build())
+    });
+  }
+
+  return true;
+}
+
+// Transform_Manifest.cpp ends here.
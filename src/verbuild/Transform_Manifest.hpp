@@ -0,0 +1,150 @@
+//
+// Transform_Manifest.hpp --- Package manifest transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 21:22:31
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_Manifest.hpp
+ * @author Paul Ward
+ * @brief Package manifest transform interface.
+ *
+ * Keeps the top-level version of an existing package manifest in step.
+ * Only the version value changes; every other byte of the file is
+ * left as it was.
+ *
+ * npm and Cargo require Semantic Versioning, so they get
+ * major.minor.patch with the build number as build metadata, for
+ * example 1.2.3+45, and any pre-release tag is kept.  pyproject.toml
+ * and pom.xml accept longer release numbers and get the full
+ * major.minor.build.patch; a qualifier such as -SNAPSHOT or rc1 after
+ * the number is kept.
+ */
+
+#pragma once
+#ifndef _Transform_Manifest_hpp_
+#define _Transform_Manifest_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+#include "ManifestScanner.hpp"
+
+#define NPM_KEY          "npm"
+#define NPM_PRETTY       "npm package.json"
+#define CARGO_KEY        "cargo"
+#define CARGO_PRETTY     "Rust Cargo.toml"
+#define PYPROJECT_KEY    "pyproject"
+#define PYPROJECT_PRETTY "Python pyproject.toml"
+#define MAVEN_KEY        "maven"
+#define MAVEN_PRETTY     "Maven pom.xml"
+
+class ManifestTransform
+  : public Transform
+{
+private:
+  ManifestFormat format_;
+
+public:
+  ManifestTransform(ManifestFormat);
+
+private:
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+  bool update_impl(VersionInfo &);
+  bool collect_edits(VersionInfo &, const std::string &, FileEditVector &);
+};
+
+class NpmTransform
+  : public ManifestTransform
+{
+private:
+  std::string name_ = NPM_PRETTY;
+
+public:
+  NpmTransform() : ManifestTransform(ManifestFormat::Npm) {}
+};
+
+class CargoTransform
+  : public ManifestTransform
+{
+private:
+  std::string name_ = CARGO_PRETTY;
+
+public:
+  CargoTransform() : ManifestTransform(ManifestFormat::Cargo) {}
+};
+
+class PyProjectTransform
+  : public ManifestTransform
+{
+private:
+  std::string name_ = PYPROJECT_PRETTY;
+
+public:
+  PyProjectTransform() : ManifestTransform(ManifestFormat::PyProject) {}
+};
+
+class MavenTransform
+  : public ManifestTransform
+{
+private:
+  std::string name_ = MAVEN_PRETTY;
+
+public:
+  MavenTransform() : ManifestTransform(ManifestFormat::Maven) {}
+};
+
+static const bool UNUSED_VARIABLE(registered_npm_transform) =
+  get_transform_factory().register_transform(
+    NPM_KEY,
+    NPM_PRETTY,
+    create_transform<NpmTransform>
+  );
+
+static const bool UNUSED_VARIABLE(registered_cargo_transform) =
+  get_transform_factory().register_transform(
+    CARGO_KEY,
+    CARGO_PRETTY,
+    create_transform<CargoTransform>
+  );
+
+static const bool UNUSED_VARIABLE(registered_pyproject_transform) =
+  get_transform_factory().register_transform(
+    PYPROJECT_KEY,
+    PYPROJECT_PRETTY,
+    create_transform<PyProjectTransform>
+  );
+
+static const bool UNUSED_VARIABLE(registered_maven_transform) =
+  get_transform_factory().register_transform(
+    MAVEN_KEY,
+    MAVEN_PRETTY,
+    create_transform<MavenTransform>
+  );
+
+#endif // !_Transform_Manifest_hpp_
+
+// Transform_Manifest.hpp ends here.
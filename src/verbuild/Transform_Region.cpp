@@ -0,0 +1,417 @@
+//
+// Transform_Region.cpp --- Marker region transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 19:55:36
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_Region.cpp
+ * @author Paul Ward
+ * @brief Marker region transform implementation.
+ */
+
+#include "Transform_Region.hpp"
+#include "Console.hpp"
+
+#include <charconv>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+
+using namespace std;
+
+#define MARKER_STEM     "verbuild:"
+#define MARKER_STEM_LEN 9
+
+// Characters that may close or open the comment around a marker.
+#define CLOSER_CHARS "-*/>#%}])"
+#define OPENER_CHARS "<!-*/#%{[(;"
+
+static inline
+bool
+is_blank(char c)
+{
+  return c == ' ' || c == '\t';
+}
+
+static inline
+bool
+is_word(char c)
+{
+  return c == '_' ||
+         (c >= '0' && c <= '9') ||
+         (c >= 'A' && c <= 'Z') ||
+         (c >= 'a' && c <= 'z');
+}
+
+static inline
+bool
+is_closer(char c)
+{
+  return c != '\0' && strchr(CLOSER_CHARS, c) != nullptr;
+}
+
+static inline
+bool
+is_opener(char c)
+{
+  return c != '\0' && strchr(OPENER_CHARS, c) != nullptr;
+}
+
+/*
+ * Skip forwards over characters matching `pred', or backwards from
+ * `p' down to `floor'.
+ */
+template <typename Pred>
+static inline
+const char *
+skip(const char *p, const char *end, Pred pred)
+{
+  while (p < end && pred(*p)) {
+    p++;
+  }
+
+  return p;
+}
+
+template <typename Pred>
+static inline
+const char *
+skip_back(const char *p, const char *floor, Pred pred)
+{
+  while (p > floor && pred(p[-1])) {
+    p--;
+  }
+
+  return p;
+}
+
+static
+size_t
+line_of(const char *data, size_t offset)
+{
+  size_t line = 1;
+
+  for (size_t i = 0; i < offset; i++) {
+    line += (data[i] == '\n');
+  }
+
+  return line;
+}
+
+/*
+ * Find the next `verbuild:' stem.  memchr does the scanning, and is
+ * vectorised by the C library; it looks for the colon, which is far
+ * rarer than any letter in prose, and the stem is checked backwards.
+ */
+static
+const char *
+find_stem(const char *p, const char *end)
+{
+  p += MARKER_STEM_LEN - 1;
+
+  while (p < end) {
+    const char *colon = static_cast<const char *>(memchr(p, ':', end - p));
+
+    if (colon == nullptr) {
+      return nullptr;
+    }
+
+    if (memcmp(colon - (MARKER_STEM_LEN - 1),
+               MARKER_STEM,
+               MARKER_STEM_LEN - 1) == 0) {
+      return colon - (MARKER_STEM_LEN - 1);
+    }
+
+    p = colon + 1;
+  }
+
+  return nullptr;
+}
+
+/*
+ * Does `word' follow at `p', ending at a word boundary?
+ */
+static inline
+bool
+has_word(const char *p, const char *end, const char *word)
+{
+  size_t len = strlen(word);
+
+  return static_cast<size_t>(end - p) >= len &&
+         memcmp(p, word, len) == 0 &&
+         (p + len == end || !is_word(p[len]));
+}
+
+/**
+ * @brief Find every marker region in a buffer.
+ * @param data The file contents.
+ * @param len Length of @c data.
+ * @param regions Receives the regions, in file order.
+ * @returns false, after reporting why, on unbalanced markers or an
+ *          unknown field name.
+ */
+bool
+find_regions(const char *data, size_t len, RegionVector &regions)
+{
+  const char *end  = data + len;
+  const char *p    = data;
+  bool        open = false;
+  Region      region {};
+
+  regions.clear();
+
+  while ((p = find_stem(p, end)) != nullptr) {
+    const char *marker = p;
+
+    p += MARKER_STEM_LEN;
+
+    if (has_word(p, end, "begin")) {
+      string field("version");
+
+      if (open) {
+        ESAY("Nested", REGION_BEGIN, "on line", line_of(data, marker - data));
+        return false;
+      }
+
+      p = skip(p + 5, end, is_blank);
+
+      if (p < end && is_word(*p)) {
+        const char *name = p;
+
+        while (p < end && is_word(*p)) {
+          p++;
+        }
+
+        field.assign(name, p - name);
+      }
+
+      if (!find_template_field(field, region.field)) {
+        ESAY("Unknown field `" + field + "' on line",
+             line_of(data, marker - data));
+        return false;
+      }
+
+      p = skip(p, end, is_blank);
+      p = skip(p, end, is_closer);
+
+      region.offset = p - data;
+      p             = skip(p, end, is_blank);
+
+      region.block = (p == end || *p == '\n' || *p == '\r');
+
+      if (region.block) {
+        region.newline = "\n";
+
+        if (p < end && *p == '\r') {
+          region.newline = "\r\n";
+          p++;
+        }
+
+        p             += (p < end && *p == '\n');
+        region.offset  = p - data;
+      }
+
+      open = true;
+    } else if (has_word(p, end, "end")) {
+      const char *stop  = marker;
+      const char *floor = data + region.offset;
+
+      if (!open) {
+        ESAY("Unmatched", REGION_END, "on line", line_of(data, marker - data));
+        return false;
+      }
+
+      if (region.block) {
+        stop = skip_back(stop, floor, [](char c) { return c != '\n'; });
+      } else {
+        stop          = skip_back(stop, floor, is_blank);
+        stop          = skip_back(stop, floor, is_opener);
+        stop          = skip_back(stop, floor, is_blank);
+        region.offset = skip(floor, stop, is_blank) - data;
+      }
+
+      region.length = (stop - data) - region.offset;
+      regions.push_back(region);
+
+      p    += 3;
+      open  = false;
+    }
+  }
+
+  if (open) {
+    ESAY("Unterminated", REGION_BEGIN, "before the end of the file.");
+    return false;
+  }
+
+  return true;
+}
+
+/*
+ * Parse `major.minor.build.patch', allowing fewer components.
+ */
+static
+bool
+parse_version(const char *p, const char *end, VersionInfo &vi)
+{
+  uint32_t nums[4] = { 0 };
+  int      count   = 0;
+
+  while (count < 4) {
+    auto res = from_chars(p, end, nums[count]);
+
+    if (res.ec != errc()) {
+      return false;
+    }
+
+    count++;
+    p = res.ptr;
+
+    if (p == end || *p != '.') {
+      break;
+    }
+
+    p++;
+  }
+
+  vi.set_major(nums[0]);
+  vi.set_minor(nums[1]);
+  vi.set_build(nums[2]);
+  vi.set_patch(nums[3]);
+
+  return true;
+}
+
+static
+bool
+read_region(VersionInfo &vi, const string &buffer, const Region &region)
+{
+  const char *p   = buffer.data() + region.offset;
+  const char *end = p + region.length;
+  uint32_t    value;
+
+  p = skip(p, end, is_blank);
+
+  if (region.field == TemplateField::Version) {
+    return parse_version(p, end, vi);
+  }
+
+  if (from_chars(p, end, value).ec != errc()) {
+    return false;
+  }
+
+  switch (region.field) {
+    case TemplateField::Major:    vi.set_major(value);     break;
+    case TemplateField::Minor:    vi.set_minor(value);     break;
+    case TemplateField::Build:    vi.set_build(value);     break;
+    case TemplateField::Patch:    vi.set_patch(value);     break;
+    case TemplateField::BaseYear: vi.set_base_year(value); break;
+    default:
+      return false;
+  }
+
+  return true;
+}
+
+static
+string
+render_region(const Region      &region,
+              const VersionInfo &vi,
+              const Config      &conf,
+              time_t             now)
+{
+  string text(format_field(region.field, vi, conf, now));
+
+  if (region.block) {
+    text.append(region.newline);
+  }
+
+  return text;
+}
+
+bool
+RegionTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  RegionVector regions;
+  bool         ok = false;
+
+  DSAY(DEBUG_MEDIUM, "Reading marker regions");
+
+  if (!find_regions(buffer.data(), buffer.size(), regions)) {
+    return false;
+  }
+
+  for (auto &it : regions) {
+    ok = read_region(vi, buffer, it) || ok;
+  }
+
+  return ok;
+}
+
+bool
+RegionTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  return write_edits(vi, strm);
+}
+
+bool
+RegionTransform::update_impl(VersionInfo &vi)
+{
+  return update_edits(vi);
+}
+
+/**
+ * @brief Replace the contents of every region.
+ */
+bool
+RegionTransform::collect_edits(VersionInfo    &vi,
+                               const string   &buffer,
+                               FileEditVector &edits)
+{
+  RegionVector regions;
+  time_t       now = time(nullptr);
+
+  if (!find_regions(buffer.data(), buffer.size(), regions)) {
+    return false;
+  }
+
+  if (regions.empty()) {
+    ESAY("No", REGION_BEGIN, "markers found in", conf_.filename);
+    return false;
+  }
+
+  for (auto &it : regions) {
+    edits.push_back(FileEdit {
+      it.offset,
+      it.length,
+      render_region(it, vi, conf_, now)
+    });
+  }
+
+  return true;
+}
+
+// Transform_Region.cpp ends here.
@@ -0,0 +1,105 @@
+//
+// Transform_Region.hpp --- Marker region transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 19:48:03
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_Region.hpp
+ * @author Paul Ward
+ * @brief Marker region transform interface.
+ *
+ * Keeps versions in files verbuild does not own.  Each region sits
+ * between two markers, usually inside comments:
+ *
+ *   Current release: <!-- verbuild:begin -->1.2.3.4<!-- verbuild:end -->
+ *
+ *   # verbuild:begin build
+ *   42
+ *   # verbuild:end
+ *
+ * The begin marker may name a template field, `version' by default.
+ * When the begin marker is the last thing on its line, the region is
+ * the whole lines up to the end marker's line; otherwise it is the
+ * text between the begin marker's comment closer and the end marker's
+ * comment opener, trimmed of blanks.  Only region contents change;
+ * the rest of the file is copied through untouched.
+ */
+
+#pragma once
+#ifndef _Transform_Region_hpp_
+#define _Transform_Region_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+#include "Template.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define REGION_KEY    "region"
+#define REGION_PRETTY "Marker regions"
+
+#define REGION_BEGIN "verbuild:begin"
+#define REGION_END   "verbuild:end"
+
+struct Region
+{
+  TemplateField field;          // What the region holds.
+  std::size_t   offset;         // First byte of the contents.
+  std::size_t   length;         // Length of the contents.
+  bool          block;          // Whole lines between the markers.
+  const char   *newline;        // Line ending used by a block region.
+};
+
+typedef std::vector<Region> RegionVector;
+
+class RegionTransform
+  : public Transform
+{
+private:
+  std::string name_ = REGION_PRETTY;
+
+private:
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+  bool update_impl(VersionInfo &);
+  bool collect_edits(VersionInfo &, const std::string &, FileEditVector &);
+};
+
+bool find_regions(const char *, std::size_t, RegionVector &);
+
+static const bool UNUSED_VARIABLE(registered_region_transform) =
+  get_transform_factory().register_transform(
+    REGION_KEY,
+    REGION_PRETTY,
+    create_transform<RegionTransform>
+  );
+
+#endif // !_Transform_Region_hpp_
+
+// Transform_Region.hpp ends here.
@@ -0,0 +1,116 @@
+//
+// Transform_Template.cpp --- Template-driven transform implementation.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:26:40
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Transform_Template.cpp
+ * @author Paul Ward
+ * @brief Template-driven transform implementation.
+ */
+
+#include "Transform_Template.hpp"
+#include "Console.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+using namespace std;
+
+bool
+TemplateTransform::compile()
+{
+  if (compiled_) {
+    return true;
+  }
+
+  if (conf_.template_file.empty()) {
+    ESAY("The template transform requires a template.");
+    return false;
+  }
+
+  ifstream strm(conf_.template_file, ios::binary);
+
+  if (!strm.good()) {
+    ESAY("Cannot open template", conf_.template_file);
+    return false;
+  }
+
+  try {
+    template_.compile(string((istreambuf_iterator<char>(strm)),
+                             istreambuf_iterator<char>()));
+  }
+  catch (runtime_error &e) {
+    ESAY(conf_.template_file + ":", e.what());
+    return false;
+  }
+
+  DSAY(DEBUG_HIGH,
+       "Compiled",
+       conf_.template_file,
+       "into",
+       template_.get_ops().size(),
+       "ops");
+  compiled_ = true;
+
+  return true;
+}
+
+bool
+TemplateTransform::read_impl(VersionInfo &vi, string &buffer)
+{
+  DSAY(DEBUG_MEDIUM, "Reading via template");
+
+  if (!compile()) {
+    return false;
+  }
+
+  if (!template_.match(buffer, conf_, vi)) {
+    WSAY("File does not match template", conf_.template_file);
+    return false;
+  }
+
+  return true;
+}
+
+bool
+TemplateTransform::write_impl(VersionInfo &vi, stringstream &strm)
+{
+  DSAY(DEBUG_MEDIUM, "Writing via template");
+
+  if (!compile()) {
+    return false;
+  }
+
+  strm << template_.render(vi, conf_);
+
+  return true;
+}
+
+// Transform_Template.cpp ends here.
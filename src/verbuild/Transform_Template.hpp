@@ -0,0 +1,74 @@
+//
+// Transform_Template.hpp --- Template-driven transform interface.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:22:05
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Transform_Template.hpp
+ * @author Paul Ward
+ * @brief Template-driven transform interface.
+ *
+ * Renders the template named by the `template' option.  Reading
+ * matches the existing file against the same template, so any format
+ * a template can describe round-trips without a dedicated transform.
+ */
+
+#pragma once
+#ifndef _Transform_Template_hpp_
+#define _Transform_Template_hpp_
+
+#include "Support.hpp"
+#include "Transform.hpp"
+#include "Template.hpp"
+
+#define TEMPLATE_KEY    "template"
+#define TEMPLATE_PRETTY "Template"
+
+class TemplateTransform
+  : public Transform
+{
+private:
+  std::string name_     = TEMPLATE_PRETTY;
+  Template    template_;
+  bool        compiled_ = false;
+
+private:
+  bool compile();
+  bool read_impl(VersionInfo &, std::string &);
+  bool write_impl(VersionInfo &, std::stringstream &);
+};
+
+static const bool UNUSED_VARIABLE(registered_template_transform) =
+  get_transform_factory().register_transform(
+    TEMPLATE_KEY,
+    TEMPLATE_PRETTY,
+    create_transform<TemplateTransform>
+  );
+
+#endif // !_Transform_Template_hpp_
+
+// Transform_Template.hpp ends here.
@@ -41,6 +41,14 @@
 #include <algorithm>
 #include <cstdlib>
 
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <process.h>
+# define get_pid() _getpid()
+#else
+# include <unistd.h>
+# define get_pid() getpid()
+#endif
+
 using namespace std;
 
 void
@@ -172,4 +180,16 @@ safe_stoi(const string &str,
   return res;
 }
 
+/**
+ * @brief Where to write @c path before renaming it into place.
+ *
+ * The name is unique to this process, so runs that replace the same
+ * file at once each write their own and the last rename wins whole.
+ */
+string
+temp_path(const string &path)
+{
+  return path + TEMP_SUFFIX + to_string(get_pid());
+}
+
 // Utils.cpp ends here.
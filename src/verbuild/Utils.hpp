@@ -47,6 +47,12 @@
 typedef std::vector<std::string> StringVector;
 typedef StringVector::iterator   StringVecIterator;
 
+/**
+ * @def TEMP_SUFFIX
+ * @brief Marks a file being written before it is renamed into place.
+ */
+#define TEMP_SUFFIX ".tmp"
+
 typedef std::pair<std::string, std::string> ListPair;
 typedef std::vector<ListPair>               ListPairVector;
 typedef ListPairVector::iterator            ListPairVecIterator;
@@ -73,6 +79,8 @@ std::string upcase_copy(std::string);
 
 uint32_t safe_stoi(const std::string &, size_t * = 0, int = 10);
 
+std::string temp_path(const std::string &);
+
 #endif // !_Utils_hpp_
 
 // Utils.hpp ends here.
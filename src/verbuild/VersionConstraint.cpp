@@ -0,0 +1,494 @@
+//
+// VersionConstraint.cpp --- Version constraints compiled to interval sets.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 13:16:49
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionConstraint.cpp
+ * @author Paul Ward
+ * @brief Version constraints compiled to interval sets.
+ */
+
+#include "VersionConstraint.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+
+using namespace std;
+
+static const VersionKey KEY_MIN = { 0, 0 };
+static const VersionKey KEY_MAX = { UINT64_MAX, UINT64_MAX };
+
+enum class ConstraintOp {
+  Eq,
+  Ne,
+  Lt,
+  Le,
+  Gt,
+  Ge,
+  Tilde,
+  Caret
+};
+
+// A version with its leading `given' fields set, the rest wildcards.
+struct Partial
+{
+  uint32_t field[4];
+  unsigned given;
+};
+
+/*
+ * Keys order as 128-bit integers, so the next and previous versions
+ * are an increment and a decrement with a carry between the words.
+ */
+static inline
+VersionKey
+successor(VersionKey key)
+{
+  key.lo++;
+  key.hi += (key.lo == 0);
+
+  return key;
+}
+
+static inline
+VersionKey
+predecessor(VersionKey key)
+{
+  key.hi -= (key.lo == 0);
+  key.lo--;
+
+  return key;
+}
+
+static inline
+VersionKey
+floor_key(const Partial &p)
+{
+  uint32_t f[4] = { 0, 0, 0, 0 };
+
+  copy(p.field, p.field + p.given, f);
+
+  return VersionKey::make(f[0], f[1], f[2], f[3]);
+}
+
+/*
+ * The first version past those that match the partial's fields up to
+ * and including `idx', with that field bumped.  False when there is
+ * none, because every field up to `idx' is at its maximum.
+ */
+static
+bool
+bump_key(const Partial &p, unsigned idx, VersionKey &key)
+{
+  uint32_t f[4] = { 0, 0, 0, 0 };
+
+  copy(p.field, p.field + idx + 1, f);
+
+  for (int i = static_cast<int>(idx); i >= 0; i--) {
+    if (f[i] < UINT32_MAX) {
+      f[i]++;
+      key = VersionKey::make(f[0], f[1], f[2], f[3]);
+      return true;
+    }
+
+    f[i] = 0;
+  }
+
+  return false;
+}
+
+static inline
+void
+add_interval(VersionIntervalVector &out, VersionKey lo, VersionKey hi)
+{
+  if (lo <= hi) {
+    out.push_back({ lo, hi });
+  }
+}
+
+/*
+ * Everything below `top', or everything when there is no top.
+ */
+static inline
+VersionKey
+below_top(bool has_top, const VersionKey &top)
+{
+  return has_top ? predecessor(top) : KEY_MAX;
+}
+
+static
+void
+comparator_set(ConstraintOp           op,
+               const Partial         &p,
+               VersionIntervalVector &out)
+{
+  VersionKey low = floor_key(p);
+  VersionKey top;
+  bool       has_top;
+  unsigned   idx;
+
+  out.clear();
+
+  if (p.given == 0) {
+    if (op != ConstraintOp::Lt && op != ConstraintOp::Gt &&
+        op != ConstraintOp::Ne) {
+      out.push_back({ KEY_MIN, KEY_MAX });
+    }
+
+    return;
+  }
+
+  has_top = bump_key(p, p.given - 1, top);
+
+  switch (op) {
+    case ConstraintOp::Eq:
+      add_interval(out, low, below_top(has_top, top));
+      break;
+
+    case ConstraintOp::Ne:
+      if (low != KEY_MIN) {
+        add_interval(out, KEY_MIN, predecessor(low));
+      }
+
+      if (has_top) {
+        add_interval(out, top, KEY_MAX);
+      }
+      break;
+
+    case ConstraintOp::Lt:
+      if (low != KEY_MIN) {
+        add_interval(out, KEY_MIN, predecessor(low));
+      }
+      break;
+
+    case ConstraintOp::Le:
+      add_interval(out, KEY_MIN, below_top(has_top, top));
+      break;
+
+    case ConstraintOp::Gt:
+      if (has_top) {
+        add_interval(out, top, KEY_MAX);
+      }
+      break;
+
+    case ConstraintOp::Ge:
+      add_interval(out, low, KEY_MAX);
+      break;
+
+    case ConstraintOp::Tilde:
+      idx     = (p.given >= 2) ? 1 : 0;
+      has_top = bump_key(p, idx, top);
+      add_interval(out, low, below_top(has_top, top));
+      break;
+
+    case ConstraintOp::Caret:
+      for (idx = 0; idx + 1 < p.given && p.field[idx] == 0; idx++) {
+      }
+
+      has_top = bump_key(p, idx, top);
+      add_interval(out, low, below_top(has_top, top));
+      break;
+  }
+}
+
+/*
+ * Both inputs sorted and disjoint, as is the result.
+ */
+static
+void
+intersect(const VersionIntervalVector &a,
+          const VersionIntervalVector &b,
+          VersionIntervalVector       &out)
+{
+  size_t i = 0;
+  size_t j = 0;
+
+  out.clear();
+
+  while (i < a.size() && j < b.size()) {
+    add_interval(out, max(a[i].lo, b[j].lo), min(a[i].hi, b[j].hi));
+
+    if (a[i].hi < b[j].hi) {
+      i++;
+    } else {
+      j++;
+    }
+  }
+}
+
+/*
+ * Sort and merge overlapping or touching intervals.
+ */
+static
+void
+normalise(VersionIntervalVector &v)
+{
+  size_t n = 0;
+
+  sort(v.begin(), v.end(),
+       [](const VersionInterval &a, const VersionInterval &b) {
+         return a.lo < b.lo;
+       });
+
+  for (size_t i = 0; i < v.size(); i++) {
+    if (n > 0 &&
+        (v[n - 1].hi == KEY_MAX || v[i].lo <= successor(v[n - 1].hi))) {
+      v[n - 1].hi = max(v[n - 1].hi, v[i].hi);
+    } else {
+      v[n++] = v[i];
+    }
+  }
+
+  v.resize(n);
+}
+
+static inline
+void
+skip_space(const char *&p, const char *end)
+{
+  while (p < end && (*p == ' ' || *p == '\t')) {
+    p++;
+  }
+}
+
+static
+bool
+parse_partial(const char *&p, const char *end, Partial &out)
+{
+  bool wild = false;
+
+  out = { { 0, 0, 0, 0 }, 0 };
+
+  for (unsigned i = 0; i < 4; i++) {
+    if (p < end && (*p == 'x' || *p == 'X' || *p == '*')) {
+      wild = true;
+      p++;
+    } else {
+      from_chars_result res = from_chars(p, end, out.field[i]);
+
+      if (res.ec != errc() || res.ptr == p || wild) {
+        return false;
+      }
+
+      p = res.ptr;
+      out.given++;
+    }
+
+    if (p == end || *p != '.') {
+      break;
+    }
+
+    p++;
+  }
+
+  return p == end || *p == ' ' || *p == '\t' || *p == '|';
+}
+
+static
+bool
+parse_op(const char *&p, const char *end, ConstraintOp &op)
+{
+  static const struct {
+    const char   *text;
+    ConstraintOp  op;
+  } ops[] = {
+    { "==", ConstraintOp::Eq },
+    { "!=", ConstraintOp::Ne },
+    { "<=", ConstraintOp::Le },
+    { ">=", ConstraintOp::Ge },
+    { "=",  ConstraintOp::Eq },
+    { "<",  ConstraintOp::Lt },
+    { ">",  ConstraintOp::Gt },
+    { "~",  ConstraintOp::Tilde },
+    { "^",  ConstraintOp::Caret },
+  };
+
+  for (auto &it : ops) {
+    size_t len = char_traits<char>::length(it.text);
+
+    if (static_cast<size_t>(end - p) >= len &&
+        char_traits<char>::compare(p, it.text, len) == 0) {
+      p  += len;
+      op  = it.op;
+      return true;
+    }
+  }
+
+  op = ConstraintOp::Eq;
+
+  return false;
+}
+
+VersionConstraint::VersionConstraint()
+  : intervals_(),
+    error_()
+{}
+
+VersionConstraint::~VersionConstraint()
+{}
+
+/**
+ * @brief Compile a constraint.
+ * @param expr The constraint; empty matches every version.
+ * @returns false on a syntax error, described by @c get_error.
+ */
+bool
+VersionConstraint::parse(const string &expr)
+{
+  const char           *p   = expr.data();
+  const char           *end = p + expr.size();
+  VersionIntervalVector all;
+  VersionIntervalVector alt;
+  VersionIntervalVector one;
+  VersionIntervalVector range;
+  VersionIntervalVector tmp;
+
+  intervals_.clear();
+  error_.clear();
+
+  for (;;) {
+    alt.assign(1, { KEY_MIN, KEY_MAX });
+    skip_space(p, end);
+
+    // The comparators of one alternative.
+    while (p < end && *p != '|') {
+      const char  *at = p;
+      ConstraintOp op;
+      bool         has_op;
+      Partial      ver;
+
+      has_op = parse_op(p, end, op);
+      skip_space(p, end);
+
+      if (!parse_partial(p, end, ver)) {
+        error_ = "Expected a version at `" + string(at, end) + "'";
+        return false;
+      }
+
+      comparator_set(op, ver, one);
+
+      // `A - B'.
+      if (!has_op) {
+        const char *q = p;
+        Partial     upper;
+
+        skip_space(q, end);
+
+        if (q < end && *q == '-') {
+          q++;
+          skip_space(q, end);
+
+          if (!parse_partial(q, end, upper)) {
+            error_ = "Expected a version after `-' in `" +
+                     string(at, end) + "'";
+            return false;
+          }
+
+          comparator_set(ConstraintOp::Ge, ver, range);
+          comparator_set(ConstraintOp::Le, upper, tmp);
+          intersect(range, tmp, one);
+          p = q;
+        }
+      }
+
+      intersect(alt, one, tmp);
+      alt.swap(tmp);
+      skip_space(p, end);
+    }
+
+    all.insert(all.end(), alt.begin(), alt.end());
+
+    if (p == end) {
+      break;
+    }
+
+    if (end - p < 2 || p[1] != '|') {
+      error_ = "Expected `||' at `" + string(p, end) + "'";
+      return false;
+    }
+
+    p += 2;
+  }
+
+  normalise(all);
+  intervals_.swap(all);
+
+  return true;
+}
+
+const string &
+VersionConstraint::get_error() const
+{
+  return error_;
+}
+
+const VersionIntervalVector &
+VersionConstraint::get_intervals() const
+{
+  return intervals_;
+}
+
+/**
+ * @brief Test one version.
+ */
+bool
+VersionConstraint::matches(const VersionKey &key) const
+{
+  auto it = upper_bound(intervals_.begin(), intervals_.end(), key,
+                        [](const VersionKey &k, const VersionInterval &i) {
+                          return k < i.lo;
+                        });
+
+  return it != intervals_.begin() && key <= (it - 1)->hi;
+}
+
+/**
+ * @brief Test many versions.
+ * @param keys The versions.
+ * @param count Number of versions.
+ * @param out Receives 1 for each version that matches, 0 otherwise.
+ * @returns The number that match.
+ */
+size_t
+VersionConstraint::match(const VersionKey *keys,
+                         size_t            count,
+                         uint8_t          *out) const
+{
+  size_t found = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    out[i]  = matches(keys[i]) ? 1 : 0;
+    found  += out[i];
+  }
+
+  return found;
+}
+
+// VersionConstraint.cpp ends here.
@@ -0,0 +1,96 @@
+//
+// VersionConstraint.hpp --- Version constraints compiled to interval sets.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    21 Oct 2026 13:05:26
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file VersionConstraint.hpp
+ * @author Paul Ward
+ * @brief Version constraints compiled to interval sets.
+ *
+ * A constraint is one or more alternatives separated by `||', each a
+ * list of comparators that must all hold:
+ *
+ *   >=1.2.0 <2.0.0 || ~3.4
+ *
+ * Comparators are `=', `!=', `<', `<=', `>', `>=', `~' and `^'
+ * followed by a version of one to four fields, any of which may be
+ * `x', `X' or `*'.  `A - B' is an inclusive range.  A version that
+ * leaves fields out stands for all the versions it covers, so `<=1.2'
+ * takes in 1.2.9.9 and `~1.2' is 1.2 up to, but not including, 1.3.
+ * `~' lets fields after the minor number change, or after the major
+ * when only that is given; `^' lets fields after the first non-zero
+ * one change.
+ *
+ * Compiling produces a sorted list of disjoint closed intervals of
+ * @c VersionKey, so testing a version is a binary search however
+ * complex the expression.
+ */
+
+#pragma once
+#ifndef _VersionConstraint_hpp_
+#define _VersionConstraint_hpp_
+
+#include "Support.hpp"
+#include "VersionKey.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct VersionInterval
+{
+  VersionKey lo;                // Inclusive.
+  VersionKey hi;                // Inclusive.
+};
+
+typedef std::vector<VersionInterval> VersionIntervalVector;
+
+class VersionConstraint
+{
+private:
+  VersionIntervalVector intervals_;
+  std::string           error_;
+
+public:
+  VersionConstraint();
+  ~VersionConstraint();
+
+  bool parse(const std::string &);
+
+  const std::string           &get_error() const;
+  const VersionIntervalVector &get_intervals() const;
+
+  bool        matches(const VersionKey &) const;
+  std::size_t match(const VersionKey *, std::size_t, std::uint8_t *) const;
+};
+
+#endif // !_VersionConstraint_hpp_
+
+// VersionConstraint.hpp ends here.
@@ -34,27 +34,17 @@
  */
  
 #include "VersionInfo.hpp"
-#include "Utils.hpp"
+#include "BuildDate.hpp"
 
-#include <climits>
 #include <iostream>
-#include <iomanip>
-#include <sstream>
-#include <cstdlib>
-#include <regex>
-
-#include <boost/format.hpp>
+#include <stdexcept>
 
 using namespace std;
 namespace       date = boost::gregorian;
 
 VersionInfo::VersionInfo()
-  : major_(0),
-    minor_(0),
-    build_(0),
-    patch_(0),
-    base_year_(0),
-    incr_type_(IncrementType::Simple)
+  : value_(),
+    policy_(nullptr)
 {}
 
 VersionInfo::VersionInfo(const uint32_t major,
@@ -63,12 +53,13 @@ VersionInfo::VersionInfo(const uint32_t major,
                          const uint32_t patch     = 0,
                          const uint32_t baseyear  = 0,
                          const IncrementType type = IncrementType::Simple)
-  : major_(major),
-    minor_(minor),
-    build_(build),
-    patch_(patch),
-    base_year_(baseyear),
-    incr_type_(type)
+  : value_ { major, minor, build, patch, baseyear, type },
+    policy_(nullptr)
+{}
+
+VersionInfo::VersionInfo(const VersionValue &value)
+  : value_(value),
+    policy_(nullptr)
 {}
 
 VersionInfo::~VersionInfo()
@@ -77,393 +68,239 @@ VersionInfo::~VersionInfo()
 const uint32_t &
 VersionInfo::get_major() const
 {
-  return major_;
+  return value_.major;
 }
 
 const uint32_t &
 VersionInfo::get_minor() const
 {
-  return minor_;
+  return value_.minor;
 }
 
 const uint32_t &
 VersionInfo::get_build() const
 {
-  return build_;
+  return value_.build;
 }
 
 const uint32_t &
 VersionInfo::get_patch() const
 {
-  return patch_;
+  return value_.patch;
 }
 
 const uint32_t &
 VersionInfo::get_base_year() const
 {
-  return base_year_;
+  return value_.base_year;
 }
 
 const IncrementType &
 VersionInfo::get_increment_type() const
 {
-  return incr_type_;
+  return value_.type;
+}
+
+IncrementPolicy *
+VersionInfo::get_increment_policy() const
+{
+  return policy_;
+}
+
+const VersionValue &
+VersionInfo::get_value() const
+{
+  return value_;
 }
 
 void
 VersionInfo::set_major(const uint32_t major)
 {
   DSAY(DEBUG_HIGH, "Setting major to", major);
-  major_ = major;
+  value_.major = major;
 }
 
 void
 VersionInfo::set_minor(const uint32_t minor)
 {
   DSAY(DEBUG_HIGH, "Setting minor to", minor);
-  minor_ = minor;
+  value_.minor = minor;
 }
 
 void
 VersionInfo::set_build(const uint32_t build)
 {
   DSAY(DEBUG_HIGH, "Setting build to", build);
-  build_ = build;
+  value_.build = build;
 }
 
 void
 VersionInfo::set_patch(const uint32_t patch)
 {
   DSAY(DEBUG_HIGH, "Setting patch to", patch);
-  patch_ = patch;
+  value_.patch = patch;
 }
 
 void
 VersionInfo::set_base_year(const uint32_t year)
 {
   DSAY(DEBUG_HIGH, "Setting base year to", year);
-  base_year_ = year;
+  value_.base_year = year;
 }
 
 void
 VersionInfo::set_increment_type(const IncrementType type)
 {
   DSAY(DEBUG_HIGH, "Setting increment type to", type);
-  incr_type_ = type;
+  value_.type = type;
 }
 
 void
-VersionInfo::increment(const IncrementMode mode)
+VersionInfo::set_increment_policy(IncrementPolicy *policy)
 {
-  DSAY(DEBUG_LOW, "Performing increment");
-
-  if ((mode & IncrementMode::Major) == IncrementMode::Major) {
-    major_ = incr(major_);
-  }
+  DSAY(DEBUG_HIGH, "Setting increment policy");
+  policy_ = policy;
+}
 
-  if ((mode & IncrementMode::Minor) == IncrementMode::Minor) {
-    minor_ = incr(minor_);
-  }
+/**
+ * @brief Replace the numbers, base year and type; the policy is
+ * kept.
+ */
+void
+VersionInfo::set_value(const VersionValue &value)
+{
+  DSAY(DEBUG_HIGH, "Setting version to", value);
+  value_ = value;
+}
 
-  if ((mode & IncrementMode::Build) == IncrementMode::Build) {
-    perform();
-  }
+/**
+ * @brief Today's local date, for @c VersionValue::increment.
+ */
+VersionDate
+VersionInfo::today()
+{
+  date::date current(date::day_clock::local_day());
 
-  if ((mode & IncrementMode::Patch) == IncrementMode::Patch) {
-    patch_ = incr(patch_);
-  }
+  return VersionDate {
+    static_cast<uint32_t>(current.year()),
+    static_cast<uint32_t>(current.month()),
+    static_cast<uint32_t>(current.day())
+  };
 }
 
-string
-VersionInfo::to_string() const
+/**
+ * @brief Increment the fields selected by @c mode.
+ * @returns false if the increment policy failed; the version is then
+ *          left as it was.
+ */
+bool
+VersionInfo::increment(const IncrementMode mode)
 {
-  stringstream ss;
+  VersionValue  saved = value_;
+  VersionStatus status;
 
-  ss << major_ << "."
-     << minor_ << "."
-     << build_ << "."
-     << patch_;
+  DSAY(DEBUG_LOW, "Performing increment");
 
-  return ss.str();
-}
+  // The patch is bumped after any policy has run, so that the policy
+  // sees the same fields it always has.
+  status = value_.increment(mode & ~IncrementMode::Patch, today());
 
-date::date
-VersionInfo::to_date() const
-{
-  date::date result;
+  switch (status) {
+    case VersionStatus::Ok:
+      DSAY(DEBUG_VERYHIGH, "build now", value_.build);
+      break;
 
-  DSAY(DEBUG_LOW, "Starting conversion to date.");
+    case VersionStatus::OutOfRange:
+      ESAY("Build number for", value_.type, "is out of range, set to 0.");
+      break;
 
-  if (build_ > 0 && base_year_ > 0) {
-    switch (incr_type_) {
-      case IncrementType::ByDate:
-        DSAY(DEBUG_MEDIUM, "Treating build number as date.");
-        {
-          stringstream ss;
-
-          ss << build_;
-
-          DSAY(DEBUG_HIGH, "Generating date.");
-          try {
-            result = date::date(date::from_undelimited_string(ss.str()));
-          }
-          catch (date::bad_month &e) {
-            ESAY("Bad month:", e.what());
-            FATAL("Terminating.");
-            exit(EXIT_FAILURE);
-          }
-          catch (date::bad_year &e) {
-            ESAY("Bad year:", e.what());
-            FATAL("Terminating.");
-            exit(EXIT_FAILURE);
-          }
-          catch (date::bad_day_of_month &e) {
-            ESAY("Bad day of month:", e.what());
-            FATAL("Terminating.");
-            exit(EXIT_FAILURE);
-          }
-          catch (exception &e) {
-            ESAY("Caught unhandled exception:", e.what(), ". Internal name:", typeid(e).name());
-            FATAL("Terminating.");
-            exit(EXIT_FAILURE);
-          }
-
-        }
-        break;
-
-      case IncrementType::ByYears:
-        DSAY(DEBUG_MEDIUM, "Treating build number as year offset.");
-        {
-          stringstream ss;
-          uint32_t     dd      = 0;
-          uint32_t     mm      = 0;
-          uint32_t     yy      = 0;
-          bool         ok      = true;
-          bool         matched = false;
-          string       str;
-
-          ss << build_;
-          str = ss.str();
-
-          if (str.length() > 3) {
-            regex  re("(\\d*)(\\d{2,2})(\\d{2,2})");
-            smatch matches;
-
-            matched = regex_match(str, matches, re);
-            DSAY(DEBUG_HIGH, "Matched", matches.size(), "via regex.");
-
-            if (matched && matches.size() == 4) {
-              yy = static_cast<uint32_t>(safe_stoi(matches[1]));
-              mm = static_cast<uint32_t>(safe_stoi(matches[2]));
-              dd = static_cast<uint32_t>(safe_stoi(matches[3]));
-              DSAY(DEBUG_VERYHIGH, "Years:", yy, " Months:", mm, " Days:", dd);
-            } else {
-              DSAY(DEBUG_VERYHIGH, "Regex failed to match.");
-              ok = false;
-            }
-          } else {
-            regex  re("(\\d{1,2})(\\d{2,2})");
-            smatch matches;
-
-            matched = regex_match(str, matches, re);
-            DSAY(DEBUG_HIGH, "Matched", matches.size(), "via regex.");
-
-            if (matched && matches.size() == 3) {
-              yy = 0;
-              mm = static_cast<uint32_t>(safe_stoi(matches[1]));
-              dd = static_cast<uint32_t>(safe_stoi(matches[2]));
-              DSAY(DEBUG_VERYHIGH, "Years:", yy, " Months:", mm, " Days:", dd);
-            } else {
-              DSAY(DEBUG_VERYHIGH, "Regex failed to match.");
-              ok = false;
-            }
-          }
-
-          if (ok) {
-            DSAY(DEBUG_HIGH, "Generating date.");
-
-            stringstream ss;
-
-            ss << base_year_ + yy
-               << setfill('0') << setw(2)
-               << mm << dd;
-
-            try {
-              result = date::date(date::from_undelimited_string(ss.str()));
-            }
-            /* XXX MOAR HERE */
-            catch (date::bad_day_of_month &e) {
-              ESAY("Bad day of month:", e.what());
-              FATAL("Terminating.");
-              exit(EXIT_FAILURE);
-            }
-            catch (...) {
-              ESAY("Caught unhandled exception.");
-              FATAL("Terminating.");
-              exit(EXIT_FAILURE);
-            }
-          }
-        }
-        break;
-
-      case IncrementType::ByMonths:
-        DSAY(DEBUG_MEDIUM, "Treating build number as month offset.");
-        DSAY(DEBUG_HIGH, "Generating date.");
-
-        try {
-          result  = date::date(base_year_, 1, build_ % 100);
-          result += date::months((build_ / 100) - 1);
-        }
-        /* XXX MOAR HERE */
-        catch (date::bad_day_of_month &e) {
-          ESAY("Bad day of month:", e.what());
-          FATAL("Terminating.");
-          exit(EXIT_FAILURE);
-        }
-        catch (...) {
-          ESAY("Caught unhandled exception.");
-          FATAL("Terminating.");
-          exit(EXIT_FAILURE);
-        }
-        break;
-
-      case IncrementType::Simple:
-        result = date::day_clock::local_day();
-        break;
-
-      default:
-        throw invalid_argument("Unhandled increment type");
-    }
+    case VersionStatus::NeedsPolicy:
+      DSAY(DEBUG_MEDIUM, "Incrementing by policy.");
+      if (policy_ == nullptr) {
+        throw invalid_argument("No increment policy set");
+      }
+
+      if (!policy_->apply(*this)) {
+        ESAY("Increment policy failed, version left unchanged.");
+        value_ = saved;
+        return false;
+      }
+      break;
   }
 
-  return result;
-}
+  value_.increment(mode & IncrementMode::Patch, VersionDate());
 
-bool
-VersionInfo::operator==(const VersionInfo &other)
-{
-  return (major_ == other.major_)
-      && (minor_ == other.minor_)
-      && (build_ == other.build_)
-      && (patch_ == other.patch_);
+  return true;
 }
 
-bool
-VersionInfo::operator!=(const VersionInfo &other)
+string
+VersionInfo::to_string() const
 {
-  return (major_ != other.major_)
-      || (minor_ != other.minor_)
-      || (build_ != other.build_)
-      || (patch_ != other.patch_);
+  return value_.to_string();
 }
 
-uint32_t
-VersionInfo::incr(const uint32_t lhs) const
+/**
+ * @brief Pack the version into a sortable key.
+ */
+VersionKey
+VersionInfo::to_key() const
 {
-  // This is just to be safe... 
-  if ((UINT_MAX - 1) < lhs) {
-    return UINT_MAX;
-  }
-
-  return lhs + 1;
+  return value_.to_key();
 }
 
-uint32_t
-VersionInfo::add(const uint32_t lhs, const uint32_t rhs) const
+date::date
+VersionInfo::to_date() const
 {
-  // This is just to be safe...
-  if ((UINT_MAX - rhs) < lhs) {
-    return UINT_MAX;
-  }
-
-  return lhs + rhs;
-}
+  BuildDateStatus status;
+  int32_t         days;
 
-void
-VersionInfo::perform()
-{
-  switch (incr_type_) {
-    case IncrementType::Simple:
-      build_++;
-      break;
+  DSAY(DEBUG_LOW, "Starting conversion to date.");
 
+  switch (value_.type) {
+    case IncrementType::ByDate:
+    case IncrementType::ByYears:
     case IncrementType::ByMonths:
-      DSAY(DEBUG_MEDIUM, "Incrementing by month offset.");
-      if (base_year_ > 0) {
-        date::date current(date::day_clock::local_day());
-
-        build_ = add((current.year() - base_year_) * 12,
-                     (int)current.month());
-        build_ = add(build_ * 100, current.day());
-        DSAY(DEBUG_VERYHIGH, "build now", build_);
+      status = decode_build_date(value_.type,
+                                 value_.base_year,
+                                 value_.build,
+                                 days);
+
+      if (status == BuildDateStatus::Ok) {
+        return date::date(1970, 1, 1) + date::days(days);
       }
-      break;
 
-    case IncrementType::ByYears:
-      DSAY(DEBUG_MEDIUM, "Incrementing by year offset.");
-      {
-        date::date   current(date::day_clock::local_day());
-        stringstream ss;
-
-        ss << current.year() - base_year_
-           << setfill('0') << setw(2)
-           << (int)current.month()      // Defaults to month name, see.
-           << current.day();
-
-        try {
-          DSAY(DEBUG_VERYHIGH, "setting build to", ss.str());
-          build_ = static_cast<uint32_t>(safe_stoi(ss.str()));
-        }
-        catch (invalid_argument &e) {
-          ESAY("Invalid argument:", e.what());
-          build_ = 0;
-        }
-        catch (out_of_range &e) {
-          ESAY("Out of range:", e.what());
-          build_ = 0;
-        }
-        catch (...) {
-          ESAY("Caught unhandled exception.");
-          FATAL("Terminating.");
-          exit(EXIT_FAILURE);
-        }
+      if (status != BuildDateStatus::NoDate) {
+        ESAY("Build number", value_.build, "is not a valid date:", status);
       }
       break;
 
-    case IncrementType::ByDate:
-      DSAY(DEBUG_MEDIUM, "Incrementing by date.");
-      {
-        date::date   current(date::day_clock::local_day());
-        stringstream ss;
-
-        ss << current.year()
-           << setfill('0') << setw(2)
-           << (int)current.month()      // Defaults to month, see.
-           << current.day();
-
-        try {
-          DSAY(DEBUG_VERYHIGH, "setting build to", ss.str());
-          build_ = static_cast<uint32_t>(safe_stoi(ss.str()));
-        }
-        catch (invalid_argument &e) {
-          ESAY("Invalid argument:", e.what());
-          build_ = 0;
-        }
-        catch (out_of_range &e) {
-          ESAY("Out of range:", e.what());
-          build_ = 0;
-        }
-        catch (...) {
-          ESAY("Caught unhandled exception.");
-          FATAL("Terminating.");
-          exit(EXIT_FAILURE);
-        }
+    case IncrementType::Simple:
+    case IncrementType::Script:
+    case IncrementType::GitTag:
+    case IncrementType::GitSha:
+    case IncrementType::GitCount:
+      if (value_.build > 0 && value_.base_year > 0) {
+        return date::day_clock::local_day();
       }
       break;
 
     default:
       throw invalid_argument("Unhandled increment type");
   }
+
+  return date::date();
+}
+
+bool
+VersionInfo::operator==(const VersionInfo &other) const
+{
+  return value_ == other.value_;
+}
+
+bool
+VersionInfo::operator!=(const VersionInfo &other) const
+{
+  return value_ != other.value_;
 }
 
 ostream &
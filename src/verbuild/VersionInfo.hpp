@@ -34,6 +34,9 @@
 #include "Support.hpp"
 #include "Console.hpp"
 #include "Enums.hpp"
+#include "IncrementPolicy.hpp"
+#include "VersionKey.hpp"
+#include "VersionValue.hpp"
 
 #include <string>
 
@@ -45,17 +48,17 @@ namespace date = boost::gregorian;
  * @file VersionInfo.hpp
  * @author Paul Ward
  * @brief Version information class.
+ *
+ * Wraps a @c VersionValue with the parts that cannot be plain data:
+ * debug logging and the increment policy.  Use
+ * @c get_value to copy the numbers out.
  */
 
 class VersionInfo
 {
 private:
-  std::uint32_t major_;
-  std::uint32_t minor_;
-  std::uint32_t build_;
-  std::uint32_t patch_;
-  std::uint32_t base_year_;
-  IncrementType incr_type_;
+  VersionValue     value_;
+  IncrementPolicy *policy_;
 
 public:
   VersionInfo();
@@ -68,6 +71,7 @@ public:
               const std::uint32_t,      // patch
               const std::uint32_t,      // base year
               IncrementType);
+  explicit VersionInfo(const VersionValue &);
 
   const std::uint32_t &get_major() const;
   const std::uint32_t &get_minor() const;
@@ -75,6 +79,8 @@ public:
   const std::uint32_t &get_patch() const;
   const std::uint32_t &get_base_year() const;
   const IncrementType &get_increment_type() const;
+  IncrementPolicy     *get_increment_policy() const;
+  const VersionValue  &get_value() const;
 
   void set_major(const std::uint32_t);
   void set_minor(const std::uint32_t);
@@ -82,21 +88,21 @@ public:
   void set_patch(const std::uint32_t);
   void set_base_year(const std::uint32_t);
   void set_increment_type(const IncrementType);
+  void set_increment_policy(IncrementPolicy *);
+  void set_value(const VersionValue &);
 
-  void increment(const IncrementMode);
+  bool increment(const IncrementMode);
 
   std::string to_string() const;
   date::date  to_date() const;
+  VersionKey  to_key() const;
 
-  bool operator==(const VersionInfo &);
-  bool operator!=(const VersionInfo &);
+  bool operator==(const VersionInfo &) const;
+  bool operator!=(const VersionInfo &) const;
 
   friend std::ostream &operator<<(std::ostream &, const VersionInfo &);
 
-private:
-  std::uint32_t incr(const std::uint32_t) const;
-  std::uint32_t add(const std::uint32_t, const std::uint32_t) const;
-  void          perform();
+  static VersionDate today();
 };
 
 #endif // !__VersionInfo_hpp__
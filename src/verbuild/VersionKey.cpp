@@ -0,0 +1,218 @@
+//
+// VersionKey.cpp --- Packed sortable version keys.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 13:40:05
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionKey.cpp
+ * @author Paul Ward
+ * @brief Packed sortable version keys.
+ */
+
+#include "VersionKey.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+using namespace std;
+
+#define RADIX_BITS    8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_DIGITS  (128 / RADIX_BITS)
+
+std::ostream &
+operator<<(std::ostream &os, const VersionKey &key)
+{
+  os << key.get_major() << '.'
+     << key.get_minor() << '.'
+     << key.get_build() << '.'
+     << key.get_patch();
+
+  return os;
+}
+
+/**
+ * @brief Parse `MAJOR[.MINOR[.BUILD[.PATCH]]]'.
+ * @returns false unless the text is one to four dotted 32-bit numbers.
+ *
+ * Missing fields are zero.
+ */
+bool
+parse_version_key(string_view text, VersionKey &key)
+{
+  const char *p     = text.data();
+  const char *end   = p + text.size();
+  uint32_t    v[4]  = { 0, 0, 0, 0 };
+  unsigned    count = 0;
+
+  for (;;) {
+    from_chars_result res = from_chars(p, end, v[count]);
+
+    if (res.ec != errc() || res.ptr == p) {
+      return false;
+    }
+
+    p = res.ptr;
+    count++;
+
+    if (p == end) {
+      break;
+    }
+
+    if (*p != '.' || count == 4) {
+      return false;
+    }
+
+    p++;
+  }
+
+  key = VersionKey::make(v[0], v[1], v[2], v[3]);
+
+  return true;
+}
+
+static inline
+unsigned
+digit(const VersionKey &key, unsigned which)
+{
+  uint64_t word = (which < RADIX_DIGITS / 2) ? key.lo : key.hi;
+
+  return static_cast<unsigned>(word >> ((which % (RADIX_DIGITS / 2)) *
+                                        RADIX_BITS)) & (RADIX_BUCKETS - 1);
+}
+
+/**
+ * @brief Sort keys in ascending order.
+ * @param keys The keys.
+ * @param count Number of keys.
+ *
+ * An LSD radix sort a byte at a time.  A byte that is the same in
+ * every key, as the high bytes of each field usually are, costs no
+ * pass at all, and the histograms for the rest are built in a single
+ * read of the input.
+ */
+void
+sort_version_keys(VersionKey *keys, size_t count)
+{
+  vector<size_t>    hist(RADIX_DIGITS * RADIX_BUCKETS, 0);
+  VersionKeyVector  tmp;
+  VersionKey       *src;
+  VersionKey       *dst;
+  unsigned          digits[RADIX_DIGITS];
+  unsigned          passes = 0;
+  uint64_t          diff_hi = 0;
+  uint64_t          diff_lo = 0;
+
+  if (count < VKEY_RADIX_MIN) {
+    sort(keys, keys + count);
+    return;
+  }
+
+  // Bytes that are the same in every key need no pass.
+  for (size_t i = 1; i < count; i++) {
+    diff_hi |= keys[i].hi ^ keys[0].hi;
+    diff_lo |= keys[i].lo ^ keys[0].lo;
+  }
+
+  for (unsigned d = 0; d < RADIX_DIGITS; d++) {
+    if (digit(VersionKey { diff_hi, diff_lo }, d) != 0) {
+      digits[passes++] = d;
+    }
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    for (unsigned p = 0; p < passes; p++) {
+      hist[p * RADIX_BUCKETS + digit(keys[i], digits[p])]++;
+    }
+  }
+
+  tmp.resize(count);
+  src = keys;
+  dst = tmp.data();
+
+  for (unsigned p = 0; p < passes; p++) {
+    size_t  *counts = &hist[p * RADIX_BUCKETS];
+    size_t   offset = 0;
+    unsigned d      = digits[p];
+
+    for (unsigned b = 0; b < RADIX_BUCKETS; b++) {
+      size_t n = counts[b];
+
+      counts[b]  = offset;
+      offset    += n;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      dst[counts[digit(src[i], d)]++] = src[i];
+    }
+
+    swap(src, dst);
+  }
+
+  if (src != keys) {
+    ::memcpy(keys, src, count * sizeof(VersionKey));
+  }
+}
+
+/**
+ * @brief Drop repeated keys from a sorted array.
+ * @returns The number of distinct keys, which now lead the array.
+ */
+size_t
+unique_version_keys(VersionKey *keys, size_t count)
+{
+  return static_cast<size_t>(unique(keys, keys + count) - keys);
+}
+
+/**
+ * @brief Find the least and greatest keys.
+ * @returns false if there are no keys.
+ */
+bool
+minmax_version_keys(const VersionKey *keys,
+                    size_t            count,
+                    VersionKey       &lowest,
+                    VersionKey       &highest)
+{
+  if (count == 0) {
+    return false;
+  }
+
+  lowest  = keys[0];
+  highest = keys[0];
+
+  for (size_t i = 1; i < count; i++) {
+    lowest  = (keys[i] < lowest)  ? keys[i] : lowest;
+    highest = (highest < keys[i]) ? keys[i] : highest;
+  }
+
+  return true;
+}
+
+// VersionKey.cpp ends here.
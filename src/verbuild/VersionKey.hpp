@@ -0,0 +1,153 @@
+//
+// VersionKey.hpp --- Packed sortable version keys.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 13:31:22
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file VersionKey.hpp
+ * @author Paul Ward
+ * @brief Packed sortable version keys.
+ *
+ * A version packed into two 64-bit words, major and minor in the high
+ * word and build and patch in the low, so that comparing the words in
+ * order compares the versions field by field.  Keys are trivially
+ * copyable and can be sorted, deduplicated and scanned in bulk.
+ */
+
+#pragma once
+#ifndef _VersionKey_hpp_
+#define _VersionKey_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @def VKEY_RADIX_MIN
+ * @brief Arrays shorter than this are sorted with @c std::sort.
+ */
+#define VKEY_RADIX_MIN 256
+
+struct VersionKey
+{
+  std::uint64_t hi;             // major << 32 | minor
+  std::uint64_t lo;             // build << 32 | patch
+
+  static constexpr VersionKey make(std::uint32_t major,
+                                   std::uint32_t minor,
+                                   std::uint32_t build,
+                                   std::uint32_t patch)
+  {
+    return VersionKey {
+      (static_cast<std::uint64_t>(major) << 32) | minor,
+      (static_cast<std::uint64_t>(build) << 32) | patch
+    };
+  }
+
+  constexpr std::uint32_t get_major() const
+  {
+    return static_cast<std::uint32_t>(hi >> 32);
+  }
+
+  constexpr std::uint32_t get_minor() const
+  {
+    return static_cast<std::uint32_t>(hi);
+  }
+
+  constexpr std::uint32_t get_build() const
+  {
+    return static_cast<std::uint32_t>(lo >> 32);
+  }
+
+  constexpr std::uint32_t get_patch() const
+  {
+    return static_cast<std::uint32_t>(lo);
+  }
+};
+
+static_assert(std::is_trivially_copyable<VersionKey>::value,
+              "VersionKey must be trivially copyable");
+static_assert(sizeof(VersionKey) == 16, "VersionKey must be 128 bits");
+
+typedef std::vector<VersionKey> VersionKeyVector;
+
+constexpr bool
+operator==(const VersionKey &a, const VersionKey &b)
+{
+  return a.hi == b.hi && a.lo == b.lo;
+}
+
+constexpr bool
+operator!=(const VersionKey &a, const VersionKey &b)
+{
+  return !(a == b);
+}
+
+constexpr bool
+operator<(const VersionKey &a, const VersionKey &b)
+{
+  return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+constexpr bool
+operator>(const VersionKey &a, const VersionKey &b)
+{
+  return b < a;
+}
+
+constexpr bool
+operator<=(const VersionKey &a, const VersionKey &b)
+{
+  return !(b < a);
+}
+
+constexpr bool
+operator>=(const VersionKey &a, const VersionKey &b)
+{
+  return !(a < b);
+}
+
+std::ostream &operator<<(std::ostream &, const VersionKey &);
+
+bool parse_version_key(std::string_view, VersionKey &);
+
+void        sort_version_keys(VersionKey *, std::size_t);
+std::size_t unique_version_keys(VersionKey *, std::size_t);
+bool        minmax_version_keys(const VersionKey *,
+                                std::size_t,
+                                VersionKey &,
+                                VersionKey &);
+
+#endif // !_VersionKey_hpp_
+
+// VersionKey.hpp ends here.
@@ -0,0 +1,499 @@
+//
+// VersionScanner.cpp --- Version string scanner for logs and text.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 09:20:51
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionScanner.cpp
+ * @author Paul Ward
+ * @brief Version string scanner for logs and text.
+ */
+
+#include "VersionScanner.hpp"
+#include "Console.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+#if !PLATFORM_EQ(PLATFORM_WINDOWS)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define VSCAN_SSE2
+# include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+# define VSCAN_NEON
+# include <arm_neon.h>
+#endif
+
+#if COMPILER_EQ(COMPILER_MICROSOFT)
+# include <intrin.h>
+#endif
+
+using namespace std;
+
+#define VSCAN_BLOCK   64
+#define VSCAN_MIN_RUN 7                 // `0.0.0.0'.
+#define VSCAN_CARRIED static_cast<size_t>(-1)
+#define VSCAN_READ    (1024 * 1024)
+
+static inline
+unsigned
+first_bit(uint64_t x)
+{
+#if COMPILER_EQ(COMPILER_MICROSOFT)
+  unsigned long idx;
+
+  _BitScanForward64(&idx, x);
+
+  return static_cast<unsigned>(idx);
+#else
+  return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+}
+
+static inline
+unsigned
+last_bit(uint64_t x)
+{
+#if COMPILER_EQ(COMPILER_MICROSOFT)
+  unsigned long idx;
+
+  _BitScanReverse64(&idx, x);
+
+  return static_cast<unsigned>(idx);
+#else
+  return 63 - static_cast<unsigned>(__builtin_clzll(x));
+#endif
+}
+
+static inline
+uint64_t
+below(unsigned bit)
+{
+  return (bit >= 64) ? ~0ULL : (1ULL << bit) - 1;
+}
+
+/*
+ * Only enough of an open run is kept to tell that it is too long.
+ */
+static inline
+void
+carry(string &buf, const char *data, size_t len)
+{
+  buf.append(data, min(len, VSCAN_MAX_RUN + 1 - buf.size()));
+}
+
+#if defined(VSCAN_NEON)
+static inline
+uint64_t
+neon_mask(uint8x16_t a, uint8x16_t b, uint8x16_t c, uint8x16_t d)
+{
+  const uint8x16_t bits = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+  };
+  uint8x16_t       s0   = vpaddq_u8(vandq_u8(a, bits), vandq_u8(b, bits));
+  uint8x16_t       s1   = vpaddq_u8(vandq_u8(c, bits), vandq_u8(d, bits));
+
+  s0 = vpaddq_u8(s0, s1);
+  s0 = vpaddq_u8(s0, s0);
+
+  return vgetq_lane_u64(vreinterpretq_u64_u8(s0), 0);
+}
+#endif
+
+/*
+ * One bit per byte of a 64-byte block: `cls' for digits and dots,
+ * `dot' for dots alone.  Digits and dots are the range `.' to `9'
+ * less `/', so each is one subtract, one unsigned compare and one
+ * equality test.
+ */
+static inline
+void
+classify(const unsigned char *p, uint64_t &cls, uint64_t &dot)
+{
+#if defined(VSCAN_SSE2)
+  const __m128i first = _mm_set1_epi8('.');
+  const __m128i span  = _mm_set1_epi8('9' - '.');
+  const __m128i slash = _mm_set1_epi8('/');
+
+  cls = 0;
+  dot = 0;
+
+  for (unsigned k = 0; k < VSCAN_BLOCK / 16; k++) {
+    __m128i v  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + k * 16));
+    __m128i t  = _mm_sub_epi8(v, first);
+    __m128i in = _mm_cmpeq_epi8(_mm_min_epu8(t, span), t);
+    __m128i sl = _mm_cmpeq_epi8(v, slash);
+    __m128i dt = _mm_cmpeq_epi8(v, first);
+
+    cls |= static_cast<uint64_t>(static_cast<uint32_t>(
+             _mm_movemask_epi8(_mm_andnot_si128(sl, in)))) << (k * 16);
+    dot |= static_cast<uint64_t>(static_cast<uint32_t>(
+             _mm_movemask_epi8(dt))) << (k * 16);
+  }
+#elif defined(VSCAN_NEON)
+  const uint8x16_t first = vdupq_n_u8('.');
+  const uint8x16_t span  = vdupq_n_u8('9' - '.');
+  const uint8x16_t slash = vdupq_n_u8('/');
+  uint8x16_t       in[4];
+  uint8x16_t       dt[4];
+
+  for (unsigned k = 0; k < VSCAN_BLOCK / 16; k++) {
+    uint8x16_t v = vld1q_u8(p + k * 16);
+
+    in[k] = vbicq_u8(vcleq_u8(vsubq_u8(v, first), span), vceqq_u8(v, slash));
+    dt[k] = vceqq_u8(v, first);
+  }
+
+  cls = neon_mask(in[0], in[1], in[2], in[3]);
+  dot = neon_mask(dt[0], dt[1], dt[2], dt[3]);
+#else
+  cls = 0;
+  dot = 0;
+
+  for (unsigned i = 0; i < VSCAN_BLOCK; i++) {
+    unsigned char c = p[i];
+
+    cls |= static_cast<uint64_t>((static_cast<unsigned char>(c - '0') < 10) |
+                                 (c == '.')) << i;
+    dot |= static_cast<uint64_t>(c == '.') << i;
+  }
+#endif
+}
+
+/**
+ * @brief Parse a run of digits and dots as a version.
+ * @param run First byte of the run.
+ * @param len Length of the run.
+ * @param offset Input offset of the first byte.
+ * @param match Receives the version and the offset of its first digit.
+ * @returns true if the run is four dotted 32-bit numbers.
+ */
+bool
+parse_version_run(const char   *run,
+                  size_t        len,
+                  uint64_t      offset,
+                  VersionMatch &match)
+{
+  const char *end;
+  uint32_t    v[4];
+
+  if (len > VSCAN_MAX_RUN) {
+    return false;
+  }
+
+  while (len > 0 && *run == '.') {
+    run++;
+    len--;
+    offset++;
+  }
+
+  while (len > 0 && run[len - 1] == '.') {
+    len--;
+  }
+
+  if (len < VSCAN_MIN_RUN) {
+    return false;
+  }
+
+  end = run + len;
+
+  for (unsigned i = 0; i < 4; i++) {
+    from_chars_result res = from_chars(run, end, v[i]);
+
+    if (res.ec != errc() || res.ptr == run) {
+      return false;
+    }
+
+    run = res.ptr;
+
+    if (i < 3) {
+      if (run == end || *run != '.') {
+        return false;
+      }
+
+      run++;
+    }
+  }
+
+  if (run != end) {
+    return false;
+  }
+
+  match = { offset, v[0], v[1], v[2], v[3] };
+
+  return true;
+}
+
+VersionScanner::VersionScanner()
+  : offset_(0),
+    in_run_(false),
+    last_digit_(false),
+    run_start_(0),
+    carry_()
+{}
+
+VersionScanner::~VersionScanner()
+{}
+
+void
+VersionScanner::reset()
+{
+  offset_     = 0;
+  in_run_     = false;
+  last_digit_ = false;
+  run_start_  = 0;
+  carry_.clear();
+}
+
+uint64_t
+VersionScanner::get_offset() const
+{
+  return offset_;
+}
+
+/**
+ * @brief Scan the next chunk of input.
+ * @param data The chunk.
+ * @param len Its length.
+ * @param out Receives the matches that end in this chunk.
+ *
+ * A match still open at the end of the chunk is reported by a later
+ * call, or by @c finish.
+ */
+void
+VersionScanner::feed(const char *data, size_t len, VersionMatchVector &out)
+{
+  const unsigned char *p     = reinterpret_cast<const unsigned char *>(data);
+  size_t               start = in_run_ ? VSCAN_CARRIED : 0;
+
+  for (size_t pos = 0; pos < len; pos += VSCAN_BLOCK) {
+    size_t   n = min<size_t>(VSCAN_BLOCK, len - pos);
+    uint64_t cls;
+    uint64_t dot;
+    uint64_t digits;
+    uint64_t gaps;
+    uint64_t cand;
+    unsigned bit = 0;
+
+    if (n == VSCAN_BLOCK) {
+      classify(p + pos, cls, dot);
+    } else {
+      unsigned char tail[VSCAN_BLOCK] = { 0 };
+
+      ::memcpy(tail, p + pos, n);
+      classify(tail, cls, dot);
+
+      // Past the end counts as part of a run, which keeps the last
+      // one open for the next chunk.
+      cls |= ~below(static_cast<unsigned>(n));
+    }
+
+    // Only runs with a dot after a digit can match, so they are the
+    // only ones found; most text has none and costs nothing more.
+    digits      = cls & ~dot;
+    gaps        = ~cls;
+    cand        = dot & ((digits << 1) | (last_digit_ ? 1 : 0));
+    last_digit_ = ((digits >> (n - 1)) & 1) != 0;
+
+    if (in_run_) {
+      if (gaps == 0) {
+        continue;
+      }
+
+      bit = first_bit(gaps);
+      end_run(data, start, pos + bit, out);
+      in_run_ = false;
+      cand   &= ~below(bit);
+    }
+
+    while (cand != 0) {
+      uint64_t before = gaps & below(first_bit(cand));
+      uint64_t after  = gaps & ~below(first_bit(cand));
+      unsigned from   = (before != 0) ? last_bit(before) + 1 : 0;
+
+      if (after == 0) {
+        in_run_ = true;
+        start   = pos + from;
+        break;
+      }
+
+      bit        = first_bit(after);
+      cand      &= ~below(bit);
+      run_start_ = offset_ + pos + from;
+      end_run(data, pos + from, pos + bit, out);
+    }
+
+    // A run reaching the end of the block may gain its dots later.
+    if (!in_run_ && (cls >> 63) != 0) {
+      in_run_ = true;
+      start   = pos + ((gaps != 0) ? last_bit(gaps) + 1 : 0);
+    }
+
+    if (in_run_ && start != VSCAN_CARRIED) {
+      run_start_ = offset_ + start;
+    }
+  }
+
+  if (in_run_) {
+    if (start != VSCAN_CARRIED) {
+      carry_.clear();
+      carry(carry_, data + start, len - start);
+    } else {
+      carry(carry_, data, len);
+    }
+  }
+
+  offset_ += len;
+}
+
+/**
+ * @brief Report a run still open at the end of input.
+ */
+void
+VersionScanner::finish(VersionMatchVector &out)
+{
+  VersionMatch match;
+
+  if (in_run_ && parse_version_run(carry_.data(), carry_.size(),
+                                   run_start_, match)) {
+    out.push_back(match);
+  }
+
+  in_run_     = false;
+  last_digit_ = false;
+  carry_.clear();
+}
+
+void
+VersionScanner::end_run(const char         *data,
+                        size_t              start,
+                        size_t              end,
+                        VersionMatchVector &out)
+{
+  VersionMatch match;
+  bool         found;
+
+  if (start == VSCAN_CARRIED) {
+    carry(carry_, data, end);
+    found = parse_version_run(carry_.data(), carry_.size(),
+                              run_start_, match);
+    carry_.clear();
+  } else {
+    found = parse_version_run(data + start, end - start,
+                              run_start_, match);
+  }
+
+  if (found) {
+    out.push_back(match);
+  }
+}
+
+/**
+ * @brief Scan a whole buffer.
+ */
+void
+VersionScanner::scan(const char *data, size_t len, VersionMatchVector &out)
+{
+  VersionScanner scanner;
+
+  scanner.feed(data, len, out);
+  scanner.finish(out);
+}
+
+/**
+ * @brief Scan a file, mapping it where possible.
+ * @returns false if the file cannot be read.
+ */
+bool
+VersionScanner::scan_file(const string &path, VersionMatchVector &out)
+{
+#if PLATFORM_EQ(PLATFORM_WINDOWS)
+  ifstream       strm(path, ios::binary);
+  VersionScanner scanner;
+  vector<char>   buf(VSCAN_READ);
+
+  if (!strm.is_open()) {
+    return false;
+  }
+
+  while (strm) {
+    strm.read(buf.data(), static_cast<streamsize>(buf.size()));
+    scanner.feed(buf.data(), static_cast<size_t>(strm.gcount()), out);
+  }
+
+  scanner.finish(out);
+
+  return !strm.bad();
+#else
+  struct stat st;
+  void       *map;
+  size_t      size;
+  int         fd = ::open(path.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  size = static_cast<size_t>(st.st_size);
+
+  if (size == 0) {
+    ::close(fd);
+    return true;
+  }
+
+  map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+
+  if (map == MAP_FAILED) {
+    return false;
+  }
+
+  ::madvise(map, size, MADV_SEQUENTIAL);
+  scan(static_cast<const char *>(map), size, out);
+  ::munmap(map, size);
+
+  return true;
+#endif
+}
+
+// VersionScanner.cpp ends here.
@@ -0,0 +1,113 @@
+//
+// VersionScanner.hpp --- Version string scanner for logs and text.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    20 Oct 2026 09:12:36
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file VersionScanner.hpp
+ * @author Paul Ward
+ * @brief Version string scanner for logs and text.
+ *
+ * Finds `major.minor.build.patch' in arbitrary text.  A candidate is a
+ * run of digits and dots; after dropping any dots at either end it
+ * must be exactly four numbers that each fit in 32 bits.  Anything
+ * else, such as `1.2.3' or `1.2.3.4.5', is not a match.
+ *
+ * Input is classified 64 bytes at a time with SSE2 or NEON where
+ * available, and only runs with a dot after a digit are looked at,
+ * so plain text, timestamps and file names cost a few instructions
+ * per block.  Matches are parsed with @c from_chars.  Text can be fed
+ * in chunks of any size; a run cut by a chunk boundary is carried
+ * over to the next.
+ */
+
+#pragma once
+#ifndef _VersionScanner_hpp_
+#define _VersionScanner_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @def VSCAN_MAX_RUN
+ * @brief Longest run of digits and dots considered.
+ *
+ * Four 10-digit numbers and their dots take 43 bytes; longer runs are
+ * ignored.
+ */
+#define VSCAN_MAX_RUN 64
+
+struct VersionMatch
+{
+  std::uint64_t offset;         // First digit, from the start of input.
+  std::uint32_t major;
+  std::uint32_t minor;
+  std::uint32_t build;
+  std::uint32_t patch;
+};
+
+typedef std::vector<VersionMatch> VersionMatchVector;
+
+class VersionScanner
+{
+private:
+  std::uint64_t offset_;        // Input consumed so far.
+  bool          in_run_;
+  bool          last_digit_;    // Last byte seen was a digit.
+  std::uint64_t run_start_;
+  std::string   carry_;         // The open run, when it began in an
+                                // earlier chunk.
+
+public:
+  VersionScanner();
+  ~VersionScanner();
+
+  void          reset();
+  void          feed(const char *, std::size_t, VersionMatchVector &);
+  void          finish(VersionMatchVector &);
+  std::uint64_t get_offset() const;
+
+  static void scan(const char *, std::size_t, VersionMatchVector &);
+  static bool scan_file(const std::string &, VersionMatchVector &);
+
+private:
+  void end_run(const char *, std::size_t, std::size_t, VersionMatchVector &);
+};
+
+bool parse_version_run(const char *,
+                       std::size_t,
+                       std::uint64_t,
+                       VersionMatch &);
+
+#endif // !_VersionScanner_hpp_
+
+// VersionScanner.hpp ends here.
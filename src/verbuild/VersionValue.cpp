@@ -0,0 +1,76 @@
+//
+// VersionValue.cpp --- Plain version value type.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:52:30
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+
+/**
+ * @file VersionValue.cpp
+ * @author Paul Ward
+ * @brief Plain version value type.
+ */
+
+#include "VersionValue.hpp"
+
+#include <sstream>
+
+using namespace std;
+
+ostream &
+operator<<(ostream &os, const VersionStatus &status)
+{
+  switch (status) {
+    case VersionStatus::Ok:          os << "ok";           break;
+    case VersionStatus::NeedsPolicy: os << "needs policy"; break;
+    case VersionStatus::OutOfRange:  os << "out of range"; break;
+  }
+
+  return os;
+}
+
+string
+VersionValue::to_string() const
+{
+  stringstream ss;
+
+  ss << major << "."
+     << minor << "."
+     << build << "."
+     << patch;
+
+  return ss.str();
+}
+
+ostream &
+operator<<(ostream &os, const VersionValue &obj)
+{
+  os << obj.to_string();
+
+  return os;
+}
+
+// VersionValue.cpp ends here.
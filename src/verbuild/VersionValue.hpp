@@ -0,0 +1,257 @@
+//
+// VersionValue.hpp --- Plain version value type.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 16:41:07
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+
+/**
+ * @file VersionValue.hpp
+ * @author Paul Ward
+ * @brief Plain version value type.
+ *
+ * @c VersionValue holds the numbers of a version and nothing else: no
+ * logging, no policy and no history.  It is trivially copyable, so
+ * it can live in vectors by value, be copied with @c memcpy or placed
+ * in shared memory, and its increment and comparisons are @c constexpr.
+ *
+ * Date-based builds take the day as an argument rather than reading
+ * the clock.  Policy-based builds cannot be computed here; increment
+ * reports @c VersionStatus::NeedsPolicy and leaves the build alone so
+ * that @c VersionInfo can hand it to its policy.
+ */
+
+#pragma once
+#ifndef _VersionValue_hpp_
+#define _VersionValue_hpp_
+
+#include "Support.hpp"
+#include "Enums.hpp"
+#include "VersionKey.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+enum class VersionStatus : std::uint8_t {
+  Ok       = 0,
+  NeedsPolicy,                  //!< Build is computed by a policy.
+  OutOfRange,                   //!< Date build did not fit; set to 0.
+};
+
+std::ostream &operator<<(std::ostream &, const VersionStatus &);
+
+/**
+ * @brief A calendar day, as used by date-based builds.
+ */
+struct VersionDate
+{
+  std::uint32_t year;
+  std::uint32_t month;
+  std::uint32_t day;
+};
+
+struct VersionValue
+{
+  std::uint32_t major     = 0;
+  std::uint32_t minor     = 0;
+  std::uint32_t build     = 0;
+  std::uint32_t patch     = 0;
+  std::uint32_t base_year = 0;
+  IncrementType type      = IncrementType::Simple;
+
+  /**
+   * @brief Add one, saturating at @c UINT32_MAX.
+   */
+  static constexpr std::uint32_t incr(std::uint32_t lhs)
+  {
+    return (lhs == UINT32_MAX) ? UINT32_MAX : lhs + 1;
+  }
+
+  /**
+   * @brief Add, saturating at @c UINT32_MAX.
+   */
+  static constexpr std::uint32_t add(std::uint32_t lhs, std::uint32_t rhs)
+  {
+    return (UINT32_MAX - rhs < lhs) ? UINT32_MAX : lhs + rhs;
+  }
+
+  /**
+   * @brief Whether builds of @c type are computed by a policy.
+   */
+  static constexpr bool needs_policy(IncrementType type)
+  {
+    return type == IncrementType::Script
+        || type == IncrementType::GitTag
+        || type == IncrementType::GitSha
+        || type == IncrementType::GitCount;
+  }
+
+  /**
+   * @brief Compute the next build number for @c today.
+   */
+  constexpr VersionStatus perform(const VersionDate &today)
+  {
+    std::uint64_t next = 0;
+
+    switch (type) {
+      case IncrementType::Simple:
+        build++;
+        return VersionStatus::Ok;
+
+      case IncrementType::ByMonths:
+        if (base_year == 0) {
+          return VersionStatus::Ok;
+        }
+
+        if (today.year < base_year) {
+          build = 0;
+          return VersionStatus::OutOfRange;
+        }
+
+        next = (static_cast<std::uint64_t>(today.year - base_year) * 12
+                + today.month) * 100 + today.day;
+        break;
+
+      case IncrementType::ByYears:
+        if (today.year < base_year) {
+          build = 0;
+          return VersionStatus::OutOfRange;
+        }
+
+        next = static_cast<std::uint64_t>(today.year - base_year) * 10000
+             + today.month * 100 + today.day;
+        break;
+
+      case IncrementType::ByDate:
+        next = static_cast<std::uint64_t>(today.year) * 10000
+             + today.month * 100 + today.day;
+        break;
+
+      default:
+        return VersionStatus::NeedsPolicy;
+    }
+
+    if (next > UINT32_MAX) {
+      build = 0;
+      return VersionStatus::OutOfRange;
+    }
+
+    build = static_cast<std::uint32_t>(next);
+
+    return VersionStatus::Ok;
+  }
+
+  /**
+   * @brief Increment the fields selected by @c mode.
+   *
+   * Fields are updated major, minor, build, patch.  A policy-based
+   * build is left unchanged and reported as @c NeedsPolicy.
+   */
+  constexpr VersionStatus increment(IncrementMode      mode,
+                                    const VersionDate &today)
+  {
+    VersionStatus status = VersionStatus::Ok;
+
+    if ((mode & IncrementMode::Major) == IncrementMode::Major) {
+      major = incr(major);
+    }
+
+    if ((mode & IncrementMode::Minor) == IncrementMode::Minor) {
+      minor = incr(minor);
+    }
+
+    if ((mode & IncrementMode::Build) == IncrementMode::Build) {
+      status = perform(today);
+    }
+
+    if ((mode & IncrementMode::Patch) == IncrementMode::Patch) {
+      patch = incr(patch);
+    }
+
+    return status;
+  }
+
+  constexpr VersionKey to_key() const
+  {
+    return VersionKey::make(major, minor, build, patch);
+  }
+
+  std::string to_string() const;
+};
+
+static_assert(std::is_trivially_copyable<VersionValue>::value,
+              "VersionValue must be trivially copyable");
+static_assert(std::is_standard_layout<VersionValue>::value,
+              "VersionValue must be standard layout");
+
+/*
+ * Comparisons look at the four version fields only, as @c VersionInfo
+ * always has; base year and increment type are not part of a version.
+ */
+
+constexpr bool
+operator==(const VersionValue &a, const VersionValue &b)
+{
+  return a.to_key() == b.to_key();
+}
+
+constexpr bool
+operator!=(const VersionValue &a, const VersionValue &b)
+{
+  return !(a == b);
+}
+
+constexpr bool
+operator<(const VersionValue &a, const VersionValue &b)
+{
+  return a.to_key() < b.to_key();
+}
+
+constexpr bool
+operator>(const VersionValue &a, const VersionValue &b)
+{
+  return b < a;
+}
+
+constexpr bool
+operator<=(const VersionValue &a, const VersionValue &b)
+{
+  return !(b < a);
+}
+
+constexpr bool
+operator>=(const VersionValue &a, const VersionValue &b)
+{
+  return !(a < b);
+}
+
+std::ostream &operator<<(std::ostream &, const VersionValue &);
+
+#endif // !_VersionValue_hpp_
+
+// VersionValue.hpp ends here.
@@ -0,0 +1,298 @@
+//
+// Watcher.cpp --- File change notification.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 22:24:57
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+//
+// }}}
+
+/**
+ * @file Watcher.cpp
+ * @author Paul Ward
+ * @brief File change notification.
+ */
+
+#include "Watcher.hpp"
+#include "Console.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#if PLATFORM_EQ(PLATFORM_LINUX)
+# include <poll.h>
+# include <sys/inotify.h>
+# include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+using namespace std;
+
+#if PLATFORM_EQ(PLATFORM_LINUX)
+# define WATCH_MASK                                                     \
+  (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | \
+   IN_ONLYDIR)
+#endif
+
+static inline
+bool
+is_lock_file(const string &name)
+{
+  return name.size() > 5 && name.compare(name.size() - 5, 5, ".lock") == 0;
+}
+
+Watcher::Watcher()
+  : fd_(-1),
+    watches_()
+{}
+
+Watcher::~Watcher()
+{
+  close();
+}
+
+bool
+Watcher::open()
+{
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  close();
+
+  fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd_ < 0) {
+    ESAY("Cannot start watching:", strerror(errno));
+    return false;
+  }
+
+  return true;
+#else
+  ESAY("Watching is only supported on GNU/Linux.");
+  return false;
+#endif
+}
+
+void
+Watcher::close()
+{
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+#endif
+
+  fd_ = -1;
+  watches_.clear();
+}
+
+/**
+ * @brief Watch a single file, which need not exist yet.
+ */
+bool
+Watcher::add_file(const string &path)
+{
+  fs::path file(fs::absolute(path));
+  int      wd = add_watch(file.parent_path().string());
+
+  if (wd < 0) {
+    return false;
+  }
+
+  watches_[wd].names.insert(file.filename().string());
+  DSAY(DEBUG_HIGH, "Watching file", file.string());
+
+  return true;
+}
+
+/**
+ * @brief Watch a directory and everything below it.
+ *
+ * Directories created later are picked up as they appear.
+ */
+bool
+Watcher::add_tree(const string &path)
+{
+  error_code ec;
+  int        wd = add_watch(path);
+
+  if (wd < 0) {
+    return false;
+  }
+
+  watches_[wd].tree = true;
+  DSAY(DEBUG_HIGH, "Watching tree", path);
+
+  for (fs::recursive_directory_iterator it(path, ec), end;
+       !ec && it != end;
+       it.increment(ec)) {
+    if (it->is_directory(ec)) {
+      int sub = add_watch(it->path().string());
+
+      if (sub >= 0) {
+        watches_[sub].tree = true;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Wait for a burst of changes to end.
+ * @param quiet_ms How long no further changes must arrive.
+ * @returns false if the watcher failed.
+ */
+bool
+Watcher::wait(unsigned quiet_ms)
+{
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  bool changed = false;
+
+  for (;;) {
+    struct pollfd pfd = { fd_, POLLIN, 0 };
+    int           n   = ::poll(&pfd, 1, changed ? static_cast<int>(quiet_ms)
+                                                : -1);
+
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      ESAY("Watch failed:", strerror(errno));
+      return false;
+    }
+
+    if (n == 0) {
+      return true;
+    }
+
+    changed = read_events() || changed;
+  }
+#else
+  (void)quiet_ms;
+
+  return false;
+#endif
+}
+
+/**
+ * @brief Discard changes already queued, such as our own writes.
+ */
+void
+Watcher::drain()
+{
+  while (fd_ >= 0) {
+#if PLATFORM_EQ(PLATFORM_LINUX)
+    struct pollfd pfd = { fd_, POLLIN, 0 };
+
+    if (::poll(&pfd, 1, 0) <= 0) {
+      break;
+    }
+#endif
+
+    read_events();
+  }
+}
+
+size_t
+Watcher::get_watch_count() const
+{
+  return watches_.size();
+}
+
+int
+Watcher::add_watch(const string &path)
+{
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  int wd = inotify_add_watch(fd_, path.c_str(), WATCH_MASK);
+
+  if (wd < 0) {
+    WSAY("Cannot watch", path + ":", strerror(errno));
+    return -1;
+  }
+
+  watches_[wd].path = path;
+
+  return wd;
+#else
+  (void)path;
+
+  return -1;
+#endif
+}
+
+/*
+ * Read whatever events are queued.  Returns true if any of them
+ * concern a watched file.
+ */
+bool
+Watcher::read_events()
+{
+#if PLATFORM_EQ(PLATFORM_LINUX)
+  alignas(struct inotify_event) char buffer[WATCH_BUFFER_SIZE];
+  bool                               relevant = false;
+
+  for (;;) {
+    ssize_t len = ::read(fd_, buffer, sizeof(buffer));
+
+    if (len <= 0) {
+      break;
+    }
+
+    for (char *p = buffer; p < buffer + len; ) {
+      const struct inotify_event *ev =
+        reinterpret_cast<const struct inotify_event *>(p);
+      auto   it   = watches_.find(ev->wd);
+      string name = (ev->len > 0) ? string(ev->name) : string();
+
+      p += sizeof(struct inotify_event) + ev->len;
+
+      if (ev->mask & IN_IGNORED) {
+        watches_.erase(ev->wd);
+        continue;
+      }
+
+      if (it == watches_.end() || is_lock_file(name)) {
+        continue;
+      }
+
+      if (!it->second.tree && it->second.names.count(name) == 0) {
+        continue;
+      }
+
+      if (it->second.tree && (ev->mask & IN_CREATE) && (ev->mask & IN_ISDIR)) {
+        add_tree((fs::path(it->second.path) / name).string());
+      }
+
+      DSAY(DEBUG_HIGH, "Change in", it->second.path, name);
+      relevant = true;
+    }
+  }
+
+  return relevant;
+#else
+  return false;
+#endif
+}
+
+// Watcher.cpp ends here.
@@ -0,0 +1,100 @@
+//
+// Watcher.hpp --- File change notification.
+//
+// Copyright (c) 2026 Paul Ward <asmodai@gmail.com>
+//
+// Author:     Paul Ward <asmodai@gmail.com>
+// Maintainer: Paul Ward <asmodai@gmail.com>
+// Created:    19 Oct 2026 22:15:02
+//
+// {{{ License:
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, see <http://www.gnu.org/licenses/>.
+//
+// }}}
+// {{{ Commentary:
+
+// }}}
+
+/**
+ * @file Watcher.hpp
+ * @author Paul Ward
+ * @brief File change notification.
+ *
+ * Waits for changes to a set of files and directory trees using
+ * inotify.  Files are watched through their parent directory, since
+ * git replaces HEAD and refs by renaming a lock file over them, which
+ * would orphan a watch on the file itself.  Lock files are ignored.
+ *
+ * Waiting blocks in poll() with no timeout until the first change, so
+ * an idle watcher uses no CPU.  Further changes then restart a short
+ * quiet period, and the wait returns once it passes, so a burst of
+ * changes results in a single wake-up.
+ *
+ * Only available on GNU/Linux; elsewhere @c open fails.
+ */
+
+#pragma once
+#ifndef _Watcher_hpp_
+#define _Watcher_hpp_
+
+#include "Support.hpp"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+
+/**
+ * @def WATCH_BUFFER_SIZE
+ * @brief Bytes of inotify events read at once.
+ */
+#define WATCH_BUFFER_SIZE 4096
+
+class Watcher
+{
+private:
+  struct Watch {
+    std::string           path;
+    bool                  tree;         // Any change below counts.
+    std::set<std::string> names;        // Otherwise only these entries.
+  };
+
+  int                  fd_;
+  std::map<int, Watch> watches_;
+
+public:
+  Watcher();
+  Watcher(const Watcher &) = delete;
+  ~Watcher();
+
+  bool open();
+  void close();
+
+  bool add_file(const std::string &);
+  bool add_tree(const std::string &);
+
+  bool wait(unsigned);
+  void drain();
+
+  std::size_t get_watch_count() const;
+
+private:
+  int  add_watch(const std::string &);
+  bool read_events();
+};
+
+#endif // !_Watcher_hpp_
+
+// Watcher.hpp ends here.
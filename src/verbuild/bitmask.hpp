@@ -41,7 +41,7 @@
 
 #include <type_traits>
 
-#if CXX_STANDARD_LT(STANDARD_CXX11)
+#if __cplusplus < 201103L
 # define ENABLE_BITMASK_OPS(__e)
 #else
 
@@ -52,6 +52,7 @@ struct EnableBitMaskOperators
 };
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator&(Enum l, Enum r)
 {
@@ -65,6 +66,7 @@ operator&(Enum l, Enum r)
 }
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator|(Enum l, Enum r)
 {
@@ -78,6 +80,7 @@ operator|(Enum l, Enum r)
 }
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator^(Enum l, Enum r)
 {
@@ -91,6 +94,7 @@ operator^(Enum l, Enum r)
 }
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type
 operator~(Enum x)
 {
@@ -102,6 +106,7 @@ operator~(Enum x)
 }
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type &
 operator&=(Enum &l, Enum r)
 {
@@ -113,6 +118,7 @@ operator&=(Enum &l, Enum r)
 }
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type &
 operator|=(Enum &l, Enum r)
 {
@@ -124,6 +130,7 @@ operator|=(Enum &l, Enum r)
 }
 
 template <typename Enum>
+constexpr
 typename std::enable_if<EnableBitMaskOperators<Enum>::enable, Enum>::type &
 operator^=(Enum &l, Enum r)
 {
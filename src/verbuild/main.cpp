@@ -38,6 +38,10 @@
 #include "Enums.hpp"
 
 #include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "VersionInfo.hpp"
 #include "version.hpp"
@@ -45,6 +49,230 @@
 #include "Config.hpp"
 
 #include "Transform_C.hpp"
+#include "Transform_Lua.hpp"
+#include "Transform_Template.hpp"
+#include "Transform_JSON.hpp"
+#include "Transform_CMake.hpp"
+#include "Transform_Env.hpp"
+#include "Transform_Region.hpp"
+#include "Transform_Manifest.hpp"
+#include "Transform_ELF.hpp"
+#include "LuaPolicy.hpp"
+#include "GitPolicy.hpp"
+#include "InputDigest.hpp"
+#include "GitRepo.hpp"
+#include "Watcher.hpp"
+#include "History.hpp"
+#include "Command_Decode.hpp"
+#include "Command_History.hpp"
+#include "Command_Match.hpp"
+#include "Command_Scan.hpp"
+
+namespace fs = std::filesystem;
+
+typedef std::vector<std::unique_ptr<Transform>> TransformVector;
+
+/*
+ * Write every output.  Each output has its own transform and file, so
+ * with more than one they are written on their own threads.  A script
+ * may assign to the version it is given, so each output is written
+ * from its own copy.
+ */
+static
+bool
+write_outputs(TransformVector &outputs, const VersionInfo &vi)
+{
+  std::vector<std::thread> workers;
+  std::unique_ptr<bool[]>  ok(new bool[outputs.size()]);
+  bool                     all = true;
+
+  if (outputs.size() == 1) {
+    VersionInfo copy(vi.get_value());
+
+    ok[0] = outputs[0]->write(copy);
+  } else {
+    for (size_t i = 0; i < outputs.size(); i++) {
+      workers.emplace_back([&, i]() {
+        VersionInfo copy(vi.get_value());
+
+        ok[i] = outputs[i]->write(copy);
+      });
+    }
+
+    for (auto &it : workers) {
+      it.join();
+    }
+  }
+
+  for (size_t i = 0; i < outputs.size(); i++) {
+    if (!ok[i]) {
+      FATAL("Could not write", outputs[i]->get_config().filename);
+      all = false;
+    }
+  }
+
+  return all;
+}
+
+/*
+ * Read the first output, increment, and write every output.  With
+ * `--if-changed', nothing is done while the inputs' digest matches the
+ * one stored by the last run.
+ */
+static
+bool
+regenerate(Config &conf, TransformVector &outputs, IncrementPolicy *policy)
+{
+  VersionInfo    vi;
+  History        history(conf.history, conf.component);
+  HistoryVersion before = { 0, 0, 0, 0 };
+  uint64_t       digest = 0;
+  uint64_t       stored = 0;
+
+  if (policy != nullptr) {
+    vi.set_increment_policy(policy);
+  }
+
+  if (!conf.if_changed.empty()) {
+    std::string   cache_file(conf.digest_file + HASH_CACHE_SUFFIX);
+    FileHashCache cache;
+    InputDigest   inputs(conf.if_changed, &cache);
+
+    // Everything this run writes may well sit among the inputs.  Their
+    // temporary files are left out along with them.
+    for (auto &it : conf.outputs) {
+      inputs.exclude(it.filename);
+    }
+
+    inputs.exclude(conf.digest_file);
+    inputs.exclude(cache_file);
+
+    if (!conf.history.empty()) {
+      inputs.exclude(conf.history);
+      inputs.exclude(conf.history + HISTORY_INDEX_SUFFIX);
+      inputs.exclude(conf.history + HISTORY_LOCK_SUFFIX);
+    }
+
+    cache.load(cache_file);
+
+    if (!inputs.compute(digest)) {
+      FATAL("Could not hash the inputs.");
+      return false;
+    }
+
+    if (!cache.save(cache_file, inputs.get_start_time())) {
+      WSAY("Could not save the hash cache", cache_file);
+    }
+
+    if (InputDigest::load(conf.digest_file, stored) &&
+        stored == digest &&
+        outputs.front()->read(vi)) {
+      OK("Inputs unchanged, version is still:", vi);
+      return true;
+    }
+  }
+
+  // Only the first output is read; the rest are derived from it.  A
+  // file that is there but holds no version is an error, not a reason
+  // to start again from 0.0.0.0.
+  if (outputs.front()->read(vi)) {
+    vi.set_increment_type(conf.incr_type);
+    vi.set_base_year(conf.base_year);
+  } else if (outputs.front()->exists()) {
+    FATAL("Could not read a version from",
+          outputs.front()->get_config().filename);
+    return false;
+  } else if (conf.create || conf.filename.length() == 0) {
+    vi.set_increment_type(conf.incr_type);
+    vi.set_base_year(conf.base_year);
+    vi.set_major(0);
+    vi.set_minor(0);
+    vi.set_build(0);
+    vi.set_patch(0);
+  } else {
+    FATAL("Could not open", conf.filename, "for reading.");
+    FATAL("Did you forget to specify `-c'?");
+    return false;
+  }
+
+  before = HistoryVersion {
+    vi.get_major(), vi.get_minor(), vi.get_build(), vi.get_patch()
+  };
+
+  // A failed policy leaves nothing worth writing.
+  if (!vi.increment(conf.incr_mode)) {
+    FATAL("Could not increment the version, no outputs were written.");
+    return false;
+  }
+
+  if (!write_outputs(outputs, vi)) {
+    return false;
+  }
+
+  // Only once the outputs are safely written.
+  if (!conf.if_changed.empty() &&
+      !InputDigest::store(conf.digest_file, digest)) {
+    WSAY("Could not record the input digest in", conf.digest_file);
+  }
+
+  if (!conf.history.empty() && !history.record(before, vi)) {
+    WSAY("Could not record the increment in", history.get_path());
+  }
+
+  OK("Version incremented to:", vi);
+
+  return true;
+}
+
+/*
+ * Regenerate whenever HEAD, the refs or a watched input changes.
+ */
+static
+int
+watch(Config &conf, TransformVector &outputs, IncrementPolicy *policy)
+{
+  Watcher    watcher;
+  GitRepo    repo;
+  PathVector inputs(conf.watch_inputs);
+
+  // Inputs that decide whether to increment are worth watching too.
+  inputs.insert(inputs.end(), conf.if_changed.begin(), conf.if_changed.end());
+
+  if (!watcher.open()) {
+    return EXIT_FAILURE;
+  }
+
+  if (repo.open(".")) {
+    fs::path git(repo.get_git_dir());
+    fs::path common(repo.get_common_dir());
+
+    watcher.add_file((git / "HEAD").string());
+    watcher.add_file((common / "packed-refs").string());
+    watcher.add_tree((common / "refs").string());
+  } else if (inputs.empty()) {
+    FATAL("Not in a git repository, and no --watch-input was given.");
+    return EXIT_FAILURE;
+  }
+
+  for (auto &it : inputs) {
+    if (fs::is_directory(it)) {
+      watcher.add_tree(it);
+    } else {
+      watcher.add_file(it);
+    }
+  }
+
+  LSAY("Watching", watcher.get_watch_count(), "directories.");
+
+  while (watcher.wait(conf.watch_debounce)) {
+    regenerate(conf, outputs, policy);
+
+    // Our own writes may have queued events for watched inputs.
+    watcher.drain();
+  }
+
+  return EXIT_FAILURE;
+}
 
 int
 main(int argc, char **argv)
@@ -55,42 +283,64 @@ main(int argc, char **argv)
   set_program_name(argv[0]);
   set_verbose(false);
 
+  if (argc > 1 && argv[1][0] != '-') {
+    const CommandFactory::Entry *command = FIND_COMMAND(argv[1]);
+
+    if (command == nullptr) {
+      FATAL("Unknown command", argv[1]);
+      return EXIT_FAILURE;
+    }
+
+    return command->run(argc - 1, argv + 1);
+  }
+
   opts->parse(conf, argc, argv);
   if (get_verbose()) {
     LSAY("Configuration:");
     conf.print();
   }
 
-  Transform   *transform = GET_TRANSFORM_CREATE(conf.transform);
-  VersionInfo  vi;
+  TransformVector                  outputs;
+  std::unique_ptr<IncrementPolicy> policy;
 
-  transform->set_config(conf);
-  if (transform->read(vi)) {
-    vi.set_increment_type(conf.incr_type);
-    vi.set_base_year(conf.base_year);
+  for (auto &it : conf.outputs) {
+    outputs.emplace_back(GET_TRANSFORM_CREATE(it.transform));
+    outputs.back()->set_config(conf);
+    outputs.back()->set_filename(it.filename);
+  }
 
-    vi.increment(conf.incr_mode);
-    transform->write(vi);
+  if (conf.incr_type == IncrementType::Script) {
+    LuaPolicy *lua = new LuaPolicy();
 
-    OK("Version incremented to:", vi);
-  } else {
-    if (conf.create || conf.filename.length() == 0) {
-      vi.set_base_year(conf.base_year);
-      vi.set_major(0);
-      vi.set_minor(0);
-      vi.set_build(0);
-      vi.set_patch(0);
-      vi.increment(conf.incr_mode);
-      transform->write(vi);
-
-      OK("Version incremented to:", vi);
-    } else {
-      FATAL("Could not open", conf.filename, "for reading.");
-      FATAL("Did you forget to specify `-c'?");
+    policy.reset(lua);
+
+    if (!lua->load(conf.policy,
+                   conf.script_cache,
+                   make_lua_limits(conf))) {
+      FATAL("Could not load increment policy", conf.policy);
+      return EXIT_FAILURE;
+    }
+  } else if (conf.incr_type == IncrementType::GitTag ||
+             conf.incr_type == IncrementType::GitSha ||
+             conf.incr_type == IncrementType::GitCount) {
+    GitPolicy *git = new GitPolicy();
+
+    policy.reset(git);
+
+    if (!git->open(".")) {
+      FATAL("Increment type", conf.incr_type, "needs a git repository.");
       return EXIT_FAILURE;
     }
   }
 
+  if (!regenerate(conf, outputs, policy.get())) {
+    return EXIT_FAILURE;
+  }
+
+  if (conf.watch) {
+    return watch(conf, outputs, policy.get());
+  }
+
   return EXIT_SUCCESS;
 }
 